@@ -0,0 +1,878 @@
+// .cpp
+// Toolbox Benchmarks
+// by Kyle Furey
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stack>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "Toolbox/Toolbox.h"
+
+// The number of times each benchmark is measured, keeping the fastest and median runs.
+#define BENCHMARK_REPEAT 5
+
+// The seed of every random number generator used by the benchmarks, so each run measures the same data.
+#define BENCHMARK_SEED 12345
+
+/** A suite of benchmarks that measures Toolbox types next to their standard library equivalents. */
+namespace Benchmarks {
+
+	// RESULT
+
+	/** The measured time of one benchmark. */
+	struct Result final {
+
+		// DATA
+
+		/** The group of benchmarks this benchmark belongs to. */
+		std::string Suite;
+
+		/** The operation this benchmark measures. */
+		std::string Case;
+
+		/** The library whose type this benchmark measures. */
+		std::string Library;
+
+		/** The number of elements this benchmark operates on. */
+		size_t Size;
+
+		/** The number of operations each run of this benchmark performs. */
+		size_t Operations;
+
+		/** The fastest run's nanoseconds per operation. */
+		double Best;
+
+		/** The median run's nanoseconds per operation. */
+		double Median;
+	};
+
+
+	// SETTINGS
+
+	/** The settings of a benchmark run read from the command line. */
+	struct Settings final {
+
+		// DATA
+
+		/** The multiplier of each benchmark's element count. */
+		double Scale = 1;
+
+		/** The number of times each benchmark is measured. */
+		size_t Repeat = BENCHMARK_REPEAT;
+
+		/** Only benchmarks whose suite contains this text are run. */
+		std::string Filter;
+
+		/** The path to write results to as JSON, or empty to skip. */
+		std::string Json;
+
+		/** The path to write results to as comma separated values, or empty to skip. */
+		std::string Csv;
+	};
+
+
+	// DATA
+
+	/** The settings of this run. */
+	static Settings Options;
+
+	/** Each measured result of this run. */
+	static std::vector<Result> Results;
+
+	/** A value every benchmark writes to so the compiler cannot remove the measured work. */
+	static volatile size_t Sink = 0;
+
+
+	// MEASURING
+
+	/** Prevents the compiler from optimizing away the given value. */
+	template<typename Type>
+	static void Consume(const Type& Value) {
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(Value) : "memory");
+#else
+		Sink = Sink + static_cast<size_t>(reinterpret_cast<uintptr_t>(&Value) & 1);
+#endif
+	}
+
+	/** Returns the given element count multiplied by the run's scale, and at least the given minimum. */
+	static size_t Scaled(const size_t Count, const size_t Minimum = 16) {
+		const size_t Size = static_cast<size_t>(static_cast<double>(Count) * Options.Scale);
+		return Size > Minimum ? Size : Minimum;
+	}
+
+	/** Returns whether the given suite should run. */
+	static bool Enabled(const char* Suite) {
+		return Options.Filter.empty() || std::string(Suite).find(Options.Filter) != std::string::npos;
+	}
+
+	/**
+	 * Measures the given benchmark, which sets up its data with Setup and performs the given number of operations in Run.<br/>
+	 * Only Run is timed. Both are called once per repeat, after one untimed warm up run.
+	 */
+	template<typename SetupType, typename RunType>
+	static void Measure(const char* Suite, const char* Case, const char* Library, const size_t Size, const size_t Operations, SetupType Setup, RunType Run) {
+		std::vector<double> Times;
+		Times.reserve(Options.Repeat);
+		for (size_t Repeat = 0; Repeat <= Options.Repeat; ++Repeat) {
+			Setup();
+			const auto Start = std::chrono::steady_clock::now();
+			Run();
+			const auto End = std::chrono::steady_clock::now();
+			if (Repeat > 0) {
+				Times.push_back(std::chrono::duration<double, std::nano>(End - Start).count() / static_cast<double>(Operations > 0 ? Operations : 1));
+			}
+		}
+		std::sort(Times.begin(), Times.end());
+		Result Measured{ Suite, Case, Library, Size, Operations, Times.front(), Times[Times.size() / 2] };
+		std::printf("%-14s %-28s %-22s %10zu %12.2f %12.2f\n", Suite, Case, Library, Size, Measured.Best, Measured.Median);
+		std::fflush(stdout);
+		Results.push_back(Measured);
+	}
+
+	/** Measures the given benchmark that needs no setup. */
+	template<typename RunType>
+	static void Measure(const char* Suite, const char* Case, const char* Library, const size_t Size, const size_t Operations, RunType Run) {
+		Measure(Suite, Case, Library, Size, Operations, []() {}, Run);
+	}
+
+
+	// RANDOM DATA
+
+	/** Returns the given number of random integers. */
+	static std::vector<int> RandomIntegers(const size_t Count, const int Maximum = INT32_MAX) {
+		std::mt19937 Random(BENCHMARK_SEED);
+		std::uniform_int_distribution<int> Distribution(0, Maximum);
+		std::vector<int> Integers(Count);
+		for (auto& Integer : Integers) {
+			Integer = Distribution(Random);
+		}
+		return Integers;
+	}
+
+	/** Returns the given number of unique random keys in a random order. */
+	static std::vector<int> UniqueKeys(const size_t Count) {
+		std::vector<int> Keys(Count);
+		for (size_t Index = 0; Index < Count; ++Index) {
+			Keys[Index] = static_cast<int>(Index * 7919 + 1);
+		}
+		std::shuffle(Keys.begin(), Keys.end(), std::mt19937(BENCHMARK_SEED));
+		return Keys;
+	}
+
+
+	// VECTOR
+
+	/** Measures pushing, iterating, and sorting vectors. */
+	static void VectorSuite() {
+		const size_t Count = Scaled(1 << 20);
+		const std::vector<int> Integers = RandomIntegers(Count);
+		Measure("Vector", "PushBack", "Toolbox::Vector", Count, Count, [&]() {
+			Toolbox::Vector<int> Vector;
+			for (const int Integer : Integers) {
+				Vector.PushBack(Integer);
+			}
+			Consume(Vector.Size());
+		});
+		Measure("Vector", "PushBack", "std::vector", Count, Count, [&]() {
+			std::vector<int> Vector;
+			for (const int Integer : Integers) {
+				Vector.push_back(Integer);
+			}
+			Consume(Vector.size());
+		});
+		Toolbox::Vector<int> Vector(Count, Integers.data());
+		std::vector<int> Standard = Integers;
+		Measure("Vector", "Iterate", "Toolbox::Vector", Count, Count, [&]() {
+			long long Sum = 0;
+			for (const int Integer : Vector) {
+				Sum += Integer;
+			}
+			Consume(Sum);
+		});
+		Measure("Vector", "Iterate", "std::vector", Count, Count, [&]() {
+			long long Sum = 0;
+			for (const int Integer : Standard) {
+				Sum += Integer;
+			}
+			Consume(Sum);
+		});
+		Measure("Vector", "Sort", "Toolbox::Vector", Count, Count, [&]() { Vector = Toolbox::Vector<int>(Count, Integers.data()); }, [&]() {
+			Vector.Sort();
+			Consume(Vector[0]);
+		});
+		Measure("Vector", "RadixSort", "Toolbox::Vector", Count, Count, [&]() { Vector = Toolbox::Vector<int>(Count, Integers.data()); }, [&]() {
+			Vector.RadixSort();
+			Consume(Vector[0]);
+		});
+		Measure("Vector", "Sort", "std::sort", Count, Count, [&]() { Standard = Integers; }, [&]() {
+			std::sort(Standard.begin(), Standard.end());
+			Consume(Standard[0]);
+		});
+	}
+
+
+	// LIST, QUEUE, AND STACK
+
+	/** Measures pushing and popping lists, queues, and stacks. */
+	static void SequenceSuite() {
+		const size_t Count = Scaled(1 << 20);
+		Measure("List", "PushBack+PopFront", "Toolbox::List", Count, Count * 2, [&]() {
+			Toolbox::List<int> List;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				List.PushBack(static_cast<int>(Index));
+			}
+			while (!List.IsEmpty()) {
+				Consume(List.Front());
+				List.PopFront();
+			}
+		});
+		Measure("List", "PushBack+PopFront", "std::list", Count, Count * 2, [&]() {
+			std::list<int> List;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				List.push_back(static_cast<int>(Index));
+			}
+			while (!List.empty()) {
+				Consume(List.front());
+				List.pop_front();
+			}
+		});
+		Measure("Queue", "Push+Pop", "Toolbox::Queue", Count, Count * 2, [&]() {
+			Toolbox::Queue<int> Queue;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Queue.Push(static_cast<int>(Index));
+			}
+			while (!Queue.IsEmpty()) {
+				Consume(Queue.Pop());
+			}
+		});
+		Measure("Queue", "Push+Pop", "std::queue", Count, Count * 2, [&]() {
+			std::queue<int> Queue;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Queue.push(static_cast<int>(Index));
+			}
+			while (!Queue.empty()) {
+				Consume(Queue.front());
+				Queue.pop();
+			}
+		});
+		Measure("Stack", "Push+Pop", "Toolbox::Stack", Count, Count * 2, [&]() {
+			Toolbox::Stack<int> Stack;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Stack.Push(static_cast<int>(Index));
+			}
+			while (!Stack.IsEmpty()) {
+				Consume(Stack.Pop());
+			}
+		});
+		Measure("Stack", "Push+Pop", "std::stack", Count, Count * 2, [&]() {
+			std::stack<int, std::vector<int>> Stack;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Stack.push(static_cast<int>(Index));
+			}
+			while (!Stack.empty()) {
+				Consume(Stack.top());
+				Stack.pop();
+			}
+		});
+	}
+
+
+	// MAP AND SET
+
+	/** Measures inserting, finding, and erasing in maps at the given load factor, which sets each table's initial buckets. */
+	static void MapSuite(const double LoadFactor) {
+		const size_t Count = Scaled(1 << 18);
+		const size_t Buckets = static_cast<size_t>(static_cast<double>(Count) / LoadFactor);
+		const std::vector<int> Keys = UniqueKeys(Count);
+		const std::string Suffix = " (load " + std::to_string(LoadFactor).substr(0, 4) + ")";
+		const std::string Insert = "Insert" + Suffix, Find = "Find" + Suffix, Erase = "Erase" + Suffix;
+		Toolbox::Map<int, int> Map(Buckets);
+		Toolbox::FlatMap<int, int> FlatMap(Buckets, LoadFactor < 1 ? LoadFactor : FLAT_LOAD_FACTOR);
+		Toolbox::Map<int, int, Toolbox::FastHash<int>> FastMap(Buckets);
+		std::unordered_map<int, int> Standard;
+		Measure("Map", Insert.c_str(), "Toolbox::Map", Count, Count, [&]() { Map = Toolbox::Map<int, int>(Buckets); }, [&]() {
+			for (const int Key : Keys) {
+				Map.Insert(Key, Key);
+			}
+		});
+		Measure("Map", Insert.c_str(), "Toolbox::Map+FastHash", Count, Count, [&]() { FastMap = Toolbox::Map<int, int, Toolbox::FastHash<int>>(Buckets); }, [&]() {
+			for (const int Key : Keys) {
+				FastMap.Insert(Key, Key);
+			}
+		});
+		Measure("Map", Insert.c_str(), "Toolbox::FlatMap", Count, Count, [&]() { FlatMap = Toolbox::FlatMap<int, int>(Buckets, LoadFactor < 1 ? LoadFactor : FLAT_LOAD_FACTOR); }, [&]() {
+			for (const int Key : Keys) {
+				FlatMap.Insert(Key, Key);
+			}
+		});
+		Measure("Map", Insert.c_str(), "std::unordered_map", Count, Count, [&]() {
+			Standard = std::unordered_map<int, int>();
+			Standard.max_load_factor(static_cast<float>(LoadFactor));
+			Standard.reserve(Count);
+		}, [&]() {
+			for (const int Key : Keys) {
+				Standard[Key] = Key;
+			}
+		});
+		Measure("Map", Find.c_str(), "Toolbox::Map", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += Map.Find(Key) != nullptr;
+			}
+			Consume(Found);
+		});
+		Measure("Map", Find.c_str(), "Toolbox::Map+FastHash", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += FastMap.Find(Key) != nullptr;
+			}
+			Consume(Found);
+		});
+		Measure("Map", Find.c_str(), "Toolbox::FlatMap", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += FlatMap.Find(Key) != nullptr;
+			}
+			Consume(Found);
+		});
+		Measure("Map", Find.c_str(), "std::unordered_map", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += Standard.find(Key) != Standard.end();
+			}
+			Consume(Found);
+		});
+		Measure("Map", Erase.c_str(), "Toolbox::Map", Count, Count, [&]() {
+			Map = Toolbox::Map<int, int>(Buckets);
+			for (const int Key : Keys) {
+				Map.Insert(Key, Key);
+			}
+		}, [&]() {
+			for (const int Key : Keys) {
+				Map.Erase(Key);
+			}
+		});
+		Measure("Map", Erase.c_str(), "Toolbox::FlatMap", Count, Count, [&]() {
+			FlatMap = Toolbox::FlatMap<int, int>(Buckets, LoadFactor < 1 ? LoadFactor : FLAT_LOAD_FACTOR);
+			for (const int Key : Keys) {
+				FlatMap.Insert(Key, Key);
+			}
+		}, [&]() {
+			for (const int Key : Keys) {
+				FlatMap.Erase(Key);
+			}
+		});
+		Measure("Map", Erase.c_str(), "std::unordered_map", Count, Count, [&]() {
+			Standard = std::unordered_map<int, int>();
+			Standard.max_load_factor(static_cast<float>(LoadFactor));
+			Standard.reserve(Count);
+			for (const int Key : Keys) {
+				Standard[Key] = Key;
+			}
+		}, [&]() {
+			for (const int Key : Keys) {
+				Standard.erase(Key);
+			}
+		});
+	}
+
+	/** Measures inserting, finding, and erasing in sets. */
+	static void SetSuite() {
+		const size_t Count = Scaled(1 << 18);
+		const std::vector<int> Keys = UniqueKeys(Count);
+		Toolbox::Set<int> Set;
+		Toolbox::FlatSet<int> FlatSet;
+		std::unordered_set<int> Standard;
+		Measure("Set", "Insert", "Toolbox::Set", Count, Count, [&]() { Set = Toolbox::Set<int>(); }, [&]() {
+			for (const int Key : Keys) {
+				Set.Insert(Key);
+			}
+		});
+		Measure("Set", "Insert", "Toolbox::FlatSet", Count, Count, [&]() { FlatSet = Toolbox::FlatSet<int>(); }, [&]() {
+			for (const int Key : Keys) {
+				FlatSet.Insert(Key);
+			}
+		});
+		Measure("Set", "Insert", "std::unordered_set", Count, Count, [&]() { Standard = std::unordered_set<int>(); }, [&]() {
+			for (const int Key : Keys) {
+				Standard.insert(Key);
+			}
+		});
+		Measure("Set", "Contains", "Toolbox::Set", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += Set.Contains(Key);
+			}
+			Consume(Found);
+		});
+		Measure("Set", "Contains", "Toolbox::FlatSet", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += FlatSet.Contains(Key);
+			}
+			Consume(Found);
+		});
+		Measure("Set", "Contains", "std::unordered_set", Count, Count, [&]() {
+			size_t Found = 0;
+			for (const int Key : Keys) {
+				Found += Standard.count(Key);
+			}
+			Consume(Found);
+		});
+		Measure("Set", "Erase", "Toolbox::Set", Count, Count, [&]() {
+			for (const int Key : Keys) {
+				Set.Insert(Key);
+			}
+		}, [&]() {
+			for (const int Key : Keys) {
+				Set.Erase(Key);
+			}
+		});
+		Measure("Set", "Erase", "Toolbox::FlatSet", Count, Count, [&]() {
+			for (const int Key : Keys) {
+				FlatSet.Insert(Key);
+			}
+		}, [&]() {
+			for (const int Key : Keys) {
+				FlatSet.Erase(Key);
+			}
+		});
+		Measure("Set", "Erase", "std::unordered_set", Count, Count, [&]() {
+			for (const int Key : Keys) {
+				Standard.insert(Key);
+			}
+		}, [&]() {
+			for (const int Key : Keys) {
+				Standard.erase(Key);
+			}
+		});
+	}
+
+
+	// PRIORITY QUEUE
+
+	/** Measures pushing and popping priority queues, which pop their lowest priority first. */
+	static void PriorityQueueSuite() {
+		const size_t Count = Scaled(1 << 14);
+		const std::vector<int> Priorities = RandomIntegers(Count);
+		Measure("PriorityQueue", "Push+Pop", "Toolbox::PriorityQueue", Count, Count * 2, [&]() {
+			Toolbox::PriorityQueue<int, int> Queue;
+			for (const int Priority : Priorities) {
+				Queue.Push(Priority, Priority);
+			}
+			while (!Queue.IsEmpty()) {
+				Consume(Queue.Pop());
+			}
+		});
+		Measure("PriorityQueue", "Push+Pop", "Toolbox::Heap", Count, Count * 2, [&]() {
+			Toolbox::Heap<int, int> Heap(Count);
+			for (const int Priority : Priorities) {
+				Heap.Push(Priority, Priority);
+			}
+			while (!Heap.IsEmpty()) {
+				Consume(Heap.Pop());
+			}
+		});
+		Measure("PriorityQueue", "Push+Pop", "std::priority_queue", Count, Count * 2, [&]() {
+			std::priority_queue<int, std::vector<int>, std::greater<int>> Queue;
+			for (const int Priority : Priorities) {
+				Queue.push(Priority);
+			}
+			while (!Queue.empty()) {
+				Consume(Queue.top());
+				Queue.pop();
+			}
+		});
+	}
+
+
+	// GRAPH
+
+	/** A cell of a grid graph. */
+	struct Cell final {
+
+		// DATA
+
+		/** The column of this cell. */
+		int X;
+
+		/** The row of this cell. */
+		int Y;
+	};
+
+	/** Returns the Manhattan distance between the given cells, scaled to the cost of one step. */
+	static Toolbox::Heuristic GridHeuristic(const Toolbox::GraphNode<Cell>& Current, const Toolbox::GraphNode<Cell>& End) {
+		return static_cast<Toolbox::Heuristic>((std::abs(Current.Data.X - End.Data.X) + std::abs(Current.Data.Y - End.Data.Y)) * (DEFAULT_WEIGHT * 2));
+	}
+
+	/** A cell waiting in the frontier of a standard library search and the costs it was pushed with. */
+	struct StandardEntry final {
+
+		// DATA
+
+		/** The path cost plus the estimated cost to the goal. */
+		double Estimate;
+
+		/** The path cost from the start to this cell when it was pushed. */
+		size_t Cost;
+
+		/** The index of this cell. */
+		int Index;
+
+
+		// OPERATORS
+
+		/** Returns whether this entry should be popped after the given entry, breaking equal estimates toward the larger path cost. */
+		bool operator>(const StandardEntry& Other) const {
+			return Estimate != Other.Estimate ? Estimate > Other.Estimate : Cost < Other.Cost;
+		}
+	};
+
+	/** Returns the path cost of an A Star Search from the first cell to the last cell of a grid of adjacency lists using the standard library. */
+	static size_t StandardPath(const std::vector<std::vector<int>>& Neighbors, const int Width) {
+		const int Goal = static_cast<int>(Neighbors.size()) - 1;
+		std::vector<size_t> Costs(Neighbors.size(), SIZE_MAX);
+		std::priority_queue<StandardEntry, std::vector<StandardEntry>, std::greater<StandardEntry>> Frontier;
+		Costs[0] = 0;
+		Frontier.push(StandardEntry{ 0, 0, 0 });
+		while (!Frontier.empty()) {
+			const StandardEntry Entry = Frontier.top();
+			Frontier.pop();
+			if (Entry.Cost != Costs[Entry.Index]) {
+				continue;
+			}
+			const int Current = Entry.Index;
+			if (Current == Goal) {
+				break;
+			}
+			for (const int Next : Neighbors[Current]) {
+				const size_t Cost = Entry.Cost + DEFAULT_WEIGHT * 2;
+				if (Cost < Costs[Next]) {
+					Costs[Next] = Cost;
+					const double Estimate = static_cast<double>((Width - 1 - Next % Width) + (Width - 1 - Next / Width)) * (DEFAULT_WEIGHT * 2);
+					Frontier.push(StandardEntry{ static_cast<double>(Cost) + Estimate, Cost, Next });
+				}
+			}
+		}
+		return Costs[Goal];
+	}
+
+
+	/** Measures finding the path between opposite corners of a grid graph. */
+	static void GraphSuite() {
+		const int Width = static_cast<int>(std::sqrt(static_cast<double>(Scaled(1 << 14, 64))));
+		const size_t Count = static_cast<size_t>(Width) * Width;
+		Toolbox::Graph<Cell, GridHeuristic> Graph(Count);
+		std::vector<Toolbox::NodeCode> Codes(Count);
+		std::vector<std::vector<int>> Neighbors(Count);
+		for (int Y = 0; Y < Width; ++Y) {
+			for (int X = 0; X < Width; ++X) {
+				Codes[Y * Width + X] = Graph.Insert(Cell{ X, Y });
+			}
+		}
+		for (int Y = 0; Y < Width; ++Y) {
+			for (int X = 0; X < Width; ++X) {
+				const int Index = Y * Width + X;
+				if (X + 1 < Width) {
+					Graph.Connect(Codes[Index], Codes[Index + 1]);
+					Neighbors[Index].push_back(Index + 1);
+					Neighbors[Index + 1].push_back(Index);
+				}
+				if (Y + 1 < Width) {
+					Graph.Connect(Codes[Index], Codes[Index + Width]);
+					Neighbors[Index].push_back(Index + Width);
+					Neighbors[Index + Width].push_back(Index);
+				}
+			}
+		}
+		const Toolbox::CompactGraph<Cell, GridHeuristic> Compact = Graph.Freeze();
+		Toolbox::SearchContext Context(Count);
+		Measure("Graph", "Pathfind (grid)", "Toolbox::Graph", Count, 1, [&]() {
+			Consume(Graph.BuildPath(Codes.front(), Codes.back()).Size());
+		});
+		Measure("Graph", "Pathfind (grid)", "Toolbox::CompactGraph", Count, 1, [&]() {
+			Consume(Compact.BuildPath(Codes.front(), Codes.back(), Context).Size());
+		});
+		Measure("Graph", "Pathfind (grid)", "std (A* on vectors)", Count, 1, [&]() {
+			Consume(StandardPath(Neighbors, Width));
+		});
+	}
+
+
+	// TREE
+
+	/** Measures inserting, querying, and finding the nearest points of a quadtree next to a linear scan. */
+	static void TreeSuite() {
+		using Quadtree = Toolbox::Quadtree<int>;
+		using Point = Quadtree::Point;
+		const size_t Count = Scaled(1 << 16);
+		const size_t Queries = Scaled(1 << 10);
+		std::mt19937 Random(BENCHMARK_SEED);
+		std::uniform_real_distribution<double> Distribution(-99, 99);
+		std::vector<Point> Points(Count), Targets(Queries);
+		for (auto& Point : Points) {
+			Point = Quadtree::Point({ Distribution(Random), Distribution(Random) });
+		}
+		for (auto& Target : Targets) {
+			Target = Quadtree::Point({ Distribution(Random), Distribution(Random) });
+		}
+		Quadtree Tree;
+		Measure("Tree", "Insert", "Toolbox::Quadtree", Count, Count, [&]() { Tree.Clear(); }, [&]() {
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Tree.Insert(static_cast<int>(Index), Points[Index]);
+			}
+		});
+		Measure("Tree", "Insert", "std::vector", Count, Count, [&]() {
+			std::vector<std::pair<Point, int>> Pairs;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Pairs.emplace_back(Points[Index], static_cast<int>(Index));
+			}
+			Consume(Pairs.size());
+		});
+		std::vector<std::pair<Point, int>> Pairs;
+		for (size_t Index = 0; Index < Count; ++Index) {
+			Pairs.emplace_back(Points[Index], static_cast<int>(Index));
+		}
+		Measure("Tree", "Query (box)", "Toolbox::Quadtree", Count, Queries, [&]() {
+			size_t Found = 0;
+			for (const auto& Target : Targets) {
+				Found += Tree.Query(Quadtree::Box(Target, 2)).Size();
+			}
+			Consume(Found);
+		});
+		Measure("Tree", "Query (box)", "std::vector scan", Count, Queries, [&]() {
+			size_t Found = 0;
+			for (const auto& Target : Targets) {
+				const Quadtree::Box Area(Target, 2);
+				for (const auto& Pair : Pairs) {
+					Found += Area.Contains(Pair.first);
+				}
+			}
+			Consume(Found);
+		});
+		Toolbox::Vector<const Quadtree::Pair*> Nearest;
+		const Quadtree& Constant = Tree;
+		Measure("Tree", "Nearest (8)", "Toolbox::Quadtree", Count, Queries, [&]() {
+			size_t Found = 0;
+			for (const auto& Target : Targets) {
+				Found += Constant.FindNearest(Target, 8, Nearest);
+			}
+			Consume(Found);
+		});
+		std::vector<std::pair<double, int>> Distances(Count);
+		Measure("Tree", "Nearest (8)", "std::nth_element", Count, Queries, [&]() {
+			size_t Found = 0;
+			for (const auto& Target : Targets) {
+				for (size_t Index = 0; Index < Count; ++Index) {
+					const double X = Pairs[Index].first[0] - Target[0], Y = Pairs[Index].first[1] - Target[1];
+					Distances[Index] = std::pair<double, int>(X * X + Y * Y, Pairs[Index].second);
+				}
+				std::nth_element(Distances.begin(), Distances.begin() + 8, Distances.end());
+				Found += 8;
+			}
+			Consume(Found);
+		});
+	}
+
+
+	// STRING
+
+	/** Measures searching and splitting strings. */
+	static void StringSuite() {
+		const size_t Words = Scaled(1 << 16);
+		std::mt19937 Random(BENCHMARK_SEED);
+		std::uniform_int_distribution<int> Letter('a', 'z'), Length(2, 9);
+		std::string Text;
+		for (size_t Word = 0; Word < Words; ++Word) {
+			const int Size = Length(Random);
+			for (int Character = 0; Character < Size; ++Character) {
+				Text += static_cast<char>(Letter(Random));
+			}
+			Text += ' ';
+		}
+		Text += "needle";
+		const Toolbox::String String(Text.c_str());
+		Measure("String", "Find (substring)", "Toolbox::String", Text.size(), Text.size(), [&]() {
+			Consume(String.Find("needle"));
+		});
+		Measure("String", "Find (substring)", "std::string", Text.size(), Text.size(), [&]() {
+			Consume(Text.find("needle"));
+		});
+		Measure("String", "Find (character)", "Toolbox::String", Text.size(), Text.size(), [&]() {
+			Consume(String.Find('#'));
+		});
+		Measure("String", "Find (character)", "std::string", Text.size(), Text.size(), [&]() {
+			Consume(Text.find('#'));
+		});
+		Measure("String", "Split", "Toolbox::String", Text.size(), Words, [&]() {
+			Consume(String.Split(' ').Size());
+		});
+		Measure("String", "Split", "std::string_view", Text.size(), Words, [&]() {
+			std::vector<std::string_view> Tokens;
+			const std::string_view View = Text;
+			size_t Start = 0;
+			for (size_t Index = View.find(' '); Index != std::string_view::npos; Index = View.find(' ', Start)) {
+				Tokens.push_back(View.substr(Start, Index - Start));
+				Start = Index + 1;
+			}
+			Tokens.push_back(View.substr(Start));
+			Consume(Tokens.size());
+		});
+	}
+
+
+	// SHARED
+
+	/** Measures copying and destroying shared pointers. */
+	static void SharedSuite() {
+		const size_t Count = Scaled(1 << 20);
+		const Toolbox::Shared<int> Shared = Toolbox::MakeShared<int>(1);
+		const Toolbox::AtomicShared<int> Atomic = Toolbox::MakeAtomicShared<int>(1);
+		const std::shared_ptr<int> Standard = std::make_shared<int>(1);
+		Measure("Shared", "Copy", "Toolbox::Shared", Count, Count, [&]() {
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Toolbox::Shared<int> Copy = Shared;
+				Consume(Copy);
+			}
+		});
+		Measure("Shared", "Copy", "Toolbox::AtomicShared", Count, Count, [&]() {
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Toolbox::AtomicShared<int> Copy = Atomic;
+				Consume(Copy);
+			}
+		});
+		Measure("Shared", "Copy", "std::shared_ptr", Count, Count, [&]() {
+			for (size_t Index = 0; Index < Count; ++Index) {
+				std::shared_ptr<int> Copy = Standard;
+				Consume(Copy);
+			}
+		});
+	}
+
+
+	// OUTPUT
+
+	/** Returns the given text with quotes and backslashes escaped for JSON. */
+	static std::string Escape(const std::string& Text) {
+		std::string Escaped;
+		for (const char Character : Text) {
+			if (Character == '"' || Character == '\\') {
+				Escaped += '\\';
+			}
+			Escaped += Character;
+		}
+		return Escaped;
+	}
+
+	/** Writes each result to the given path as JSON. */
+	static void WriteJson(const std::string& Path) {
+		std::ofstream File(Path);
+		File << "{\n\t\"repeat\": " << Options.Repeat << ",\n\t\"scale\": " << Options.Scale << ",\n\t\"results\": [";
+		for (size_t Index = 0; Index < Results.size(); ++Index) {
+			const Result& Result = Results[Index];
+			File << (Index > 0 ? "," : "") << "\n\t\t{ \"suite\": \"" << Escape(Result.Suite) << "\", \"case\": \"" << Escape(Result.Case) << "\", \"library\": \"" << Escape(Result.Library)
+				<< "\", \"size\": " << Result.Size << ", \"operations\": " << Result.Operations << ", \"best_ns\": " << Result.Best << ", \"median_ns\": " << Result.Median << " }";
+		}
+		File << "\n\t]\n}\n";
+	}
+
+	/** Writes each result to the given path as comma separated values. */
+	static void WriteCsv(const std::string& Path) {
+		std::ofstream File(Path);
+		File << "suite,case,library,size,operations,best_ns,median_ns\n";
+		for (const Result& Result : Results) {
+			File << '"' << Result.Suite << "\",\"" << Result.Case << "\",\"" << Result.Library << "\"," << Result.Size << ',' << Result.Operations << ',' << Result.Best << ',' << Result.Median << '\n';
+		}
+	}
+}
+
+
+// MAIN
+
+/**
+ * Runs each benchmark and prints the nanoseconds per operation of its fastest and median runs.<br/>
+ * Usage: Benchmarks [--filter Suite] [--scale Factor] [--repeat Count] [--json Path] [--csv Path]
+ */
+int main(const int Count, const char* Arguments[]) {
+	using namespace Benchmarks;
+	for (int Index = 1; Index < Count; ++Index) {
+		const std::string Argument = Arguments[Index];
+		const char* Value = Index + 1 < Count ? Arguments[Index + 1] : nullptr;
+		if (Value == nullptr) {
+			std::fprintf(stderr, "ERROR: Missing a value for %s!\n", Argument.c_str());
+			return 1;
+		}
+		if (Argument == "--filter") {
+			Options.Filter = Value;
+		}
+		else if (Argument == "--scale") {
+			Options.Scale = std::atof(Value);
+		}
+		else if (Argument == "--repeat") {
+			Options.Repeat = static_cast<size_t>(std::atoi(Value) > 0 ? std::atoi(Value) : 1);
+		}
+		else if (Argument == "--json") {
+			Options.Json = Value;
+		}
+		else if (Argument == "--csv") {
+			Options.Csv = Value;
+		}
+		else {
+			std::fprintf(stderr, "ERROR: Unknown argument %s!\n", Argument.c_str());
+			return 1;
+		}
+		++Index;
+	}
+	std::printf("%-14s %-28s %-22s %10s %12s %12s\n", "SUITE", "CASE", "LIBRARY", "SIZE", "BEST NS/OP", "MEDIAN NS/OP");
+	if (Enabled("Vector")) {
+		VectorSuite();
+	}
+	if (Enabled("List") || Enabled("Queue") || Enabled("Stack")) {
+		SequenceSuite();
+	}
+	if (Enabled("Map")) {
+		MapSuite(0.5);
+		MapSuite(1);
+		MapSuite(4);
+	}
+	if (Enabled("Set")) {
+		SetSuite();
+	}
+	if (Enabled("PriorityQueue")) {
+		PriorityQueueSuite();
+	}
+	if (Enabled("Graph")) {
+		GraphSuite();
+	}
+	if (Enabled("Tree")) {
+		TreeSuite();
+	}
+	if (Enabled("String")) {
+		StringSuite();
+	}
+	if (Enabled("Shared")) {
+		SharedSuite();
+	}
+	if (!Options.Json.empty()) {
+		WriteJson(Options.Json);
+	}
+	if (!Options.Csv.empty()) {
+		WriteCsv(Options.Csv);
+	}
+	return 0;
+}
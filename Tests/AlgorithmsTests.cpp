@@ -0,0 +1,81 @@
+// .cpp
+// Algorithm Tests
+// by Kyle Furey
+
+#include <string>
+#include "Toolbox/Algorithms.h"
+#include "Toolbox/List.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of elements each test sorts or reduces.
+#define ALGORITHMS_TEST_COUNT 1000
+
+// The number of elements in each chunk of a parallel test.
+#define ALGORITHMS_TEST_GRAIN 16
+
+/** A number that can only be constructed from a value. */
+struct Number final {
+
+	/** The value of this number. */
+	int Value;
+
+
+	// CONSTRUCTOR
+
+	/** Value constructor. */
+	explicit Number(const int Value) : Value(Value) {
+	}
+};
+
+
+// TESTS
+
+/** Lists of elements that are not default constructible are sorted through a temporary vector. */
+static void SortsNonContiguousCollections() {
+	List<Number> Numbers;
+	for (int Index = 0; Index < ALGORITHMS_TEST_COUNT; ++Index) {
+		Numbers.PushBack(Number((Index * 7919) % ALGORITHMS_TEST_COUNT));
+	}
+	Algorithms::Sort(Numbers, [](const Number& Left, const Number& Right) { return Left.Value > Right.Value; });
+	int Expected = 0;
+	for (const Number& Sorted : Numbers) {
+		CHECK(Sorted.Value == Expected);
+		++Expected;
+	}
+	CHECK(Expected == ALGORITHMS_TEST_COUNT);
+}
+
+/** Parallel reductions accumulate into a type other than the element type and combine each chunk's result with the combiner. */
+static void ReducesIntoOtherTypes() {
+	ThreadPool Pool(4);
+	const Algorithms::ParallelPolicy Policy(&Pool, ALGORITHMS_TEST_GRAIN);
+	Vector<Number> Numbers;
+	for (int Index = 0; Index < ALGORITHMS_TEST_COUNT; ++Index) {
+		Numbers.PushBack(Number(Index));
+	}
+	const size_t Evens = Algorithms::Reduce(Policy, Numbers, size_t(0),
+		[](size_t& Count, const Number& Element) { Count += Element.Value % 2 == 0 ? 1 : 0; },
+		[](const size_t Left, const size_t Right) { return Left + Right; });
+	CHECK(Evens == ALGORITHMS_TEST_COUNT / 2);
+	const std::string Digits = Algorithms::Reduce(Policy, Numbers, std::string(),
+		[](std::string& String, const Number& Element) { String += static_cast<char>('0' + Element.Value % 10); },
+		[](std::string& Left, const std::string& Right) { Left += Right; });
+	CHECK(Digits.size() == ALGORITHMS_TEST_COUNT);
+	for (size_t Index = 0; Index < Digits.size(); ++Index) {
+		CHECK(Digits[Index] == static_cast<char>('0' + Index % 10));
+	}
+	Vector<int> Values(ALGORITHMS_TEST_COUNT, 1);
+	CHECK(Algorithms::Reduce(Policy, Values, 0, [](const int Left, const int Right) { return Left + Right; }) == ALGORITHMS_TEST_COUNT);
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "SortsNonContiguousCollections", SortsNonContiguousCollections },
+		{ "ReducesIntoOtherTypes", ReducesIntoOtherTypes },
+	});
+}
@@ -0,0 +1,103 @@
+// .cpp
+// Concurrent Hash Map and Set Tests
+// by Kyle Furey
+
+#include <thread>
+#include "Toolbox/ConcurrentMap.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of threads that write to each table at once.
+#define CONCURRENT_TEST_WRITERS 8
+
+// The number of keys each writer inserts, which grows every shard of a table many times over.
+#define CONCURRENT_TEST_KEYS 8192
+
+
+// HELPERS
+
+/** Runs the given function on each of the writer threads at once, passing each its index, and waits for them all. */
+template<typename FunctionType>
+static void RunWriters(FunctionType Function) {
+	Vector<std::thread> Writers;
+	for (size_t Writer = 0; Writer < CONCURRENT_TEST_WRITERS; ++Writer) {
+		Writers.PushBack(std::thread(Function, Writer));
+	}
+	for (std::thread& Writer : Writers) {
+		Writer.join();
+	}
+}
+
+
+// TESTS
+
+/** Pairs inserted, found, updated, and erased by many threads at once while every shard grows are all kept. */
+static void MapKeepsPairsWhileGrowing() {
+	ConcurrentMap<size_t, size_t> Pairs(1);
+	Atomic<size_t> Lost(0);
+	RunWriters([&](const size_t Writer) {
+		const size_t First = Writer * CONCURRENT_TEST_KEYS;
+		for (size_t Key = First; Key < First + CONCURRENT_TEST_KEYS; ++Key) {
+			size_t Value = 0;
+			if (!Pairs.Insert(Key, Key) || !Pairs.Find(Key, Value) || Value != Key) {
+				Lost.fetch_add(1);
+			}
+			const size_t Earlier = First + (Key - First) / 2;
+			if (!Pairs.Update(Earlier, [](size_t& Updated) { ++Updated; })) {
+				Lost.fetch_add(1);
+			}
+		}
+		for (size_t Key = First; Key < First + CONCURRENT_TEST_KEYS; Key += 2) {
+			if (!Pairs.Erase(Key) || Pairs.ContainsKey(Key)) {
+				Lost.fetch_add(1);
+			}
+		}
+	});
+	CHECK(Lost.load() == 0);
+	CHECK(Pairs.Size() == CONCURRENT_TEST_WRITERS * CONCURRENT_TEST_KEYS / 2);
+	size_t Updates = 0;
+	size_t Visited = 0;
+	Pairs.ForEach([&](const size_t& Key, const size_t& Value) {
+		CHECK(Key % 2 == 1 && Value >= Key);
+		Updates += Value - Key;
+		++Visited;
+	});
+	CHECK(Visited == Pairs.Size());
+	CHECK(Updates == CONCURRENT_TEST_WRITERS * CONCURRENT_TEST_KEYS / 2);
+}
+
+/** Values inserted and erased by many threads at once while every shard grows are all kept. */
+static void SetKeepsValuesWhileGrowing() {
+	ConcurrentSet<size_t> Values(1);
+	Atomic<size_t> Lost(0);
+	RunWriters([&](const size_t Writer) {
+		for (size_t Value = Writer; Value < CONCURRENT_TEST_WRITERS * CONCURRENT_TEST_KEYS; Value += CONCURRENT_TEST_WRITERS) {
+			if (!Values.Insert(Value) || Values.Insert(Value) || !Values.Contains(Value)) {
+				Lost.fetch_add(1);
+			}
+			if (Value % 3 == 0 && !Values.Erase(Value)) {
+				Lost.fetch_add(1);
+			}
+		}
+	});
+	CHECK(Lost.load() == 0);
+	size_t Expected = 0;
+	for (size_t Value = 0; Value < CONCURRENT_TEST_WRITERS * CONCURRENT_TEST_KEYS; ++Value) {
+		if (Value % 3 != 0) {
+			CHECK(Values.Contains(Value));
+			++Expected;
+		}
+	}
+	CHECK(Values.Size() == Expected);
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "MapKeepsPairsWhileGrowing", MapKeepsPairsWhileGrowing },
+		{ "SetKeepsValuesWhileGrowing", SetKeepsValuesWhileGrowing },
+	});
+}
@@ -0,0 +1,117 @@
+// .cpp
+// Coroutine Tests
+// by Kyle Furey
+
+#include "Toolbox/Coroutine.h"
+#include "Toolbox/ThreadPool.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of values each contended async generator yields.
+#define COROUTINE_TEST_VALUES 2000
+
+
+// COROUTINES
+
+/** Yields each number up to the given count, hopping onto a worker of the given pool before each value. */
+static Async<int> HoppingCounter(ThreadPool& Pool, const int Count) {
+	for (int Index = 0; Index < Count; ++Index) {
+		Task<void> Hop;
+		Pool.Run([&Hop]() { Hop.Finish(); });
+		co_await Hop;
+		co_yield Index;
+	}
+	co_return Count;
+}
+
+/** Yields each number up to the given count without suspending on another thread. */
+static Async<int> Counter(const int Count) {
+	for (int Index = 0; Index < Count; ++Index) {
+		co_yield Index;
+	}
+	co_return Count;
+}
+
+/** Awaits the given task and then stores the given value. */
+static Async<void> AwaitTask(Task<int>& Awaited, int& Result) {
+	Result = co_await Awaited;
+}
+
+
+// TESTS
+
+/** Next waits for each value even when the coroutine yields it from another thread. */
+static void NextAcrossThreads() {
+	ThreadPool Pool(4);
+	Async<int> Generator = HoppingCounter(Pool, COROUTINE_TEST_VALUES);
+	CHECK(Generator.WaitFor(10000));
+	CHECK(Generator.Get() == 0);
+	for (int Index = 1; Index < COROUTINE_TEST_VALUES; ++Index) {
+		CHECK(Generator.Next() == Index);
+	}
+	CHECK(Generator.Next() == COROUTINE_TEST_VALUES);
+	CHECK(Generator.IsComplete());
+}
+
+/** Next returns each value in order when the coroutine runs on the calling thread. */
+static void NextInOrder() {
+	Async<int> Generator = Counter(3);
+	CHECK(Generator.WaitFor(0));
+	CHECK(Generator.Get() == 0);
+	CHECK(Generator.Next() == 1);
+	CHECK(Generator.Next() == 2);
+	CHECK(Generator.Next() == 3);
+	CHECK(Generator.IsComplete());
+	bool Threw = false;
+	try {
+		Generator.Next();
+	}
+	catch (const std::runtime_error&) {
+		Threw = true;
+	}
+	CHECK(Threw);
+}
+
+/** A task awaited without a scheduler is resumed by the thread that finishes it. */
+static void TaskResumedByFinish() {
+	Task<int> Awaited;
+	int Result = 0;
+	Async<void> Awaiting = AwaitTask(Awaited, Result);
+	CHECK(!Awaiting.IsComplete());
+	Thread Finisher([&Awaited](Thread&) {
+		Awaited.Finish(7);
+		return 0;
+	});
+	Finisher.Join();
+	CHECK(Result == 7);
+	CHECK(Awaiting.IsComplete());
+}
+
+/** A thread started by a timed out join is still joined by its destructor. */
+static void JoinForKeepsThreadJoinable() {
+	Signal Release;
+	Atomic<bool> Finished(false);
+	{
+		Thread Worker([&Release, &Finished](Thread&) {
+			Release.Wait();
+			Finished.store(true);
+			return 0;
+		});
+		CHECK(!Worker.JoinFor(1));
+		Release.Set();
+	}
+	CHECK(Finished.load());
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "NextAcrossThreads", NextAcrossThreads },
+		{ "NextInOrder", NextInOrder },
+		{ "TaskResumedByFinish", TaskResumedByFinish },
+		{ "JoinForKeepsThreadJoinable", JoinForKeepsThreadJoinable },
+	});
+}
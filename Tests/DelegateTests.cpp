@@ -0,0 +1,78 @@
+// .cpp
+// Delegate Tests
+// by Kyle Furey
+
+#include <string>
+#include "Toolbox/Delegate.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+
+// FUNCTIONS
+
+/** The number of times Count() was called. */
+static int Counted = 0;
+
+/** Counts a call. */
+static void Count(int) {
+	++Counted;
+}
+
+
+// TESTS
+
+/** Every binding but the last receives a copy of an rvalue argument, so each binding sees the original value. */
+static void InvokeMovesIntoLastBindingOnly() {
+	Delegate<void, std::string&&> Moved;
+	std::string Seen[3];
+	for (std::string& Slot : Seen) {
+		Moved.Bind([&Slot](std::string&& Value) { Slot = std::move(Value); });
+	}
+	Moved.Invoke(std::string("A string long enough to be allocated on the heap"));
+	for (const std::string& Slot : Seen) {
+		CHECK(Slot == "A string long enough to be allocated on the heap");
+	}
+}
+
+/** A literal 0 is treated as a handle rather than a null function. */
+static void UnbindZeroUsesHandle() {
+	Delegate<void, int> Counter;
+	const Delegate<void, int>::Handle First = Counter.Bind(Count);
+	CHECK(First == 0);
+	CHECK(Counter.IsBound(0));
+	CHECK(Counter.IsBound(Count));
+	CHECK(Counter.Unbind(0));
+	CHECK(!Counter.IsBound(0));
+	CHECK(!Counter.IsBound(Count));
+	CHECK(!Counter.Unbind(Count));
+}
+
+/** Copied callables and delegates invoke their own copies of each function object. */
+static void CopiesFunctionObjects() {
+	Counted = 0;
+	std::string Captured(64, 'x');
+	Delegate<void, int> Original;
+	Original.Bind([Captured](int Value) { Counted += Value + static_cast<int>(Captured.size()); });
+	Original.Bind(Count);
+	Delegate<void, int> Copy = Original;
+	Original.UnbindAll();
+	Copy.Invoke(1);
+	CHECK(Counted == 66);
+	Delegate<void, int>::CallableType Callable(Count);
+	Delegate<void, int>::CallableType Copied = Callable;
+	int Argument = 0;
+	Copied.Invoke(Argument);
+	CHECK(Counted == 67);
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "InvokeMovesIntoLastBindingOnly", InvokeMovesIntoLastBindingOnly },
+		{ "UnbindZeroUsesHandle", UnbindZeroUsesHandle },
+		{ "CopiesFunctionObjects", CopiesFunctionObjects },
+	});
+}
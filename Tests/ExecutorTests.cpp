@@ -0,0 +1,100 @@
+// .cpp
+// Executor Tests
+// by Kyle Furey
+
+#include "Toolbox/Executor.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of coroutines each test spawns.
+#define EXECUTOR_TEST_COROUTINES 256
+
+
+// COROUTINES
+
+/** Counts its own destruction in the given count. */
+struct Tracked final {
+
+	/** The count of destroyed tracked objects. */
+	Atomic<size_t>& Destroyed;
+
+	/** Destructor that counts this object as destroyed. */
+	~Tracked() {
+		Destroyed.fetch_add(1);
+	}
+};
+
+/** Waits for the given number of milliseconds while holding an object that counts its destruction. */
+static Async<void> Sleeper(Atomic<size_t>& Destroyed, const size_t Milliseconds) {
+	Tracked Object{ Destroyed };
+	co_await Delay(Milliseconds);
+}
+
+/** Awaits the given task and then counts itself as finished. */
+static Async<void> Awaiter(Task<void>& Awaited, Atomic<size_t>& Finished) {
+	co_await Awaited;
+	Finished.fetch_add(1);
+}
+
+
+// TESTS
+
+/** Spawned coroutines still parked when the executor is destroyed are destroyed with it. */
+static void DestroysParkedCoroutines() {
+	Atomic<size_t> Destroyed(0);
+	{
+		Executor Executor;
+		for (size_t Index = 0; Index < EXECUTOR_TEST_COROUTINES; ++Index) {
+			Executor.Spawn([&Destroyed]() { return Sleeper(Destroyed, 60000); });
+		}
+		CHECK(Executor.Live() == EXECUTOR_TEST_COROUTINES);
+		CHECK(Executor.Timers() == EXECUTOR_TEST_COROUTINES);
+		CHECK(Destroyed.load() == 0);
+	}
+	CHECK(Destroyed.load() == EXECUTOR_TEST_COROUTINES);
+}
+
+/** Spawned coroutines that finish are destroyed once each. */
+static void RunsToCompletion() {
+	Atomic<size_t> Destroyed(0);
+	{
+		Executor Executor;
+		for (size_t Index = 0; Index < EXECUTOR_TEST_COROUTINES; ++Index) {
+			Executor.Spawn([&Destroyed, Index]() { return Sleeper(Destroyed, Index % 4); });
+		}
+		Executor.Run();
+		CHECK(Executor.Live() == 0);
+		CHECK(Destroyed.load() == EXECUTOR_TEST_COROUTINES);
+	}
+	CHECK(Destroyed.load() == EXECUTOR_TEST_COROUTINES);
+}
+
+/** The destructor of an executor with a thread pool waits for every coroutine resumed on the pool to return. */
+static void WaitsForThreadPool() {
+	ThreadPool Pool(4);
+	Task<void> Tasks[EXECUTOR_TEST_COROUTINES];
+	Atomic<size_t> Finished(0);
+	{
+		Executor Executor(&Pool);
+		CHECK(Executor.Workers() == &Pool);
+		for (size_t Index = 0; Index < EXECUTOR_TEST_COROUTINES; ++Index) {
+			Executor.Spawn([&Tasks, &Finished, Index]() { return Awaiter(Tasks[Index], Finished); });
+		}
+		for (Task<void>& Task : Tasks) {
+			Task.Finish();
+		}
+	}
+	CHECK(Finished.load() == EXECUTOR_TEST_COROUTINES);
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "DestroysParkedCoroutines", DestroysParkedCoroutines },
+		{ "RunsToCompletion", RunsToCompletion },
+		{ "WaitsForThreadPool", WaitsForThreadPool },
+	});
+}
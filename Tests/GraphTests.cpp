@@ -0,0 +1,153 @@
+// .cpp
+// Graph Tests
+// by Kyle Furey
+
+#include "Toolbox/Graph.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of columns of each test grid, which is wide enough for every row to be searched in parallel.
+#define GRAPH_TEST_WIDTH 2048
+
+// The number of rows of each test grid.
+#define GRAPH_TEST_HEIGHT 16
+
+// The number of threads outside of the pool that search at once.
+#define GRAPH_TEST_CALLERS 4
+
+/** A cell of a test grid. */
+struct Cell final {
+
+	/** The column of this cell. */
+	int X;
+
+	/** The row of this cell. */
+	int Y;
+};
+
+
+// GRID
+
+/** Returns a frozen grid with each cell connected to its neighbors, appending the codes of its first row to the given vector. */
+static CompactGraph<Cell> BuildGrid(Vector<NodeCode>& FirstRow) {
+	Graph<Cell> Grid(GRAPH_TEST_WIDTH * GRAPH_TEST_HEIGHT);
+	Vector<NodeCode> Codes;
+	for (int Y = 0; Y < GRAPH_TEST_HEIGHT; ++Y) {
+		for (int X = 0; X < GRAPH_TEST_WIDTH; ++X) {
+			Codes.PushBack(Grid.Insert(Cell{ X, Y }));
+		}
+	}
+	for (int Y = 0; Y < GRAPH_TEST_HEIGHT; ++Y) {
+		for (int X = 0; X < GRAPH_TEST_WIDTH; ++X) {
+			const size_t Index = static_cast<size_t>(Y) * GRAPH_TEST_WIDTH + X;
+			if (X + 1 < GRAPH_TEST_WIDTH) {
+				Grid.Connect(Codes[Index], Codes[Index + 1]);
+			}
+			if (Y + 1 < GRAPH_TEST_HEIGHT) {
+				Grid.Connect(Codes[Index], Codes[Index + GRAPH_TEST_WIDTH]);
+			}
+		}
+	}
+	for (int X = 0; X < GRAPH_TEST_WIDTH; ++X) {
+		FirstRow.PushBack(Codes[X]);
+	}
+	return Grid.Freeze();
+}
+
+/** Returns whether the given context's last search reached every cell of the given grid in as many connections as its row. */
+static bool IsRowOrdered(const CompactGraph<Cell>& Grid, const SearchContext& Context) {
+	if (Context.Reached().Size() != Grid.Size()) {
+		return false;
+	}
+	for (NodeIndex Index = 0; Index < Grid.Size(); ++Index) {
+		if (Context.Cost(Index) != static_cast<NodeWeight>(Grid.At(Index).Data.Y)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// TESTS
+
+/** A parallel breadth first search from the pool's own caller reaches every cell once. */
+static void ParallelBreadthFirstFromCaller() {
+	ThreadPool Pool(4);
+	Vector<NodeCode> FirstRow;
+	const CompactGraph<Cell> Grid = BuildGrid(FirstRow);
+	SearchContext Context;
+	CHECK(Grid.ParallelBreadthFirst(FirstRow, Context, Pool) == Grid.Size());
+	CHECK(IsRowOrdered(Grid, Context));
+}
+
+/** Parallel breadth first searches started at once from threads outside of the pool each reach every cell once. */
+static void ParallelBreadthFirstFromNonWorkers() {
+	ThreadPool Pool(2);
+	Vector<NodeCode> FirstRow;
+	const CompactGraph<Cell> Grid = BuildGrid(FirstRow);
+	Atomic<size_t> Ordered(0);
+	{
+		Vector<std::thread> Callers;
+		for (size_t Caller = 0; Caller < GRAPH_TEST_CALLERS; ++Caller) {
+			Callers.PushBack(std::thread([&]() {
+				SearchContext Context;
+				for (int Round = 0; Round < 8; ++Round) {
+					Grid.ParallelBreadthFirst(FirstRow, Context, Pool);
+					if (IsRowOrdered(Grid, Context)) {
+						Ordered.fetch_add(1);
+					}
+				}
+			}));
+		}
+		for (std::thread& Caller : Callers) {
+			Caller.join();
+		}
+	}
+	CHECK(Ordered.load() == GRAPH_TEST_CALLERS * 8);
+}
+
+/** Paths built at once from threads outside of the pool match the paths built by a single search context. */
+static void BuildPathsFromNonWorkers() {
+	ThreadPool Pool(2);
+	Vector<NodeCode> FirstRow;
+	const CompactGraph<Cell> Grid = BuildGrid(FirstRow);
+	Vector<PathQuery> Queries;
+	for (size_t Query = 0; Query < 256; ++Query) {
+		Queries.PushBack(PathQuery(Grid.CodeOf(Query * 7 % Grid.Size()), Grid.CodeOf((Query * 131 + 17) % Grid.Size())));
+	}
+	SearchContext Context;
+	Vector<size_t> Expected;
+	for (const PathQuery& Query : Queries) {
+		Expected.PushBack(Grid.BuildPath(Query.Start, Query.End, Context).Size());
+	}
+	Atomic<size_t> Matched(0);
+	{
+		Vector<std::thread> Callers;
+		for (size_t Caller = 0; Caller < GRAPH_TEST_CALLERS; ++Caller) {
+			Callers.PushBack(std::thread([&]() {
+				const Vector<Stack<NodeCode>> Paths = Grid.BuildPaths(Queries, Pool);
+				for (size_t Query = 0; Query < Queries.Size(); ++Query) {
+					if (Paths[Query].Size() == Expected[Query]) {
+						Matched.fetch_add(1);
+					}
+				}
+			}));
+		}
+		for (std::thread& Caller : Callers) {
+			Caller.join();
+		}
+	}
+	CHECK(Matched.load() == GRAPH_TEST_CALLERS * Queries.Size());
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "ParallelBreadthFirstFromCaller", ParallelBreadthFirstFromCaller },
+		{ "ParallelBreadthFirstFromNonWorkers", ParallelBreadthFirstFromNonWorkers },
+		{ "BuildPathsFromNonWorkers", BuildPathsFromNonWorkers },
+	});
+}
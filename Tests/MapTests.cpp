@@ -0,0 +1,141 @@
+// .cpp
+// Hash Map and Set Tests
+// by Kyle Furey
+
+#include "Toolbox/Map.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of buckets of each sparse test table.
+#define MAP_TEST_BUCKETS 1024
+
+// The number of elements each test inserts.
+#define MAP_TEST_COUNT 4096
+
+
+// ALLOCATOR
+
+/** A heap allocator that counts its live allocations. */
+struct CountingAllocator final {
+
+	/** The number of allocations that have not been deallocated yet. */
+	static inline size_t Live = 0;
+
+	/** Returns uninitialized memory of the given size and alignment and counts it. */
+	static void* Allocate(const size_t Size, const size_t Alignment) {
+		++Live;
+		return HeapAllocator::Allocate(Size, Alignment);
+	}
+
+	/** Returns the given memory to the system and stops counting it. */
+	static void Deallocate(void* Memory, const size_t Size, const size_t Alignment) {
+		--Live;
+		HeapAllocator::Deallocate(Memory, Size, Alignment);
+	}
+
+	/** Returns true since every counting allocator can free the memory of another. */
+	bool operator==(const CountingAllocator&) const {
+		return true;
+	}
+
+	/** Returns false since every counting allocator can free the memory of another. */
+	bool operator!=(const CountingAllocator&) const {
+		return false;
+	}
+};
+
+
+// TESTS
+
+/** Every bucket of a map shares one pool, so an empty sparse map only allocates its bucket array. */
+static void BucketsSharePool() {
+	CountingAllocator::Live = 0;
+	{
+		Map<int, int, Hashify, CountingAllocator> Sparse(MAP_TEST_BUCKETS);
+		CHECK(CountingAllocator::Live == 1);
+		for (int Index = 0; Index < MAP_TEST_BUCKETS; Index += MAP_TEST_BUCKETS / 4) {
+			Sparse.Insert(Index, Index);
+		}
+		CHECK(Sparse.Buckets() == MAP_TEST_BUCKETS);
+		CHECK(CountingAllocator::Live == 2);
+		Set<int, Hashify, CountingAllocator> Values(MAP_TEST_BUCKETS);
+		for (int Index = 0; Index < MAP_TEST_BUCKETS; Index += MAP_TEST_BUCKETS / 4) {
+			Values.Insert(Index);
+		}
+		CHECK(CountingAllocator::Live == 4);
+	}
+	CHECK(CountingAllocator::Live == 0);
+}
+
+/** Tables grow by their load rather than their longest bucket, so a well mixed hash does not inflate their bucket count. */
+static void GrowsByLoad() {
+	Map<int, int, FastHash<int>> Pairs;
+	Set<int, FastHash<int>> Values;
+	for (int Index = 0; Index < MAP_TEST_COUNT; ++Index) {
+		Pairs.Insert(Index, Index);
+		Values.Insert(Index);
+	}
+	CHECK(Pairs.Size() <= Pairs.Buckets() * REHASH_MAX_LOAD && Pairs.Buckets() <= MAP_TEST_COUNT * 2);
+	CHECK(Values.Size() <= Values.Buckets() * REHASH_MAX_LOAD && Values.Buckets() <= MAP_TEST_COUNT * 2);
+}
+
+/** Pairs survive rehashing, erasing, copying, and moving. */
+static void MapKeepsPairs() {
+	Map<int, int> Original(1);
+	for (int Index = 0; Index < MAP_TEST_COUNT; ++Index) {
+		Original.Insert(Index, Index * 2);
+	}
+	for (int Index = 0; Index < MAP_TEST_COUNT; Index += 2) {
+		CHECK(Original.Erase(Index));
+	}
+	CHECK(!Original.Erase(0));
+	CHECK(Original.Size() == MAP_TEST_COUNT / 2);
+	Map<int, int> Copy = Original;
+	Original.Clear();
+	CHECK(Original.IsEmpty() && Original.Find(1) == nullptr);
+	Map<int, int> Moved = std::move(Copy);
+	CHECK(Copy.IsEmpty());
+	Moved.Rehash(7);
+	CHECK(Moved.Size() == MAP_TEST_COUNT / 2);
+	for (int Index = 0; Index < MAP_TEST_COUNT; ++Index) {
+		const int* Value = Moved.Find(Index);
+		CHECK(Index % 2 == 0 ? Value == nullptr : Value != nullptr && *Value == Index * 2);
+	}
+	Original = Moved;
+	Moved = Map<int, int>();
+	CHECK(Original.Size() == MAP_TEST_COUNT / 2 && Moved.IsEmpty());
+	CHECK(Original.Statistics().Size == MAP_TEST_COUNT / 2);
+}
+
+/** Values survive rehashing, erasing, copying, and moving. */
+static void SetKeepsValues() {
+	Set<int> Original(1);
+	for (int Index = 0; Index < MAP_TEST_COUNT; ++Index) {
+		CHECK(Original.Insert(Index));
+	}
+	CHECK(!Original.Insert(0));
+	for (int Index = 1; Index < MAP_TEST_COUNT; Index += 2) {
+		CHECK(Original.Erase(Index));
+	}
+	Set<int> Copy = Original;
+	Set<int> Moved = std::move(Original);
+	Moved.Rehash(3);
+	CHECK(Copy.Size() == MAP_TEST_COUNT / 2 && Moved.Size() == MAP_TEST_COUNT / 2);
+	for (int Index = 0; Index < MAP_TEST_COUNT; ++Index) {
+		CHECK(Copy.Contains(Index) == (Index % 2 == 0));
+		CHECK(Moved.Contains(Index) == (Index % 2 == 0));
+	}
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "BucketsSharePool", BucketsSharePool },
+		{ "GrowsByLoad", GrowsByLoad },
+		{ "MapKeepsPairs", MapKeepsPairs },
+		{ "SetKeepsValues", SetKeepsValues },
+	});
+}
@@ -0,0 +1,220 @@
+// .cpp
+// Serialization Tests
+// by Kyle Furey
+
+#include <sstream>
+#include <string>
+#include "Toolbox/Serialization.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// A section count far larger than any test snapshot could hold.
+#define SERIALIZATION_TEST_CORRUPT_COUNT (SIZE_MAX / 4)
+
+// The number of elements in each round tripped collection.
+#define SERIALIZATION_TEST_COUNT 500
+
+
+// HELPERS
+
+/** Returns a snapshot of the given value. */
+template<typename Type>
+static std::string Snapshot(const Type& Value) {
+	std::ostringstream Stream;
+	{
+		Writer Writer(Stream);
+		Serialize(Writer, Value);
+	}
+	return Stream.str();
+}
+
+/** Returns a copy of the given snapshot in memory aligned for any of its arrays. */
+static Vector<uint64_t> Aligned(const std::string& Snapshot) {
+	Vector<uint64_t> Buffer((Snapshot.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+	std::memcpy(Buffer.begin(), Snapshot.data(), Snapshot.size());
+	return Buffer;
+}
+
+/** Reads the given snapshot into the given value and returns whether the whole snapshot was read. */
+template<typename Type>
+static bool Restore(const std::string& Snapshot, Type& Value) {
+	const Vector<uint64_t> Buffer = Aligned(Snapshot);
+	Reader Reader(Buffer.begin(), Snapshot.size());
+	Deserialize(Reader, Value);
+	return Reader.Remaining() == 0;
+}
+
+/** Returns whether the given vectors hold equal elements in the same order. */
+template<typename Type>
+static bool SameElements(const Vector<Type>& Left, const Vector<Type>& Right) {
+	if (Left.Size() != Right.Size()) {
+		return false;
+	}
+	for (size_t Index = 0; Index < Left.Size(); ++Index) {
+		if (!(Left[Index] == Right[Index])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/** Returns whether reading the given snapshot into the given value throws because it reads past the end of the snapshot. */
+template<typename Type>
+static bool Rejects(const std::string& Snapshot, Type& Value) {
+	const Vector<uint64_t> Buffer = Aligned(Snapshot);
+	try {
+		Reader Reader(Buffer.begin(), Snapshot.size());
+		Deserialize(Reader, Value);
+	}
+	catch (const std::runtime_error& Error) {
+		return std::string(Error.what()) == "ERROR: Reading past the end of a snapshot!";
+	}
+	catch (...) {
+	}
+	return false;
+}
+
+
+// TESTS
+
+/** Vectors, strings, sets, and maps read back the same elements they were written with. */
+static void RoundTripsCollections() {
+	Vector<int> Numbers;
+	Vector<std::string> Strings;
+	Set<int> Values;
+	Map<int, std::string> Pairs;
+	for (int Index = 0; Index < SERIALIZATION_TEST_COUNT; ++Index) {
+		Numbers.PushBack(Index * 3);
+		Strings.PushBack(std::string(static_cast<size_t>(Index % 7), static_cast<char>('a' + Index % 26)));
+		Values.Insert(Index * 5);
+		Pairs.Insert(Index, std::to_string(Index));
+	}
+	Vector<int> ReadNumbers;
+	CHECK(Restore(Snapshot(Numbers), ReadNumbers));
+	CHECK(SameElements(ReadNumbers, Numbers));
+	Vector<std::string> ReadStrings;
+	CHECK(Restore(Snapshot(Strings), ReadStrings));
+	CHECK(SameElements(ReadStrings, Strings));
+	Set<int> ReadValues;
+	CHECK(Restore(Snapshot(Values), ReadValues));
+	CHECK(ReadValues.Size() == Values.Size());
+	for (int Index = 0; Index < SERIALIZATION_TEST_COUNT; ++Index) {
+		CHECK(ReadValues.Contains(Index * 5));
+	}
+	Map<int, std::string> ReadPairs;
+	CHECK(Restore(Snapshot(Pairs), ReadPairs));
+	CHECK(ReadPairs.Size() == Pairs.Size());
+	for (int Index = 0; Index < SERIALIZATION_TEST_COUNT; ++Index) {
+		const std::string* Value = ReadPairs.Find(Index);
+		CHECK(Value != nullptr && *Value == std::to_string(Index));
+	}
+}
+
+/** Graphs read back each node's code, data, weight, and connections. */
+static void RoundTripsGraphs() {
+	Graph<int> Written;
+	Vector<NodeCode> Codes;
+	for (int Index = 0; Index < SERIALIZATION_TEST_COUNT; ++Index) {
+		Codes.PushBack(Written.Insert(Index, static_cast<NodeWeight>(Index % 9), Index % 4 != 0));
+	}
+	for (size_t Index = 1; Index < Codes.Size(); ++Index) {
+		Written.Connect(Codes[Index - 1], Codes[Index], static_cast<NodeWeight>(Index), Index % 3 != 0);
+	}
+	Graph<int> Read;
+	CHECK(Restore(Snapshot(Written), Read));
+	CHECK(Read.Size() == Written.Size());
+	for (size_t Index = 0; Index < Codes.Size(); ++Index) {
+		const GraphNode<int>* Original = Written.Find(Codes[Index]);
+		const GraphNode<int>* Restored = Read.Find(Codes[Index]);
+		CHECK(Restored != nullptr);
+		if (Restored == nullptr) {
+			continue;
+		}
+		CHECK(Restored->Data == Original->Data && Restored->Weight == Original->Weight && Restored->Active == Original->Active);
+		CHECK(Restored->TotalConnections() == Original->TotalConnections());
+		if (Index + 1 < Codes.Size()) {
+			const Connection<int>* Link = Restored->FindConnection(Codes[Index + 1]);
+			CHECK(Link != nullptr && Link->Weight == static_cast<NodeWeight>(Index + 1) && Link->Active == ((Index + 1) % 3 != 0));
+		}
+	}
+	CHECK(Read.Insert(-1) != Codes.Back());
+}
+
+/** Trees read back their bounds, looseness, and each pair's data at its position. */
+static void RoundTripsTrees() {
+	using FloatTree = Tree<int, 2, float>;
+	FloatTree Written(FloatTree::Box(FloatTree::Point(0.0f), 64), 1.5f);
+	for (int Index = 0; Index < SERIALIZATION_TEST_COUNT; ++Index) {
+		Written.Insert(Index, FloatTree::Point({ static_cast<float>(Index % 97) - 48, static_cast<float>(Index % 53) - 26 }));
+	}
+	FloatTree Read;
+	CHECK(Restore(Snapshot(Written), Read));
+	CHECK(Read.Size() == Written.Size());
+	CHECK(Read.Looseness() == Written.Looseness());
+	CHECK(Read.Bounds().HalfSize == Written.Bounds().HalfSize);
+	for (const FloatTree::Pair* Pair : Written.Pairs()) {
+		const FloatTree::Pair* Found = Read.Find(Pair->Position());
+		CHECK(Found != nullptr);
+	}
+	size_t Total = 0;
+	for (const FloatTree::Pair* Pair : Read.Pairs()) {
+		Total += static_cast<size_t>(Pair->Data);
+	}
+	CHECK(Total == SERIALIZATION_TEST_COUNT * (SERIALIZATION_TEST_COUNT - 1) / 2);
+}
+
+/** A tree section whose pair count is larger than its snapshot is rejected before any pairs are reserved. */
+static void RejectsCorruptTreeCounts() {
+	std::ostringstream Stream;
+	{
+		Writer Writer(Stream);
+		Writer.Begin(Section::TREE, sizeof(int), SERIALIZATION_TEST_CORRUPT_COUNT);
+		Writer.Write(static_cast<uint32_t>(2));
+		Writer.Write(static_cast<uint32_t>(sizeof(float)));
+		Writer.Write(0.0f);
+		Writer.Write(0.0f);
+		Writer.Write(100.0f);
+		Writer.Write(1.0f);
+	}
+	Tree<int, 2, float> Read;
+	CHECK(Rejects(Stream.str(), Read));
+	CHECK(Read.Size() == 0);
+}
+
+/** A graph section whose node count, or a node whose connection count, is larger than its snapshot is rejected before the graph grows. */
+static void RejectsCorruptGraphCounts() {
+	std::ostringstream Nodes;
+	{
+		Writer Writer(Nodes);
+		Writer.Begin(Section::GRAPH, sizeof(int), SERIALIZATION_TEST_CORRUPT_COUNT);
+	}
+	Graph<int> Read;
+	Read.Insert(1);
+	CHECK(Rejects(Nodes.str(), Read));
+	CHECK(Read.Size() == 1);
+	std::ostringstream Connections;
+	{
+		Writer Writer(Connections);
+		Writer.Begin(Section::GRAPH, sizeof(int), 1);
+		Writer.Write(static_cast<uint64_t>(1));
+		Writer.Write(static_cast<uint64_t>(DEFAULT_WEIGHT));
+		Writer.Write(static_cast<uint8_t>(1));
+		Writer.Write(7);
+		Writer.Write(static_cast<uint64_t>(SERIALIZATION_TEST_CORRUPT_COUNT));
+	}
+	CHECK(Rejects(Connections.str(), Read));
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "RoundTripsCollections", RoundTripsCollections },
+		{ "RoundTripsGraphs", RoundTripsGraphs },
+		{ "RoundTripsTrees", RoundTripsTrees },
+		{ "RejectsCorruptTreeCounts", RejectsCorruptTreeCounts },
+		{ "RejectsCorruptGraphCounts", RejectsCorruptGraphCounts },
+	});
+}
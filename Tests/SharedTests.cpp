@@ -0,0 +1,79 @@
+// .cpp
+// Shared Pointer Tests
+// by Kyle Furey
+
+#include "Toolbox/Shared.h"
+#include "Toolbox/Weak.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+/** An object with a member that can be aliased. */
+struct Pair final {
+
+	/** The first number. */
+	int First;
+
+	/** The second number. */
+	int Second;
+};
+
+
+// TESTS
+
+/** Aliasing shared and weak pointers become null once their owner's memory is deleted. */
+static void AliasesFollowDelete() {
+	Shared<Pair> Owner(new Pair{ 1, 2 });
+	Shared<int> Alias(Owner, &Owner->Second);
+	Weak<int> Observer = Alias.MakeWeak();
+	CHECK(Alias.IsValid() && *Alias == 2);
+	CHECK(Observer.IsValid());
+	CHECK(Owner.Delete());
+	CHECK(!Owner.IsValid());
+	CHECK(!Alias.IsValid());
+	CHECK(Alias.Raw() == nullptr);
+	CHECK(!Observer.IsValid());
+	CHECK(Alias.SharedCount() == 2);
+}
+
+/** Aliasing shared pointers become null once their owner's memory is released. */
+static void AliasesFollowRelease() {
+	Shared<Pair> Owner(new Pair{ 3, 4 });
+	const Shared<int> Alias(Owner, &Owner->First);
+	Pair* Released = Owner.Release();
+	CHECK(Released != nullptr && !Alias.IsValid());
+	delete Released;
+}
+
+/** Aliasing shared pointers keep their owner's memory alive after the owner is cleared. */
+static void AliasesKeepOwnerAlive() {
+	Weak<Pair> Observer;
+	Shared<int> Alias;
+	{
+		Shared<Pair> Owner = Shared<Pair>::Make(Pair{ 5, 6 });
+		Observer = Owner.MakeWeak();
+		Alias = Shared<int>(Owner, &Owner->Second);
+	}
+	CHECK(Alias.IsValid() && *Alias == 6);
+	CHECK(Observer.IsValid());
+	Alias.Clear();
+	CHECK(!Observer.IsValid());
+}
+
+/** The delete function of each smart pointer is returned through its named type. */
+static void DeleteFunctionType() {
+	const Shared<int>::DeleteFunctionType Function = Shared<int>().DeleteFunction();
+	CHECK(Function == static_cast<Shared<int>::DeleteFunctionType>(Delete<int>));
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "AliasesFollowDelete", AliasesFollowDelete },
+		{ "AliasesFollowRelease", AliasesFollowRelease },
+		{ "AliasesKeepOwnerAlive", AliasesKeepOwnerAlive },
+		{ "DeleteFunctionType", DeleteFunctionType },
+	});
+}
@@ -0,0 +1,121 @@
+// .cpp
+// SIMD Tests
+// by Kyle Furey
+
+#include <cctype>
+#include <cstring>
+#include <random>
+#include "Toolbox/Simd.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The longest array each kernel is checked against, which spans several packs of every instruction set.
+#define SIMD_TEST_LENGTH 100
+
+
+// HELPERS
+
+/** Returns an array of the given length at an offset that is not aligned to any pack width, filled with a few distinct bytes and whitespace. */
+static char* RandomBytes(std::mt19937& Random, char* Buffer, const size_t Length) {
+	static const char Alphabet[] = { 'a', 'B', 'c', ' ', '\t', '\n', 'Z', 'y' };
+	std::uniform_int_distribution<size_t> Letter(0, sizeof(Alphabet) - 1);
+	char* Data = Buffer + 3;
+	for (size_t Index = 0; Index < Length; ++Index) {
+		Data[Index] = Alphabet[Letter(Random)];
+	}
+	return Data;
+}
+
+/** Returns whether the given byte is whitespace as the SIMD kernels define it. */
+static bool IsSpace(const char Byte) {
+	return Byte == ' ' || (Byte >= '\t' && Byte <= '\r');
+}
+
+
+// TESTS
+
+/** The searching kernels match a scalar search for every length and position. */
+static void SearchesMatchScalar() {
+	std::mt19937 Random(3);
+	char Buffer[SIMD_TEST_LENGTH + 8];
+	for (size_t Length = 0; Length <= SIMD_TEST_LENGTH; ++Length) {
+		const char* Data = RandomBytes(Random, Buffer, Length);
+		ptrdiff_t First = -1;
+		ptrdiff_t Last = -1;
+		size_t Count = 0;
+		for (size_t Index = 0; Index < Length; ++Index) {
+			if (Data[Index] == 'Z') {
+				First = First == -1 ? static_cast<ptrdiff_t>(Index) : First;
+				Last = static_cast<ptrdiff_t>(Index);
+				++Count;
+			}
+		}
+		CHECK(SimdFind(Data, Length, 'Z') == First);
+		CHECK(SimdFindLast(Data, Length, 'Z') == Last);
+		CHECK(SimdCount(Data, Length, 'Z') == Count);
+		CHECK(SimdFind(Data, Length, '#') == -1);
+		if (Length >= 3) {
+			const char* Needle = Data + Length - 3;
+			const ptrdiff_t Found = SimdFindString(Data, Length, Needle, 3);
+			CHECK(Found >= 0 && Found <= static_cast<ptrdiff_t>(Length - 3) && std::memcmp(Data + Found, Needle, 3) == 0);
+		}
+	}
+}
+
+/** The comparing kernels find the first differing byte for every length and position. */
+static void MismatchMatchesScalar() {
+	char Left[SIMD_TEST_LENGTH + 1];
+	char Right[SIMD_TEST_LENGTH + 1];
+	for (size_t Length = 0; Length <= SIMD_TEST_LENGTH; ++Length) {
+		std::memset(Left, 'x', Length);
+		std::memset(Right, 'x', Length);
+		CHECK(SimdEquals(Left, Right, Length));
+		for (size_t Index = 0; Index < Length; ++Index) {
+			Right[Index] = 'y';
+			CHECK(SimdMismatch(Left, Right, Length) == Index);
+			Right[Index] = 'x';
+		}
+	}
+}
+
+/** The whitespace and case kernels match scalar loops for every length. */
+static void TransformsMatchScalar() {
+	std::mt19937 Random(4);
+	char Buffer[SIMD_TEST_LENGTH + 8];
+	for (size_t Length = 0; Length <= SIMD_TEST_LENGTH; ++Length) {
+		char* Data = RandomBytes(Random, Buffer, Length);
+		size_t Front = 0;
+		while (Front < Length && IsSpace(Data[Front])) {
+			++Front;
+		}
+		size_t Back = 0;
+		while (Back < Length && IsSpace(Data[Length - 1 - Back])) {
+			++Back;
+		}
+		CHECK(SimdSkipWhitespace(Data, Length) == Front);
+		CHECK(SimdSkipWhitespaceBack(Data, Length) == Back);
+		char Expected[SIMD_TEST_LENGTH];
+		for (size_t Index = 0; Index < Length; ++Index) {
+			Expected[Index] = static_cast<char>(std::tolower(static_cast<unsigned char>(Data[Index])));
+		}
+		SimdToLowercase(Data, Length);
+		CHECK(std::memcmp(Data, Expected, Length) == 0);
+		for (size_t Index = 0; Index < Length; ++Index) {
+			Expected[Index] = static_cast<char>(std::toupper(static_cast<unsigned char>(Data[Index])));
+		}
+		SimdToUppercase(Data, Length);
+		CHECK(std::memcmp(Data, Expected, Length) == 0);
+	}
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "SearchesMatchScalar", SearchesMatchScalar },
+		{ "MismatchMatchesScalar", MismatchMatchesScalar },
+		{ "TransformsMatchScalar", TransformsMatchScalar },
+	});
+}
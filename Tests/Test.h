@@ -0,0 +1,55 @@
+// .h
+// Test Helpers
+// by Kyle Furey
+
+#pragma once
+#include <cstdio>
+#include <exception>
+#include <initializer_list>
+#include <utility>
+
+// Records a failure with the given condition's source and location if the given condition is false.
+#define CHECK(Condition) ::Tests::Check(static_cast<bool>(Condition), #Condition, __FILE__, __LINE__)
+
+/** Helpers shared by each of the Toolbox's test programs. */
+namespace Tests {
+
+	// DATA
+
+	/** The number of checks that failed in this test program. */
+	static size_t Failures = 0;
+
+
+	// CHECKS
+
+	/** Records a failure with the given condition's source and location if the given result is false, and returns the result. */
+	static bool Check(const bool Result, const char* Condition, const char* File, const int Line) {
+		if (!Result) {
+			++Failures;
+			std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", File, Line, Condition);
+		}
+		return Result;
+	}
+
+
+	// RUNNING
+
+	/** A named test case. */
+	using Case = std::pair<const char*, void(*)()>;
+
+	/** Runs each of the given test cases, counting thrown exceptions as failures, and returns the program's exit code. */
+	static int Run(const std::initializer_list<Case> Cases) {
+		for (const Case& Case : Cases) {
+			const size_t Before = Failures;
+			try {
+				Case.second();
+			}
+			catch (const std::exception& Exception) {
+				++Failures;
+				std::fprintf(stderr, "%s: threw %s\n", Case.first, Exception.what());
+			}
+			std::printf("%s %s\n", Failures == Before ? "PASS" : "FAIL", Case.first);
+		}
+		return Failures == 0 ? 0 : 1;
+	}
+}
@@ -0,0 +1,103 @@
+// .cpp
+// Tree Tests
+// by Kyle Furey
+
+#include <random>
+#include "Toolbox/Tree.h"
+#include "Tests/Test.h"
+
+using namespace Toolbox;
+
+// The number of pairs inserted into each randomized tree.
+#define TREE_TEST_PAIRS 5000
+
+/** A three dimensional tree of single precision, where positions round onto split planes most often. */
+using FloatTree = Tree<int, 3, float>;
+
+
+// INVARIANTS
+
+/** Checks that every pair in the given tree is stored in a node and can be reached by each kind of query. */
+static void CheckReachable(FloatTree& Tree) {
+	Vector<FloatTree::Pair*> Pairs = Tree.Pairs();
+	CHECK(Pairs.Size() == Tree.Size());
+	CHECK(Tree.Query(Tree.Bounds()).Size() == Tree.Size());
+	Vector<FloatTree::Pair*> Nearest;
+	for (FloatTree::Pair* Pair : Pairs) {
+		if (!CHECK(Tree.Contains(Pair))) {
+			return;
+		}
+		Nearest.Clear();
+		CHECK(Tree.FindNearest(Pair->Position(), 1, Nearest) == 1);
+	}
+}
+
+/** Returns a position on or within a rounding error of a split plane of the default tree bounds. */
+static FloatTree::Point SplitPlanePoint(std::mt19937& Random) {
+	static const float Planes[] = { -100, -75, -50, -25, 0, 25, 50, 75, 100 };
+	std::uniform_int_distribution<size_t> Plane(0, sizeof(Planes) / sizeof(Planes[0]) - 1);
+	std::uniform_int_distribution<int> Offset(-2, 2);
+	FloatTree::Point Point;
+	for (size_t Component = 0; Component < 3; ++Component) {
+		const float Nudged = Planes[Plane(Random)] + static_cast<float>(Offset(Random)) * 1e-6f;
+		Point[Component] = Nudged < -100 ? -100 : Nudged > 100 ? 100 : Nudged;
+	}
+	return Point;
+}
+
+
+// TESTS
+
+/** Pairs inserted on split planes are stored and reachable instead of being orphaned. */
+static void InsertOnSplitPlanes() {
+	std::mt19937 Random(1);
+	FloatTree Tree;
+	for (int Index = 0; Index < TREE_TEST_PAIRS; ++Index) {
+		FloatTree::Pair* Pair = Tree.Insert(Index, SplitPlanePoint(Random));
+		CHECK(Pair != nullptr && Tree.Contains(Pair));
+	}
+	CHECK(Tree.Size() == TREE_TEST_PAIRS);
+	CheckReachable(Tree);
+}
+
+/** Pairs moved randomly and onto split planes stay in the tree and can still be removed. */
+static void MoveKeepsPairs() {
+	std::mt19937 Random(2);
+	std::uniform_real_distribution<float> Coordinate(-100, 100);
+	FloatTree Tree;
+	Vector<FloatTree::Pair*> Pairs;
+	for (int Index = 0; Index < TREE_TEST_PAIRS; ++Index) {
+		Pairs.PushBack(Tree.Insert(Index, FloatTree::Point({ Coordinate(Random), Coordinate(Random), Coordinate(Random) })));
+	}
+	for (int Round = 0; Round < 3; ++Round) {
+		for (FloatTree::Pair* Pair : Pairs) {
+			CHECK(Tree.Move(Pair, Round == 1 ? SplitPlanePoint(Random) : FloatTree::Point({ Coordinate(Random), Coordinate(Random), Coordinate(Random) })));
+		}
+		CheckReachable(Tree);
+	}
+	CHECK(!Tree.Move(Pairs[0], FloatTree::Point({ 101, 0, 0 })));
+	Tree.Rebuild();
+	CheckReachable(Tree);
+	for (FloatTree::Pair* Pair : Pairs) {
+		Tree.Remove(Pair);
+	}
+	CHECK(Tree.Size() == 0);
+}
+
+/** Pairs outside of the tree's bounds are rejected. */
+static void InsertOutsideBounds() {
+	FloatTree Tree;
+	CHECK(Tree.Insert(0, FloatTree::Point({ 0, 100.5f, 0 })) == nullptr);
+	CHECK(Tree.Size() == 0);
+}
+
+
+// MAIN
+
+int main() {
+	return Tests::Run({
+		{ "InsertOnSplitPlanes", InsertOnSplitPlanes },
+		{ "MoveKeepsPairs", MoveKeepsPairs },
+		{ "InsertOutsideBounds", InsertOutsideBounds },
+	});
+}
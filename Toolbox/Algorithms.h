@@ -3,8 +3,14 @@
 // by Kyle Furey
 
 #pragma once
+#include <memory>
+#include <type_traits>
 #include "Vector.h"
 #include "Sorting.h"
+#include "ThreadPool.h"
+
+// The fewest elements a parallel algorithm hands to each chunk when it chooses the grain size itself.
+#define PARALLEL_MINIMUM_GRAIN 4096
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
@@ -14,6 +20,66 @@ namespace Toolbox {
 	/** Useful algorithms for collections. */
 	namespace Algorithms {
 
+		// EXECUTION POLICIES
+
+		/** An execution policy that runs an algorithm sequentially on the calling thread. */
+		struct SequencedPolicy final {
+		};
+
+		/**
+		 * An execution policy that splits a contiguous collection into chunks run across a thread pool and the calling thread.<br/>
+		 * Collections that are not contiguous, such as lists, are still processed sequentially.
+		 */
+		struct ParallelPolicy final {
+
+			// DATA
+
+			/** The pool to run chunks on, or nullptr to use the default pool. */
+			ThreadPool* Pool;
+
+			/** The number of elements in each chunk, or 0 to choose a grain size from the size of the pool. */
+			size_t Grain;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			constexpr ParallelPolicy(ThreadPool* Pool = nullptr, const size_t Grain = 0) : Pool(Pool), Grain(Grain) {
+			}
+
+
+			// GETTERS
+
+			/** Returns the pool this policy runs on. */
+			ThreadPool& Threads() const {
+				return Pool != nullptr ? *Pool : ThreadPool::Default();
+			}
+
+			/** Returns the number of elements in each chunk when splitting the given number of elements across the given pool. */
+			size_t ChunkSize(const size_t Count, const ThreadPool& Threads) const {
+				if (Grain > 0) {
+					return Grain;
+				}
+				const size_t Size = Count / ((Threads.Threads() + 1) * 4);
+				return Size > PARALLEL_MINIMUM_GRAIN ? Size : PARALLEL_MINIMUM_GRAIN;
+			}
+		};
+
+		/** Selects the sequential overload of an algorithm. */
+		static constexpr SequencedPolicy Sequenced = SequencedPolicy();
+
+		/** Selects the parallel overload of an algorithm, which runs on the default thread pool. */
+		static constexpr ParallelPolicy Parallel = ParallelPolicy();
+
+		/** Whether the given type is an execution policy. */
+		template<typename Type>
+		static constexpr bool IsExecutionPolicy = std::is_same_v<std::remove_cv_t<Type>, SequencedPolicy> || std::is_same_v<std::remove_cv_t<Type>, ParallelPolicy>;
+
+		/** Whether the given collection type stores its elements contiguously, so it can be split into chunks. */
+		template<typename CollectionType>
+		static constexpr bool IsContiguous = std::is_pointer_v<decltype(std::declval<CollectionType&>().begin())>;
+
+
 		// MAP
 
 		/** Applies the given operation on each element in the given collection. */
@@ -38,6 +104,34 @@ namespace Toolbox {
 			return Collection;
 		}
 
+		/** Applies the given operation on each element in the given collection on the calling thread. */
+		template <typename CollectionType, typename OperationType>
+		static CollectionType& Map(const SequencedPolicy& Policy, CollectionType& Collection, OperationType Operation) {
+			for (auto& Element : Collection) {
+				Operation(Element);
+			}
+			return Collection;
+		}
+
+		/** Applies the given operation on each element in the given collection in parallel chunks, so the operation must be safe to call concurrently. */
+		template <typename CollectionType, typename OperationType>
+		static CollectionType& Map(const ParallelPolicy& Policy, CollectionType& Collection, OperationType Operation) {
+			if constexpr (IsContiguous<CollectionType>) {
+				auto* Data = Collection.begin();
+				const size_t Count = static_cast<size_t>(Collection.end() - Data);
+				ThreadPool& Threads = Policy.Threads();
+				Threads.ParallelFor(0, Count, Policy.ChunkSize(Count, Threads), [&](const size_t First, const size_t Last) {
+					for (size_t Index = First; Index < Last; ++Index) {
+						Operation(Data[Index]);
+					}
+				});
+			}
+			else {
+				Map(Sequenced, Collection, Operation);
+			}
+			return Collection;
+		}
+
 
 		// FILTER
 
@@ -56,7 +150,8 @@ namespace Toolbox {
 		/** Returns a vector of pointers to elements in the given collection that match the given predicate. */
 		template <typename CollectionType, typename Type>
 		static Vector<Type*> Filter(size_t Size, CollectionType& Collection, bool(*Predicate)(const Type&)) {
-			Vector<Type*> NewCollection(Size);
+			Vector<Type*> NewCollection;
+			NewCollection.Reserve(Size);
 			for (auto& Element : Collection) {
 				if (Size == 0) {
 					break;
@@ -84,7 +179,8 @@ namespace Toolbox {
 		/** Returns a vector of constant pointers to elements in the given collection that match the given predicate. */
 		template <typename CollectionType, typename Type>
 		static Vector<const Type*> Filter(size_t Size, const CollectionType& Collection, bool(*Predicate)(const Type&)) {
-			Vector<const Type*> NewCollection(Size);
+			Vector<const Type*> NewCollection;
+			NewCollection.Reserve(Size);
 			for (auto& Element : Collection) {
 				if (Size == 0) {
 					break;
@@ -97,6 +193,65 @@ namespace Toolbox {
 			return NewCollection;
 		}
 
+		/** Returns a vector of pointers to elements in the given collection that match the given predicate, which are tested on the calling thread. */
+		template <typename CollectionType, typename PredicateType>
+		static auto Filter(const SequencedPolicy& Policy, CollectionType& Collection, PredicateType Predicate) {
+			Vector<std::remove_reference_t<decltype(*Collection.begin())>*> NewCollection;
+			for (auto& Element : Collection) {
+				if (Predicate(Element)) {
+					NewCollection.PushBack(&Element);
+				}
+			}
+			return NewCollection;
+		}
+
+		/**
+		 * Returns a vector of pointers to elements in the given collection that match the given predicate, in their original order.<br/>
+		 * Chunks are tested in parallel, a prefix sum of each chunk's matches gives where it writes, and then every chunk writes its matches in parallel.
+		 */
+		template <typename CollectionType, typename PredicateType>
+		static auto Filter(const ParallelPolicy& Policy, CollectionType& Collection, PredicateType Predicate) {
+			using Type = std::remove_reference_t<decltype(*Collection.begin())>;
+			if constexpr (IsContiguous<CollectionType>) {
+				Type* Data = Collection.begin();
+				const size_t Count = static_cast<size_t>(Collection.end() - Data);
+				ThreadPool& Threads = Policy.Threads();
+				const size_t Grain = Policy.ChunkSize(Count, Threads);
+				const size_t Chunks = (Count + Grain - 1) / Grain;
+				Vector<unsigned char> Matches(Count, static_cast<unsigned char>(0));
+				Vector<size_t> Offsets(Chunks + 1, static_cast<size_t>(0));
+				Threads.ParallelFor(0, Chunks, 1, [&](const size_t Chunk) {
+					const size_t First = Chunk * Grain;
+					const size_t Last = Count - First < Grain ? Count : First + Grain;
+					size_t Total = 0;
+					for (size_t Index = First; Index < Last; ++Index) {
+						Matches[Index] = Predicate(Data[Index]) ? 1 : 0;
+						Total += Matches[Index];
+					}
+					Offsets[Chunk + 1] = Total;
+				});
+				for (size_t Chunk = 0; Chunk < Chunks; ++Chunk) {
+					Offsets[Chunk + 1] += Offsets[Chunk];
+				}
+				Vector<Type*> NewCollection(Offsets[Chunks], static_cast<Type*>(nullptr));
+				Threads.ParallelFor(0, Chunks, 1, [&](const size_t Chunk) {
+					const size_t First = Chunk * Grain;
+					const size_t Last = Count - First < Grain ? Count : First + Grain;
+					size_t Current = Offsets[Chunk];
+					for (size_t Index = First; Index < Last; ++Index) {
+						if (Matches[Index] != 0) {
+							NewCollection[Current] = Data + Index;
+							++Current;
+						}
+					}
+				});
+				return NewCollection;
+			}
+			else {
+				return Filter(Sequenced, Collection, Predicate);
+			}
+		}
+
 
 		// REDUCE
 
@@ -192,21 +347,245 @@ namespace Toolbox {
 			return Start;
 		}
 
+		/** Combines the right value into the left value with an accumulator that either returns the combined value or modifies the left value by reference. */
+		template <typename Type, typename ElementType, typename AccumulatorType>
+		static void Accumulate(Type& Left, const ElementType& Right, AccumulatorType& Accumulator) {
+			if constexpr (std::is_void_v<std::invoke_result_t<AccumulatorType&, Type&, const ElementType&>>) {
+				Accumulator(Left, Right);
+			}
+			else {
+				Left = Accumulator(Left, Right);
+			}
+		}
+
+		/** Returns the result of combining all elements in the given collection into the given starting value with the given accumulator on the calling thread. */
+		template <typename CollectionType, typename Type, typename AccumulatorType>
+		static Type Reduce(const SequencedPolicy& Policy, const CollectionType& Collection, Type Start, AccumulatorType Accumulator) {
+			for (auto& Element : Collection) {
+				Accumulate(Start, Element, Accumulator);
+			}
+			return Start;
+		}
+
+		/**
+		 * Returns the result of combining all elements in the given collection into the given starting value with the given associative accumulator.<br/>
+		 * Each chunk is seeded with the starting value and reduced in parallel, and then neighbouring partial results are combined pairwise in parallel as a tree with the given combiner.<br/>
+		 * The starting value must be an identity of the combiner, since it is folded into every chunk.<br/>
+		 * The accumulator and combiner may return the combined value or modify the left value by reference, and elements are always combined in their original order.
+		 */
+		template <typename CollectionType, typename Type, typename AccumulatorType, typename CombinerType>
+		static Type Reduce(const ParallelPolicy& Policy, const CollectionType& Collection, Type Start, AccumulatorType Accumulator, CombinerType Combiner) {
+			if constexpr (IsContiguous<const CollectionType>) {
+				const auto* Data = Collection.begin();
+				const size_t Count = static_cast<size_t>(Collection.end() - Data);
+				if (Count == 0) {
+					return Start;
+				}
+				ThreadPool& Threads = Policy.Threads();
+				const size_t Grain = Policy.ChunkSize(Count, Threads);
+				const size_t Chunks = (Count + Grain - 1) / Grain;
+				Vector<Type> Partials(Chunks, Start);
+				Threads.ParallelFor(0, Chunks, 1, [&](const size_t Chunk) {
+					const size_t First = Chunk * Grain;
+					const size_t Last = Count - First < Grain ? Count : First + Grain;
+					Type& Partial = Partials[Chunk];
+					for (size_t Index = First; Index < Last; ++Index) {
+						Accumulate(Partial, Data[Index], Accumulator);
+					}
+				});
+				for (size_t Width = 1; Width < Chunks; Width *= 2) {
+					Threads.ParallelFor(0, (Chunks + Width * 2 - 1) / (Width * 2), 1, [&](const size_t Pair) {
+						const size_t Left = Pair * Width * 2;
+						if (Left + Width < Chunks) {
+							Accumulate(Partials[Left], Partials[Left + Width], Combiner);
+						}
+					});
+				}
+				return std::move(Partials[0]);
+			}
+			else {
+				return Reduce(Sequenced, Collection, Start, Accumulator);
+			}
+		}
+
+		/**
+		 * Returns the result of combining all elements in the given collection into the given starting value with the given associative accumulator in parallel chunks.<br/>
+		 * The accumulator also combines the partial results of each chunk, so the starting value must be an identity of the accumulator and of the same type as each element.
+		 */
+		template <typename CollectionType, typename Type, typename AccumulatorType>
+		static Type Reduce(const ParallelPolicy& Policy, const CollectionType& Collection, Type Start, AccumulatorType Accumulator) {
+			return Reduce(Policy, Collection, std::move(Start), Accumulator, Accumulator);
+		}
+
 
 		// SORT
 
-		/** Quick sorts the given collection with the given comparer. */
-		template <typename CollectionType, typename Type>
-		static CollectionType& Sort(CollectionType& Collection, bool(*Comparer)(const Type&, const Type&) = Sorting::GreaterThan) {
-			Sorting::QuickSort<CollectionType, Type>(Collection.Size(), Collection, Comparer);
+		/** Sorts the given number of elements at the front of the given collection with the given contiguous range sort function. */
+		template <typename CollectionType, typename SortFunctionType>
+		static CollectionType& SortWith(size_t Size, CollectionType& Collection, SortFunctionType Sort) {
+			if constexpr (std::is_pointer_v<decltype(Collection.begin())>) {
+				Sort(Collection.begin(), Collection.begin() + Size);
+			}
+			else {
+				Vector<std::remove_cvref_t<decltype(*Collection.begin())>> Elements;
+				Elements.Reserve(Size);
+				auto Current = Collection.begin();
+				for (size_t Index = 0; Index < Size; ++Index, ++Current) {
+					Elements.PushBack(std::move(*Current));
+				}
+				Sort(Elements.begin(), Elements.end());
+				Current = Collection.begin();
+				for (size_t Index = 0; Index < Size; ++Index, ++Current) {
+					*Current = std::move(Elements[Index]);
+				}
+			}
 			return Collection;
 		}
 
-		/** Quick sorts the given collection with the given comparer. */
-		template <typename CollectionType, typename Type>
-		static CollectionType& Sort(size_t Size, CollectionType& Collection, bool(*Comparer)(const Type&, const Type&) = Sorting::GreaterThan) {
-			Sorting::QuickSort<CollectionType, Type>(Size, Collection, Comparer);
-			return Collection;
+		/**
+		 * Sorts the given collection with an introspective quick sort using the given comparer, which returns whether the left element belongs after the right element.<br/>
+		 * Contiguous collections are sorted in place, while other collections are sorted through a temporary vector.
+		 */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater, typename = std::enable_if_t<!IsExecutionPolicy<CollectionType>>>
+		static CollectionType& Sort(CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return SortWith(Collection.Size(), Collection, [&](auto* Begin, auto* End) { Sorting::IntroSort(Begin, End, Comparer); });
+		}
+
+		/** Sorts the given number of elements at the front of the given collection with an introspective quick sort using the given comparer. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater>
+		static CollectionType& Sort(size_t Size, CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return SortWith(Size, Collection, [&](auto* Begin, auto* End) { Sorting::IntroSort(Begin, End, Comparer); });
+		}
+
+		/** Stably sorts the given collection with a merge sort using the given comparer, which returns whether the left element belongs after the right element. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater, typename = std::enable_if_t<!IsExecutionPolicy<CollectionType>>>
+		static CollectionType& StableSort(CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return SortWith(Collection.Size(), Collection, [&](auto* Begin, auto* End) { Sorting::StableSort(Begin, End, Comparer); });
+		}
+
+		/** Stably sorts the given number of elements at the front of the given collection with a merge sort using the given comparer. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater>
+		static CollectionType& StableSort(size_t Size, CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return SortWith(Size, Collection, [&](auto* Begin, auto* End) { Sorting::StableSort(Begin, End, Comparer); });
+		}
+
+		/** Returns how many elements of the left sorted range are among the first given number of elements when stably merging it with the right sorted range. */
+		template <typename Type, typename ComparerType>
+		static size_t CoRank(const Type* Left, const size_t LeftCount, const Type* Right, const size_t RightCount, const size_t Rank, ComparerType& Comparer) {
+			size_t Low = Rank > RightCount ? Rank - RightCount : 0;
+			size_t High = Rank < LeftCount ? Rank : LeftCount;
+			while (Low < High) {
+				const size_t Middle = Low + (High - Low) / 2;
+				if (!Comparer(Left[Middle], Right[Rank - Middle - 1])) {
+					Low = Middle + 1;
+				}
+				else {
+					High = Middle;
+				}
+			}
+			return Low;
+		}
+
+		/** Writes the merged elements from First to Last of stably merging the adjacent sorted ranges of the source into the same positions of the destination. */
+		template <typename Type, typename ComparerType>
+		static void MergeRange(Type* Source, const size_t Begin, const size_t Middle, const size_t End, const size_t First, const size_t Last, Type* Destination, ComparerType& Comparer) {
+			size_t Left = Begin + CoRank(Source + Begin, Middle - Begin, Source + Middle, End - Middle, First - Begin, Comparer);
+			size_t Right = Middle + (First - Begin) - (Left - Begin);
+			for (size_t Current = First; Current < Last; ++Current) {
+				if (Left < Middle && (Right >= End || !Comparer(Source[Left], Source[Right]))) {
+					Destination[Current] = std::move(Source[Left]);
+					++Left;
+				}
+				else {
+					Destination[Current] = std::move(Source[Right]);
+					++Right;
+				}
+			}
+		}
+
+		/**
+		 * Sorts the given contiguous range with a parallel merge sort.<br/>
+		 * Each chunk is sorted in parallel with the given sort function, and then each level of merges is split evenly across the pool by output position.<br/>
+		 * Merges are stable, so the whole sort is stable when the given sort function is.
+		 */
+		template <typename Type, typename ComparerType, typename SortFunctionType>
+		static void ParallelMergeSort(const ParallelPolicy& Policy, Type* Begin, Type* End, ComparerType& Comparer, SortFunctionType Sort) {
+			const size_t Count = static_cast<size_t>(End - Begin);
+			ThreadPool& Threads = Policy.Threads();
+			const size_t Grain = Policy.ChunkSize(Count, Threads);
+			if (Count <= Grain) {
+				Sort(Begin, End);
+				return;
+			}
+			const size_t Chunks = (Count + Grain - 1) / Grain;
+			Threads.ParallelFor(0, Count, Grain, [&](const size_t First, const size_t Last) {
+				Sort(Begin + First, Begin + Last);
+			});
+			Type* Buffer = static_cast<Type*>(::operator new(sizeof(Type) * Count, std::align_val_t(alignof(Type))));
+			Threads.ParallelFor(0, Count, Grain, [&](const size_t First, const size_t Last) {
+				std::uninitialized_move(Begin + First, Begin + Last, Buffer + First);
+			});
+			Type* Source = Buffer;
+			Type* Destination = Begin;
+			for (size_t Width = Grain; Width < Count; Width *= 2) {
+				Threads.ParallelFor(0, Chunks, 1, [&](const size_t Chunk) {
+					const size_t First = Chunk * Grain;
+					const size_t Last = Count - First < Grain ? Count : First + Grain;
+					for (size_t Left = First - First % (Width * 2); Left < Last; Left += Width * 2) {
+						const size_t Middle = Left + Width < Count ? Left + Width : Count;
+						const size_t Right = Middle + Width < Count ? Middle + Width : Count;
+						MergeRange(Source, Left, Middle, Right, First > Left ? First : Left, Last < Right ? Last : Right, Destination, Comparer);
+					}
+				});
+				std::swap(Source, Destination);
+			}
+			if (Source != Begin) {
+				Threads.ParallelFor(0, Count, Grain, [&](const size_t First, const size_t Last) {
+					std::move(Buffer + First, Buffer + Last, Begin + First);
+				});
+			}
+			std::destroy(Buffer, Buffer + Count);
+			::operator delete(Buffer, std::align_val_t(alignof(Type)));
+		}
+
+		/** Sorts the given collection with an introspective quick sort using the given comparer on the calling thread. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater>
+		static CollectionType& Sort(const SequencedPolicy& Policy, CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return Sort(Collection, Comparer);
+		}
+
+		/** Sorts the given collection with a parallel merge sort of introspective quick sorted chunks using the given comparer, which must be safe to call concurrently. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater>
+		static CollectionType& Sort(const ParallelPolicy& Policy, CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return SortWith(Collection.Size(), Collection, [&](auto* Begin, auto* End) {
+				ParallelMergeSort(Policy, Begin, End, Comparer, [&](auto* First, auto* Last) { Sorting::IntroSort(First, Last, Comparer); });
+			});
+		}
+
+		/** Stably sorts the given collection with a merge sort using the given comparer on the calling thread. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater>
+		static CollectionType& StableSort(const SequencedPolicy& Policy, CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return StableSort(Collection, Comparer);
+		}
+
+		/** Stably sorts the given collection with a parallel merge sort using the given comparer, which must be safe to call concurrently. */
+		template <typename CollectionType, typename ComparerType = Sorting::Greater>
+		static CollectionType& StableSort(const ParallelPolicy& Policy, CollectionType& Collection, ComparerType Comparer = ComparerType()) {
+			return SortWith(Collection.Size(), Collection, [&](auto* Begin, auto* End) {
+				ParallelMergeSort(Policy, Begin, End, Comparer, [&](auto* First, auto* Last) { Sorting::StableSort(First, Last, Comparer); });
+			});
+		}
+
+		/** Stably sorts the given collection of integers or floating point numbers in ascending order with a radix sort. */
+		template <typename CollectionType>
+		static CollectionType& RadixSort(CollectionType& Collection) {
+			return SortWith(Collection.Size(), Collection, [](auto* Begin, auto* End) { Sorting::RadixSort(Begin, End); });
+		}
+
+		/** Stably sorts the given collection in ascending order of the integer or floating point key returned for each element with a radix sort. */
+		template <typename CollectionType, typename KeyFunctionType>
+		static CollectionType& RadixSort(CollectionType& Collection, KeyFunctionType Key) {
+			return SortWith(Collection.Size(), Collection, [&](auto* Begin, auto* End) { Sorting::RadixSort(Begin, End, Key); });
 		}
 
 
@@ -0,0 +1,645 @@
+// .h
+// Allocator Types
+// by Kyle Furey
+
+#pragma once
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+// The number of bytes in each block an arena allocates by default.
+#define ARENA_BLOCK_SIZE 65536
+
+// The number of blocks in each slab a fixed pool allocates by default.
+#define FIXED_POOL_SLAB 64
+
+// The largest allocation in bytes kept in a thread's cache by the thread cache allocator.
+#define THREAD_CACHE_MAX_SIZE 256
+
+// The number of freed blocks of each size a thread's cache keeps before returning them to the system.
+#define THREAD_CACHE_DEPTH 64
+
+// Lets an empty member, such as a stateless allocator, take up no space in the object that holds it.
+#if defined(_MSC_VER)
+#define TOOLBOX_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define TOOLBOX_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// HEAP ALLOCATOR
+
+	/**
+	 * The default allocator of each container, which allocates directly from the system.<br/>
+	 * An allocator is any copyable type with Allocate(Size, Alignment), Deallocate(Memory, Size, Alignment), and operator==.<br/>
+	 * Allocators that compare equal can free each other's memory, so containers only take another container's memory when their allocators are equal.
+	 */
+	struct HeapAllocator final {
+
+		// ALLOCATION
+
+		/** Returns uninitialized memory of the given size and alignment. */
+		static void* Allocate(const size_t Size, const size_t Alignment) {
+			return ::operator new(Size, std::align_val_t(Alignment));
+		}
+
+		/** Returns the given memory of the given size and alignment to the system. */
+		static void Deallocate(void* Memory, const size_t Size, const size_t Alignment) {
+			::operator delete(Memory, Size, std::align_val_t(Alignment));
+		}
+
+
+		// OPERATORS
+
+		/** Returns true since every heap allocator can free the memory of another. */
+		bool operator==(const HeapAllocator&) const {
+			return true;
+		}
+
+		/** Returns false since every heap allocator can free the memory of another. */
+		bool operator!=(const HeapAllocator&) const {
+			return false;
+		}
+	};
+
+
+	// ARENA
+
+	/**
+	 * A bump allocator that hands out memory from large blocks and frees all of it at once.<br/>
+	 * Deallocating only reclaims memory if it was the most recent allocation, so memory is otherwise held until the arena is reset or rewound.<br/>
+	 * Containers allocate from an arena through an ArenaAllocator, and must not outlive it.
+	 */
+	class Arena final {
+
+		// BLOCK
+
+		/** A header placed before the memory of each block allocated by the arena. */
+		struct alignas(std::max_align_t) Block final {
+
+			// DATA
+
+			/** The previously allocated block. */
+			Block* next;
+
+			/** The number of bytes after this header. */
+			size_t size;
+
+
+			// MEMORY
+
+			/** Returns a pointer to the first byte after this header. */
+			unsigned char* Begin() {
+				return reinterpret_cast<unsigned char*>(this + 1);
+			}
+
+			/** Returns a pointer to the byte after the end of this block. */
+			unsigned char* End() {
+				return Begin() + size;
+			}
+		};
+
+
+		// DATA
+
+		/** The most recently allocated block, which allocations are bumped from. */
+		Block* blocks;
+
+		/** The next free byte in the current block. */
+		unsigned char* current;
+
+		/** The byte after the end of the current block. */
+		unsigned char* end;
+
+		/** The number of bytes in each block unless an allocation needs more. */
+		size_t blockSize;
+
+
+		// BLOCKS
+
+		/** Allocates a new block that fits at least the given number of bytes and makes it the current block. */
+		void Grow(const size_t Size) {
+			const size_t Bytes = Size > blockSize ? Size : blockSize;
+			Block* New = static_cast<Block*>(::operator new(sizeof(Block) + Bytes, std::align_val_t(alignof(Block))));
+			New->next = blocks;
+			New->size = Bytes;
+			blocks = New;
+			current = New->Begin();
+			end = New->End();
+		}
+
+		/** Returns the given block to the system. */
+		static void Free(Block* Freed) {
+			::operator delete(Freed, std::align_val_t(alignof(Block)));
+		}
+
+		/** Returns the given pointer rounded up to the given power of two alignment. */
+		static unsigned char* Align(unsigned char* Pointer, const size_t Alignment) {
+			return reinterpret_cast<unsigned char*>((reinterpret_cast<uintptr_t>(Pointer) + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1));
+		}
+
+	public:
+
+		// MARKER
+
+		/** A saved position in an arena that it can be rewound to. */
+		struct Marker final {
+
+			// DATA
+
+			/** The current block when this marker was made. */
+			Block* Blocks;
+
+			/** The next free byte when this marker was made. */
+			unsigned char* Current;
+		};
+
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor. */
+		explicit Arena(const size_t BlockSize = ARENA_BLOCK_SIZE) : blocks(nullptr), current(nullptr), end(nullptr), blockSize(BlockSize > 0 ? BlockSize : ARENA_BLOCK_SIZE) {
+		}
+
+		/** Delete copy constructor. */
+		Arena(const Arena& Copied) = delete;
+
+		/** Delete move constructor. */
+		Arena(Arena&& Moved) noexcept = delete;
+
+		/** Destructor. */
+		~Arena() {
+			Release();
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		Arena& operator=(const Arena& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		Arena& operator=(Arena&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of bytes left in the current block. */
+		size_t Remaining() const {
+			return static_cast<size_t>(end - current);
+		}
+
+		/** Returns the total number of bytes across each block the arena holds. */
+		size_t Capacity() const {
+			size_t Capacity = 0;
+			for (const Block* Current = blocks; Current != nullptr; Current = Current->next) {
+				Capacity += Current->size;
+			}
+			return Capacity;
+		}
+
+		/** Returns the current position of the arena, which it can be rewound to. */
+		Marker Mark() const {
+			return { blocks, current };
+		}
+
+
+		// ALLOCATION
+
+		/** Returns uninitialized memory of the given size and alignment from the current block. */
+		void* Allocate(const size_t Size, const size_t Alignment) {
+			unsigned char* Memory = Align(current, Alignment);
+			if (blocks == nullptr || Memory > end || Size > static_cast<size_t>(end - Memory)) {
+				Grow(Size + Alignment);
+				Memory = Align(current, Alignment);
+			}
+			current = Memory + Size;
+			return Memory;
+		}
+
+		/** Reclaims the given memory if it was the most recent allocation, and otherwise holds it until the arena is reset. */
+		void Deallocate(void* Memory, const size_t Size, const size_t) {
+			if (static_cast<unsigned char*>(Memory) + Size == current) {
+				current = static_cast<unsigned char*>(Memory);
+			}
+		}
+
+		/** Frees every allocation made since the given marker was made, returning any newer blocks to the system. */
+		void Rewind(const Marker& Marker) {
+			while (blocks != Marker.Blocks) {
+				Block* Next = blocks->next;
+				Free(blocks);
+				blocks = Next;
+			}
+			if (blocks == nullptr) {
+				current = nullptr;
+				end = nullptr;
+				return;
+			}
+			current = Marker.Current;
+			end = blocks->End();
+		}
+
+		/** Frees every allocation at once, keeping only the current block to allocate from again. */
+		void Reset() {
+			if (blocks == nullptr) {
+				return;
+			}
+			while (blocks->next != nullptr) {
+				Block* Next = blocks->next;
+				blocks->next = Next->next;
+				Free(Next);
+			}
+			current = blocks->Begin();
+			end = blocks->End();
+		}
+
+		/** Frees every allocation and returns every block to the system. */
+		void Release() {
+			while (blocks != nullptr) {
+				Block* Next = blocks->next;
+				Free(blocks);
+				blocks = Next;
+			}
+			current = nullptr;
+			end = nullptr;
+		}
+	};
+
+
+	// ARENA SCOPE
+
+	/** Rewinds an arena to where it was when this scope was made once the scope ends, such as at the end of a request or frame. */
+	class ArenaScope final {
+
+		// DATA
+
+		/** The arena to rewind. */
+		Arena& arena;
+
+		/** The position of the arena when this scope was made. */
+		Arena::Marker marker;
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Arena constructor. */
+		explicit ArenaScope(Arena& Arena) : arena(Arena), marker(Arena.Mark()) {
+		}
+
+		/** Delete copy constructor. */
+		ArenaScope(const ArenaScope& Copied) = delete;
+
+		/** Delete move constructor. */
+		ArenaScope(ArenaScope&& Moved) noexcept = delete;
+
+		/** Destructor. */
+		~ArenaScope() {
+			arena.Rewind(marker);
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		ArenaScope& operator=(const ArenaScope& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		ArenaScope& operator=(ArenaScope&& Moved) noexcept = delete;
+	};
+
+
+	// FIXED POOL
+
+	/**
+	 * A free list allocator of equally sized blocks carved out of larger slabs, which never fragments.<br/>
+	 * Allocations larger or more aligned than its blocks fall back to the heap.<br/>
+	 * Containers allocate from a fixed pool through a FixedPoolAllocator, and must not outlive it.
+	 */
+	class FixedPool final {
+
+		// SLAB
+
+		/** A header placed before each contiguous array of blocks allocated by the pool. */
+		struct alignas(std::max_align_t) Slab final {
+
+			// DATA
+
+			/** The previously allocated slab. */
+			Slab* next;
+		};
+
+
+		// DATA
+
+		/** The next free block, or nullptr if a new slab must be allocated. */
+		void* free;
+
+		/** The most recently allocated slab. */
+		Slab* slabs;
+
+		/** The number of bytes in each block. */
+		size_t blockSize;
+
+		/** The alignment of each block. */
+		size_t alignment;
+
+		/** The number of blocks in each slab. */
+		size_t slabCount;
+
+		/** The number of blocks currently handed out by the pool. */
+		size_t size;
+
+
+		// SLABS
+
+		/** Allocates a new slab and links each of its blocks into the free list. */
+		void Grow() {
+			const size_t Header = (sizeof(Slab) + alignment - 1) / alignment * alignment;
+			Slab* New = static_cast<Slab*>(::operator new(Header + blockSize * slabCount, std::align_val_t(alignment > alignof(Slab) ? alignment : alignof(Slab))));
+			New->next = slabs;
+			slabs = New;
+			unsigned char* Blocks = reinterpret_cast<unsigned char*>(New) + Header;
+			for (size_t Index = slabCount; Index > 0; --Index) {
+				void* Block = Blocks + blockSize * (Index - 1);
+				*static_cast<void**>(Block) = free;
+				free = Block;
+			}
+		}
+
+		/** Returns whether an allocation of the given size and alignment fits in a block. */
+		bool Fits(const size_t Size, const size_t Alignment) const {
+			return Size <= blockSize && Alignment <= alignment;
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Block size constructor, where the size and alignment are rounded up to hold a free list pointer. */
+		explicit FixedPool(const size_t BlockSize, const size_t Alignment = alignof(std::max_align_t), const size_t SlabCount = FIXED_POOL_SLAB) : free(nullptr), slabs(nullptr), blockSize(0), alignment(Alignment > alignof(void*) ? Alignment : alignof(void*)), slabCount(SlabCount > 0 ? SlabCount : 1), size(0) {
+			if ((alignment & (alignment - 1)) != 0) {
+				throw std::runtime_error("ERROR: A fixed pool's alignment must be a power of two!");
+			}
+			const size_t Size = BlockSize > sizeof(void*) ? BlockSize : sizeof(void*);
+			blockSize = (Size + alignment - 1) / alignment * alignment;
+		}
+
+		/** Delete copy constructor. */
+		FixedPool(const FixedPool& Copied) = delete;
+
+		/** Delete move constructor. */
+		FixedPool(FixedPool&& Moved) noexcept = delete;
+
+		/** Destructor. */
+		~FixedPool() {
+			Reset();
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		FixedPool& operator=(const FixedPool& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		FixedPool& operator=(FixedPool&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of bytes in each block. */
+		size_t BlockSize() const {
+			return blockSize;
+		}
+
+		/** Returns the number of blocks currently handed out by the pool. */
+		size_t Size() const {
+			return size;
+		}
+
+
+		// ALLOCATION
+
+		/** Returns a block if the given size and alignment fit in one, and otherwise allocates from the heap. */
+		void* Allocate(const size_t Size, const size_t Alignment) {
+			if (!Fits(Size, Alignment)) {
+				return HeapAllocator::Allocate(Size, Alignment);
+			}
+			if (free == nullptr) {
+				Grow();
+			}
+			void* Block = free;
+			free = *static_cast<void**>(Block);
+			++size;
+			return Block;
+		}
+
+		/** Returns the given memory to the pool, or to the heap if it did not fit in a block. */
+		void Deallocate(void* Memory, const size_t Size, const size_t Alignment) {
+			if (Memory == nullptr) {
+				return;
+			}
+			if (!Fits(Size, Alignment)) {
+				HeapAllocator::Deallocate(Memory, Size, Alignment);
+				return;
+			}
+			*static_cast<void**>(Memory) = free;
+			free = Memory;
+			--size;
+		}
+
+		/** Returns every slab to the system. Each block allocated from the pool must already be deallocated or abandoned. */
+		void Reset() {
+			while (slabs != nullptr) {
+				Slab* Next = slabs->next;
+				::operator delete(slabs, std::align_val_t(alignment > alignof(Slab) ? alignment : alignof(Slab)));
+				slabs = Next;
+			}
+			free = nullptr;
+			size = 0;
+		}
+	};
+
+
+	// RESOURCE ALLOCATOR
+
+	/** An allocator that forwards to a memory resource it does not own, such as an arena or a fixed pool. */
+	template<typename ResourceType>
+	class ResourceAllocator final {
+
+		// DATA
+
+		/** The resource to allocate from. */
+		ResourceType* resource;
+
+	public:
+
+		// CONSTRUCTOR
+
+		/** Resource constructor. */
+		ResourceAllocator(ResourceType& Resource) : resource(&Resource) {
+		}
+
+
+		// GETTERS
+
+		/** Returns the resource this allocator allocates from. */
+		ResourceType& Resource() const {
+			return *resource;
+		}
+
+
+		// ALLOCATION
+
+		/** Returns uninitialized memory of the given size and alignment from the resource. */
+		void* Allocate(const size_t Size, const size_t Alignment) const {
+			return resource->Allocate(Size, Alignment);
+		}
+
+		/** Returns the given memory of the given size and alignment to the resource. */
+		void Deallocate(void* Memory, const size_t Size, const size_t Alignment) const {
+			resource->Deallocate(Memory, Size, Alignment);
+		}
+
+
+		// OPERATORS
+
+		/** Returns whether both allocators allocate from the same resource. */
+		bool operator==(const ResourceAllocator& Other) const {
+			return resource == Other.resource;
+		}
+
+		/** Returns whether the allocators allocate from different resources. */
+		bool operator!=(const ResourceAllocator& Other) const {
+			return resource != Other.resource;
+		}
+	};
+
+	/** An allocator that allocates from an arena. */
+	using ArenaAllocator = ResourceAllocator<Arena>;
+
+	/** An allocator that allocates from a fixed pool. */
+	using FixedPoolAllocator = ResourceAllocator<FixedPool>;
+
+
+	// THREAD CACHE ALLOCATOR
+
+	/**
+	 * An allocator that keeps a small cache of freed blocks for each size class on each thread in front of the heap.<br/>
+	 * Small allocations that hit the cache take no lock, and blocks freed on another thread join that thread's cache.
+	 */
+	struct ThreadCacheAllocator final {
+	private:
+
+		// SIZE CLASSES
+
+		/** The step in bytes between size classes, which is also the alignment of each cached block. */
+		static constexpr size_t STEP = alignof(std::max_align_t) > 16 ? alignof(std::max_align_t) : 16;
+
+		/** The number of size classes. */
+		static constexpr size_t CLASSES = (THREAD_CACHE_MAX_SIZE + STEP - 1) / STEP;
+
+
+		// CACHE
+
+		/** A thread's lists of freed blocks for each size class. */
+		struct Cache final {
+
+			// DATA
+
+			/** The first freed block of each size class. */
+			void* Heads[CLASSES] = {};
+
+			/** The number of freed blocks of each size class. */
+			size_t Counts[CLASSES] = {};
+
+
+			// DESTRUCTOR
+
+			/** Returns every cached block to the system when its thread exits. */
+			~Cache() {
+				for (size_t Class = 0; Class < CLASSES; ++Class) {
+					while (Heads[Class] != nullptr) {
+						void* Next = *static_cast<void**>(Heads[Class]);
+						::operator delete(Heads[Class], std::align_val_t(STEP));
+						Heads[Class] = Next;
+					}
+				}
+			}
+		};
+
+		/** Returns the current thread's cache. */
+		static Cache& Local() {
+			static thread_local Cache Cache;
+			return Cache;
+		}
+
+		/** Returns whether an allocation of the given size and alignment is served from the cache. */
+		static bool IsCached(const size_t Size, const size_t Alignment) {
+			return Size <= CLASSES * STEP && Alignment <= STEP;
+		}
+
+		/** Returns the size class of the given number of bytes. */
+		static size_t ClassOf(const size_t Size) {
+			return Size > 0 ? (Size - 1) / STEP : 0;
+		}
+
+	public:
+
+		// ALLOCATION
+
+		/** Returns uninitialized memory of the given size and alignment, reusing a cached block when one is available. */
+		static void* Allocate(const size_t Size, const size_t Alignment) {
+			if (!IsCached(Size, Alignment)) {
+				return HeapAllocator::Allocate(Size, Alignment);
+			}
+			const size_t Class = ClassOf(Size);
+			Cache& Cache = Local();
+			void* Block = Cache.Heads[Class];
+			if (Block == nullptr) {
+				return ::operator new((Class + 1) * STEP, std::align_val_t(STEP));
+			}
+			Cache.Heads[Class] = *static_cast<void**>(Block);
+			--Cache.Counts[Class];
+			return Block;
+		}
+
+		/** Returns the given memory to the current thread's cache, or to the system if the cache is full. */
+		static void Deallocate(void* Memory, const size_t Size, const size_t Alignment) {
+			if (Memory == nullptr) {
+				return;
+			}
+			if (!IsCached(Size, Alignment)) {
+				HeapAllocator::Deallocate(Memory, Size, Alignment);
+				return;
+			}
+			const size_t Class = ClassOf(Size);
+			Cache& Cache = Local();
+			if (Cache.Counts[Class] >= THREAD_CACHE_DEPTH) {
+				::operator delete(Memory, std::align_val_t(STEP));
+				return;
+			}
+			*static_cast<void**>(Memory) = Cache.Heads[Class];
+			Cache.Heads[Class] = Memory;
+			++Cache.Counts[Class];
+		}
+
+
+		// OPERATORS
+
+		/** Returns true since every thread cache allocator can free the memory of another. */
+		bool operator==(const ThreadCacheAllocator&) const {
+			return true;
+		}
+
+		/** Returns false since every thread cache allocator can free the memory of another. */
+		bool operator!=(const ThreadCacheAllocator&) const {
+			return false;
+		}
+	};
+}
@@ -257,12 +257,35 @@ namespace Toolbox {
 
 		/** Merge sorts the array using Type's > operator. */
 		void MergeSort() {
-			Sorting::MergeSort<Array, Type>(SIZE, *this);
+			Sorting::StableSort(data, data + SIZE);
 		}
 
 		/** Quick sorts the array using Type's > operator. */
 		void QuickSort() {
-			Sorting::QuickSort<Array, Type>(SIZE, *this);
+			Sorting::IntroSort(data, data + SIZE);
+		}
+
+		/** Sorts the array with an introspective quick sort using the given comparer, which returns whether the left element belongs after the right element. */
+		template<typename ComparerType = Sorting::Greater>
+		void Sort(ComparerType Comparer = ComparerType()) {
+			Sorting::IntroSort(data, data + SIZE, Comparer);
+		}
+
+		/** Stably sorts the array with a merge sort using the given comparer, which returns whether the left element belongs after the right element. */
+		template<typename ComparerType = Sorting::Greater>
+		void StableSort(ComparerType Comparer = ComparerType()) {
+			Sorting::StableSort(data, data + SIZE, Comparer);
+		}
+
+		/** Stably sorts the array's integers or floating point numbers in ascending order with a radix sort. */
+		void RadixSort() {
+			Sorting::RadixSort(data, data + SIZE);
+		}
+
+		/** Stably sorts the array in ascending order of the integer or floating point key returned for each element with a radix sort. */
+		template<typename KeyFunctionType>
+		void RadixSort(KeyFunctionType Key) {
+			Sorting::RadixSort(data, data + SIZE, Key);
 		}
 
 		/** Reverses the array. */
@@ -18,7 +18,7 @@ namespace Toolbox {
 		// POINT
 
 		/** Represents a point in space with variable dimensions. */
-		using Point = Point<DIMENSIONS, PrecisionType>;
+		using Point = Toolbox::Point<DIMENSIONS, PrecisionType>;
 
 
 		// DATA
@@ -114,6 +114,18 @@ namespace Toolbox {
 			return true;
 		}
 
+		/** Returns the squared distance from the given point to the closest point within this box, or 0 if the point is within this box. */
+		PrecisionType DistanceSquared(const Point& Point) const {
+			PrecisionType Sum = 0;
+			for (size_t Index = 0; Index < DIMENSIONS; ++Index) {
+				const PrecisionType Delta = std::abs(Point[Index] - Origin[Index]) - HalfSize;
+				if (Delta > 0) {
+					Sum += Delta * Delta;
+				}
+			}
+			return Sum;
+		}
+
 		/**
 		 * Creates a copy of this box divided in the corner based on the given positive dimensions.<br/>
 		 * For example: A 2D box divided with { true, false } will be the bottom right quadrant.
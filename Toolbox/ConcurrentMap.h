@@ -0,0 +1,628 @@
+// .h
+// Concurrent Hash Map and Set Types
+// by Kyle Furey
+
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <shared_mutex>
+#include "Vector.h"
+#include "Set.h"
+#include "Thread.h"
+#include "ConcurrentQueue.h"
+
+// The number of independently locked shards in a concurrent hash table, which must be a power of two.
+#define CONCURRENT_SHARDS 16
+
+// The average number of elements per bucket a shard of a concurrent hash table holds before it grows.
+#define CONCURRENT_LOAD_FACTOR 2
+
+// The number of old buckets a shard moves into its new buckets during each write while it grows.
+#define CONCURRENT_MIGRATE_COUNT 8
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// CONCURRENT SHARD
+
+	/** Returns which shard of a concurrent hash table the given hash belongs to, using the hash's upper bits after mixing. */
+	static size_t ConcurrentShard(const Hash Hash) {
+		static_assert((CONCURRENT_SHARDS & (CONCURRENT_SHARDS - 1)) == 0, "ERROR: The number of concurrent shards must be a power of two!");
+		return static_cast<size_t>((static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ull) >> 40) & (CONCURRENT_SHARDS - 1);
+	}
+
+	/** Returns the smallest power of two number of buckets for each shard of a concurrent hash table with the given total buckets. */
+	static size_t ConcurrentBuckets(const size_t BucketCount) {
+		size_t Buckets = 1;
+		while (Buckets * CONCURRENT_SHARDS < BucketCount) {
+			Buckets <<= 1;
+		}
+		return Buckets;
+	}
+
+
+	// CONCURRENT HASH MAP
+
+	/**
+	 * A collection of key value pairs that many threads can find, insert, update, and remove at once.<br/>
+	 * Pairs are split across CONCURRENT_SHARDS shards that each have a reader writer lock, so readers never wait on each other and writers only wait on their shard.<br/>
+	 * A shard grows incrementally: each write moves only CONCURRENT_MIGRATE_COUNT buckets into the larger table while lookups check both tables.<br/>
+	 * Values are copied out of the map, so no reference to a pair outlives the lock that guarded it.
+	 */
+	template<typename KeyType, typename ValueType, Hash(*HASH_FUNC)(const KeyType&) = Hashify>
+	class ConcurrentMap final {
+		static_assert(HASH_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
+
+		// PAIR
+
+		/** A key value pair with its key's cached hash. */
+		struct Pair final {
+
+			// DATA
+
+			/** The key used to lookup this pair's value. */
+			KeyType key;
+
+			/** The value this pair is storing. */
+			ValueType value;
+
+			/** The hash of this pair's key. */
+			Hash hash;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Pair(const KeyType& Key = KeyType(), const ValueType& Value = ValueType(), const Hash Hash = 0) : key(Key), value(Value), hash(Hash) {
+			}
+		};
+
+
+		// BUCKET
+
+		/** A bucket of pairs whose keys have the same hash index. */
+		using Bucket = Vector<Pair>;
+
+
+		// SHARD
+
+		/** An independently locked part of the map with its own buckets. */
+		struct alignas(CACHE_LINE_SIZE) Shard final {
+
+			// DATA
+
+			/** Guards this shard's buckets. */
+			mutable SharedMutex lock;
+
+			/** The power of two number of buckets this shard stores its pairs in. */
+			Vector<Bucket> buckets;
+
+			/** The buckets this shard is moving its pairs out of while it grows, or empty if it is not growing. */
+			Vector<Bucket> old;
+
+			/** The number of old buckets that have been moved into the new buckets. */
+			size_t migrated;
+
+			/** The number of pairs in this shard. */
+			Atomic<size_t> size;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Shard() : lock(), buckets(), old(), migrated(0), size(0) {
+			}
+		};
+
+
+		// DATA
+
+		/** Each shard of this map. */
+		Shard shards[CONCURRENT_SHARDS];
+
+
+		// LOOKUP
+
+		/** Returns a pointer to the pair with the given key in the given shard, or nullptr if it is not found. */
+		static Pair* Locate(const Shard& Shard, const KeyType& Key, const Hash Hash) {
+			Bucket& Current = const_cast<Bucket&>(Shard.buckets[Hash & (Shard.buckets.Size() - 1)]);
+			for (auto& Pair : Current) {
+				if (Pair.hash == Hash && Pair.key == Key) {
+					return &Pair;
+				}
+			}
+			if (!Shard.old.IsEmpty()) {
+				const size_t Index = Hash & (Shard.old.Size() - 1);
+				if (Index >= Shard.migrated) {
+					Bucket& Old = const_cast<Bucket&>(Shard.old[Index]);
+					for (auto& Pair : Old) {
+						if (Pair.hash == Hash && Pair.key == Key) {
+							return &Pair;
+						}
+					}
+				}
+			}
+			return nullptr;
+		}
+
+		/** Removes the pair with the given key from the given bucket and returns whether it was found. */
+		static bool Remove(Bucket& Bucket, const KeyType& Key, const Hash Hash) {
+			for (size_t Index = 0; Index < Bucket.Size(); ++Index) {
+				if (Bucket[Index].hash == Hash && Bucket[Index].key == Key) {
+					if (Index != Bucket.Size() - 1) {
+						Bucket[Index] = std::move(Bucket.Back());
+					}
+					Bucket.PopBack();
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+		// GROWTH
+
+		/** Moves up to the given number of old buckets in the given locked shard into its new buckets. */
+		static void Migrate(Shard& Shard, const size_t Count) {
+			if (Shard.old.IsEmpty()) {
+				return;
+			}
+			const size_t Mask = Shard.buckets.Size() - 1;
+			for (size_t Moved = 0; Moved < Count && Shard.migrated < Shard.old.Size(); ++Moved) {
+				Bucket& Old = Shard.old[Shard.migrated];
+				for (auto& Pair : Old) {
+					Shard.buckets[Pair.hash & Mask].PushBack(std::move(Pair));
+				}
+				Old.Reset();
+				++Shard.migrated;
+			}
+			if (Shard.migrated == Shard.old.Size()) {
+				Shard.old.Reset();
+				Shard.migrated = 0;
+			}
+		}
+
+		/** Begins growing the given locked shard if it holds too many pairs for its buckets. */
+		static void Grow(Shard& Shard) {
+			if (Shard.size.load(std::memory_order_relaxed) <= Shard.buckets.Size() * CONCURRENT_LOAD_FACTOR) {
+				return;
+			}
+			Migrate(Shard, SIZE_MAX);
+			Shard.old = std::move(Shard.buckets);
+			Shard.buckets = Vector<Bucket>(Shard.old.Size() * 2);
+			Shard.migrated = 0;
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor, which spreads the given number of buckets across each shard. */
+		ConcurrentMap(const size_t BucketCount = CONCURRENT_SHARDS * 4) {
+			const size_t Buckets = ConcurrentBuckets(BucketCount);
+			for (auto& Shard : shards) {
+				Shard.buckets = Vector<Bucket>(Buckets);
+			}
+		}
+
+		/** Delete copy constructor. */
+		ConcurrentMap(const ConcurrentMap& Copied) = delete;
+
+		/** Delete move constructor. */
+		ConcurrentMap(ConcurrentMap&& Moved) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		ConcurrentMap& operator=(const ConcurrentMap& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		ConcurrentMap& operator=(ConcurrentMap&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of pairs in the map, which may already be out of date if other threads are writing. */
+		size_t Size() const {
+			size_t Size = 0;
+			for (auto& Shard : shards) {
+				Size += Shard.size.load(std::memory_order_relaxed);
+			}
+			return Size;
+		}
+
+		/** Returns whether the map is empty, which may already be out of date if other threads are writing. */
+		bool IsEmpty() const {
+			return Size() == 0;
+		}
+
+		/** Copies the value of the given key into the given value and returns whether the key was found. */
+		bool Find(const KeyType& Key, ValueType& Value) const {
+			const Hash Hash = HASH_FUNC(Key);
+			const Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::shared_lock<SharedMutex> Lock(Shard.lock);
+			const Pair* Found = Locate(Shard, Key, Hash);
+			if (Found == nullptr) {
+				return false;
+			}
+			Value = Found->value;
+			return true;
+		}
+
+		/** Returns whether the given key is present in the map. */
+		bool ContainsKey(const KeyType& Key) const {
+			const Hash Hash = HASH_FUNC(Key);
+			const Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::shared_lock<SharedMutex> Lock(Shard.lock);
+			return Locate(Shard, Key, Hash) != nullptr;
+		}
+
+		/** Calls the given function with each key and constant value, locking one shard at a time for reading. */
+		template<typename FunctionType>
+		void ForEach(FunctionType Function) const {
+			for (auto& Shard : shards) {
+				std::shared_lock<SharedMutex> Lock(Shard.lock);
+				for (auto& Bucket : Shard.buckets) {
+					for (auto& Pair : Bucket) {
+						Function(static_cast<const KeyType&>(Pair.key), static_cast<const ValueType&>(Pair.value));
+					}
+				}
+				for (size_t Index = Shard.migrated; Index < Shard.old.Size(); ++Index) {
+					for (auto& Pair : Shard.old[Index]) {
+						Function(static_cast<const KeyType&>(Pair.key), static_cast<const ValueType&>(Pair.value));
+					}
+				}
+			}
+		}
+
+
+		// EXPANSION
+
+		/** Removes each pair from the map. */
+		void Clear() {
+			for (auto& Shard : shards) {
+				std::unique_lock<SharedMutex> Lock(Shard.lock);
+				Migrate(Shard, SIZE_MAX);
+				for (auto& Bucket : Shard.buckets) {
+					Bucket.Reset();
+				}
+				Shard.size.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		/** Inserts a copy of the given value with the given key, or replaces the key's value if it is present, and returns whether the key is new. */
+		bool Insert(const KeyType& Key, const ValueType& Value) {
+			const Hash Hash = HASH_FUNC(Key);
+			Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::unique_lock<SharedMutex> Lock(Shard.lock);
+			Migrate(Shard, CONCURRENT_MIGRATE_COUNT);
+			Pair* Found = Locate(Shard, Key, Hash);
+			if (Found != nullptr) {
+				Found->value = Value;
+				return false;
+			}
+			Shard.buckets[Hash & (Shard.buckets.Size() - 1)].EmplaceBack(Key, Value, Hash);
+			Shard.size.fetch_add(1, std::memory_order_relaxed);
+			Grow(Shard);
+			return true;
+		}
+
+		/** Inserts a copy of the given value with the given key only if the key is not present, and returns whether it was inserted. */
+		bool TryInsert(const KeyType& Key, const ValueType& Value) {
+			const Hash Hash = HASH_FUNC(Key);
+			Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::unique_lock<SharedMutex> Lock(Shard.lock);
+			Migrate(Shard, CONCURRENT_MIGRATE_COUNT);
+			if (Locate(Shard, Key, Hash) != nullptr) {
+				return false;
+			}
+			Shard.buckets[Hash & (Shard.buckets.Size() - 1)].EmplaceBack(Key, Value, Hash);
+			Shard.size.fetch_add(1, std::memory_order_relaxed);
+			Grow(Shard);
+			return true;
+		}
+
+		/**
+		 * Calls the given function with a reference to the given key's value while its shard is locked for writing.<br/>
+		 * Returns whether the key was found. The function must not access this map.
+		 */
+		template<typename FunctionType>
+		bool Update(const KeyType& Key, FunctionType Function) {
+			const Hash Hash = HASH_FUNC(Key);
+			Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::unique_lock<SharedMutex> Lock(Shard.lock);
+			Migrate(Shard, CONCURRENT_MIGRATE_COUNT);
+			Pair* Found = Locate(Shard, Key, Hash);
+			if (Found == nullptr) {
+				return false;
+			}
+			Function(Found->value);
+			return true;
+		}
+
+		/** Removes the given key and its value from the map and returns whether it was found. */
+		bool Erase(const KeyType& Key) {
+			const Hash Hash = HASH_FUNC(Key);
+			Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::unique_lock<SharedMutex> Lock(Shard.lock);
+			Migrate(Shard, CONCURRENT_MIGRATE_COUNT);
+			bool Erased = Remove(Shard.buckets[Hash & (Shard.buckets.Size() - 1)], Key, Hash);
+			if (!Erased && !Shard.old.IsEmpty()) {
+				const size_t Index = Hash & (Shard.old.Size() - 1);
+				Erased = Index >= Shard.migrated && Remove(Shard.old[Index], Key, Hash);
+			}
+			if (Erased) {
+				Shard.size.fetch_sub(1, std::memory_order_relaxed);
+			}
+			return Erased;
+		}
+	};
+
+
+	// CONCURRENT HASH SET
+
+	/**
+	 * A collection of values that many threads can find, insert, and remove at once.<br/>
+	 * Values are split across CONCURRENT_SHARDS shards that each have a reader writer lock, so readers never wait on each other and writers only wait on their shard.<br/>
+	 * A shard grows incrementally: each write moves only CONCURRENT_MIGRATE_COUNT buckets into the larger table while lookups check both tables.
+	 */
+	template<typename Type, Hash(*HASH_FUNC)(const Type&) = Hashify>
+	class ConcurrentSet final {
+		static_assert(HASH_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
+
+		// ELEMENT
+
+		/** A value with its cached hash. */
+		struct Element final {
+
+			// DATA
+
+			/** The value this element is storing. */
+			Type value;
+
+			/** The hash of this element's value. */
+			Hash hash;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Element(const Type& Value = Type(), const Hash Hash = 0) : value(Value), hash(Hash) {
+			}
+		};
+
+
+		// BUCKET
+
+		/** A bucket of values that have the same hash index. */
+		using Bucket = Vector<Element>;
+
+
+		// SHARD
+
+		/** An independently locked part of the set with its own buckets. */
+		struct alignas(CACHE_LINE_SIZE) Shard final {
+
+			// DATA
+
+			/** Guards this shard's buckets. */
+			mutable SharedMutex lock;
+
+			/** The power of two number of buckets this shard stores its values in. */
+			Vector<Bucket> buckets;
+
+			/** The buckets this shard is moving its values out of while it grows, or empty if it is not growing. */
+			Vector<Bucket> old;
+
+			/** The number of old buckets that have been moved into the new buckets. */
+			size_t migrated;
+
+			/** The number of values in this shard. */
+			Atomic<size_t> size;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Shard() : lock(), buckets(), old(), migrated(0), size(0) {
+			}
+		};
+
+
+		// DATA
+
+		/** Each shard of this set. */
+		Shard shards[CONCURRENT_SHARDS];
+
+
+		// LOOKUP
+
+		/** Returns whether the given value is in the given bucket. */
+		static bool Search(const Bucket& Bucket, const Type& Value, const Hash Hash) {
+			for (auto& Element : Bucket) {
+				if (Element.hash == Hash && Element.value == Value) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Returns whether the given value is in the given shard. */
+		static bool Locate(const Shard& Shard, const Type& Value, const Hash Hash) {
+			if (Search(Shard.buckets[Hash & (Shard.buckets.Size() - 1)], Value, Hash)) {
+				return true;
+			}
+			if (!Shard.old.IsEmpty()) {
+				const size_t Index = Hash & (Shard.old.Size() - 1);
+				return Index >= Shard.migrated && Search(Shard.old[Index], Value, Hash);
+			}
+			return false;
+		}
+
+		/** Removes the given value from the given bucket and returns whether it was found. */
+		static bool Remove(Bucket& Bucket, const Type& Value, const Hash Hash) {
+			for (size_t Index = 0; Index < Bucket.Size(); ++Index) {
+				if (Bucket[Index].hash == Hash && Bucket[Index].value == Value) {
+					if (Index != Bucket.Size() - 1) {
+						Bucket[Index] = std::move(Bucket.Back());
+					}
+					Bucket.PopBack();
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+		// GROWTH
+
+		/** Moves up to the given number of old buckets in the given locked shard into its new buckets. */
+		static void Migrate(Shard& Shard, const size_t Count) {
+			if (Shard.old.IsEmpty()) {
+				return;
+			}
+			const size_t Mask = Shard.buckets.Size() - 1;
+			for (size_t Moved = 0; Moved < Count && Shard.migrated < Shard.old.Size(); ++Moved) {
+				Bucket& Old = Shard.old[Shard.migrated];
+				for (auto& Element : Old) {
+					Shard.buckets[Element.hash & Mask].PushBack(std::move(Element));
+				}
+				Old.Reset();
+				++Shard.migrated;
+			}
+			if (Shard.migrated == Shard.old.Size()) {
+				Shard.old.Reset();
+				Shard.migrated = 0;
+			}
+		}
+
+		/** Begins growing the given locked shard if it holds too many values for its buckets. */
+		static void Grow(Shard& Shard) {
+			if (Shard.size.load(std::memory_order_relaxed) <= Shard.buckets.Size() * CONCURRENT_LOAD_FACTOR) {
+				return;
+			}
+			Migrate(Shard, SIZE_MAX);
+			Shard.old = std::move(Shard.buckets);
+			Shard.buckets = Vector<Bucket>(Shard.old.Size() * 2);
+			Shard.migrated = 0;
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor, which spreads the given number of buckets across each shard. */
+		ConcurrentSet(const size_t BucketCount = CONCURRENT_SHARDS * 4) {
+			const size_t Buckets = ConcurrentBuckets(BucketCount);
+			for (auto& Shard : shards) {
+				Shard.buckets = Vector<Bucket>(Buckets);
+			}
+		}
+
+		/** Delete copy constructor. */
+		ConcurrentSet(const ConcurrentSet& Copied) = delete;
+
+		/** Delete move constructor. */
+		ConcurrentSet(ConcurrentSet&& Moved) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		ConcurrentSet& operator=(const ConcurrentSet& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		ConcurrentSet& operator=(ConcurrentSet&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of values in the set, which may already be out of date if other threads are writing. */
+		size_t Size() const {
+			size_t Size = 0;
+			for (auto& Shard : shards) {
+				Size += Shard.size.load(std::memory_order_relaxed);
+			}
+			return Size;
+		}
+
+		/** Returns whether the set is empty, which may already be out of date if other threads are writing. */
+		bool IsEmpty() const {
+			return Size() == 0;
+		}
+
+		/** Returns whether the given value is present in the set. */
+		bool Contains(const Type& Value) const {
+			const Hash Hash = HASH_FUNC(Value);
+			const Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::shared_lock<SharedMutex> Lock(Shard.lock);
+			return Locate(Shard, Value, Hash);
+		}
+
+		/** Calls the given function with each constant value, locking one shard at a time for reading. */
+		template<typename FunctionType>
+		void ForEach(FunctionType Function) const {
+			for (auto& Shard : shards) {
+				std::shared_lock<SharedMutex> Lock(Shard.lock);
+				for (auto& Bucket : Shard.buckets) {
+					for (auto& Element : Bucket) {
+						Function(static_cast<const Type&>(Element.value));
+					}
+				}
+				for (size_t Index = Shard.migrated; Index < Shard.old.Size(); ++Index) {
+					for (auto& Element : Shard.old[Index]) {
+						Function(static_cast<const Type&>(Element.value));
+					}
+				}
+			}
+		}
+
+
+		// EXPANSION
+
+		/** Removes each value from the set. */
+		void Clear() {
+			for (auto& Shard : shards) {
+				std::unique_lock<SharedMutex> Lock(Shard.lock);
+				Migrate(Shard, SIZE_MAX);
+				for (auto& Bucket : Shard.buckets) {
+					Bucket.Reset();
+				}
+				Shard.size.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		/** Inserts a copy of the given value into the set and returns whether a new value was inserted. */
+		bool Insert(const Type& Value) {
+			const Hash Hash = HASH_FUNC(Value);
+			Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::unique_lock<SharedMutex> Lock(Shard.lock);
+			Migrate(Shard, CONCURRENT_MIGRATE_COUNT);
+			if (Locate(Shard, Value, Hash)) {
+				return false;
+			}
+			Shard.buckets[Hash & (Shard.buckets.Size() - 1)].EmplaceBack(Value, Hash);
+			Shard.size.fetch_add(1, std::memory_order_relaxed);
+			Grow(Shard);
+			return true;
+		}
+
+		/** Removes the given value from the set and returns whether it was found. */
+		bool Erase(const Type& Value) {
+			const Hash Hash = HASH_FUNC(Value);
+			Shard& Shard = shards[ConcurrentShard(Hash)];
+			std::unique_lock<SharedMutex> Lock(Shard.lock);
+			Migrate(Shard, CONCURRENT_MIGRATE_COUNT);
+			bool Erased = Remove(Shard.buckets[Hash & (Shard.buckets.Size() - 1)], Value, Hash);
+			if (!Erased && !Shard.old.IsEmpty()) {
+				const size_t Index = Hash & (Shard.old.Size() - 1);
+				Erased = Index >= Shard.migrated && Remove(Shard.old[Index], Value, Hash);
+			}
+			if (Erased) {
+				Shard.size.fetch_sub(1, std::memory_order_relaxed);
+			}
+			return Erased;
+		}
+	};
+}
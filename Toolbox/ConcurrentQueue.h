@@ -0,0 +1,388 @@
+// .h
+// Concurrent Queue Types
+// by Kyle Furey
+
+#pragma once
+#include <new>
+#include <utility>
+#include <stdexcept>
+#include "Thread.h"
+
+// The assumed size of a cache line, used to keep indices written by different threads from sharing one.
+#define CACHE_LINE_SIZE 64
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// CONCURRENT QUEUE CAPACITY
+
+	/** Returns the smallest power of two that is greater than or equal to the given concurrent queue capacity. */
+	static size_t ConcurrentCapacity(const size_t Capacity) {
+		if (Capacity < 2) {
+			throw std::runtime_error("ERROR: A concurrent queue must have a capacity of at least 2!");
+		}
+		size_t Power = 2;
+		while (Power < Capacity) {
+			Power <<= 1;
+		}
+		return Power;
+	}
+
+
+	// SINGLE PRODUCER SINGLE CONSUMER QUEUE
+
+	/**
+	 * A bounded, lock-free first in first out queue for exactly one producer thread and one consumer thread.<br/>
+	 * Each side caches the other side's index so most operations touch only memory owned by the calling thread.
+	 */
+	template<typename Type>
+	class SPSCQueue final {
+
+		// DATA
+
+		/** The index of the next element to pop, written only by the consumer. */
+		alignas(CACHE_LINE_SIZE) Atomic<size_t> head;
+
+		/** The consumer's cached copy of the producer's index. */
+		size_t cachedTail;
+
+		/** The index of the next element to push, written only by the producer. */
+		alignas(CACHE_LINE_SIZE) Atomic<size_t> tail;
+
+		/** The producer's cached copy of the consumer's index. */
+		size_t cachedHead;
+
+		/** The power of two number of elements this queue can hold minus one. */
+		alignas(CACHE_LINE_SIZE) size_t mask;
+
+		/** The uninitialized memory of each element. */
+		Type* data;
+
+
+		// SLOTS
+
+		/** Returns whether the producer can push the given number of elements, refreshing its cached index if needed. */
+		bool CanPush(const size_t Tail, const size_t Count) {
+			if (Tail - cachedHead + Count <= mask + 1) {
+				return true;
+			}
+			cachedHead = head.load(std::memory_order_acquire);
+			return Tail - cachedHead + Count <= mask + 1;
+		}
+
+		/** Returns the number of elements the consumer can pop, refreshing its cached index if needed. */
+		size_t CanPop(const size_t Head) {
+			if (cachedTail == Head) {
+				cachedTail = tail.load(std::memory_order_acquire);
+			}
+			return cachedTail - Head;
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Capacity constructor (the capacity is rounded up to a power of two). */
+		explicit SPSCQueue(const size_t Capacity = 1024) : head(0), cachedTail(0), tail(0), cachedHead(0), mask(ConcurrentCapacity(Capacity) - 1), data(nullptr) {
+			data = static_cast<Type*>(::operator new(sizeof(Type) * (mask + 1), std::align_val_t(alignof(Type))));
+		}
+
+		/** Delete copy constructor. */
+		SPSCQueue(const SPSCQueue&) = delete;
+
+		/** Delete move constructor. */
+		SPSCQueue(SPSCQueue&&) noexcept = delete;
+
+		/** Destructor. */
+		~SPSCQueue() {
+			for (size_t Index = head.load(); Index != tail.load(); ++Index) {
+				data[Index & mask].~Type();
+			}
+			::operator delete(data, std::align_val_t(alignof(Type)));
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+		/** Delete move assignment operator. */
+		SPSCQueue& operator=(SPSCQueue&&) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the maximum number of elements in the queue. */
+		size_t Capacity() const {
+			return mask + 1;
+		}
+
+		/** Returns an estimate of the number of elements in the queue. */
+		size_t Size() const {
+			const size_t Head = head.load(std::memory_order_acquire);
+			const size_t Tail = tail.load(std::memory_order_acquire);
+			return Tail - Head;
+		}
+
+		/** Returns an estimate of whether the queue is empty. */
+		bool IsEmpty() const {
+			return Size() == 0;
+		}
+
+
+		// PRODUCER
+
+		/** Constructs a new element at the back of the queue and returns whether the queue had room (producer only). */
+		template<typename... ArgumentTypes>
+		bool TryEmplace(ArgumentTypes&&... Arguments) {
+			const size_t Tail = tail.load(std::memory_order_relaxed);
+			if (!CanPush(Tail, 1)) {
+				return false;
+			}
+			new(&data[Tail & mask]) Type(std::forward<ArgumentTypes>(Arguments)...);
+			tail.store(Tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/** Pushes a copy of the given value to the back of the queue and returns whether the queue had room (producer only). */
+		bool TryPush(const Type& Value) {
+			return TryEmplace(Value);
+		}
+
+		/** Moves the given value to the back of the queue and returns whether the queue had room (producer only). */
+		bool TryPush(Type&& Value) {
+			return TryEmplace(std::move(Value));
+		}
+
+		/** Pushes copies of as many of the given elements as fit and returns the number pushed (producer only). */
+		size_t TryPushRange(const Type* Array, size_t Count) {
+			const size_t Tail = tail.load(std::memory_order_relaxed);
+			if (!CanPush(Tail, Count)) {
+				const size_t Free = mask + 1 - (Tail - cachedHead);
+				Count = Count < Free ? Count : Free;
+			}
+			for (size_t Index = 0; Index < Count; ++Index) {
+				new(&data[(Tail + Index) & mask]) Type(Array[Index]);
+			}
+			tail.store(Tail + Count, std::memory_order_release);
+			return Count;
+		}
+
+
+		// CONSUMER
+
+		/** Moves the element at the front of the queue into the given value and returns whether the queue had an element (consumer only). */
+		bool TryPop(Type& Value) {
+			const size_t Head = head.load(std::memory_order_relaxed);
+			if (CanPop(Head) == 0) {
+				return false;
+			}
+			Type& Element = data[Head & mask];
+			Value = std::move(Element);
+			Element.~Type();
+			head.store(Head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/** Moves up to the given number of elements from the front of the queue into the given array and returns the number popped (consumer only). */
+		size_t TryPopInto(Type* Array, size_t Count) {
+			const size_t Head = head.load(std::memory_order_relaxed);
+			const size_t Available = CanPop(Head);
+			Count = Count < Available ? Count : Available;
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Type& Element = data[(Head + Index) & mask];
+				Array[Index] = std::move(Element);
+				Element.~Type();
+			}
+			head.store(Head + Count, std::memory_order_release);
+			return Count;
+		}
+	};
+
+
+	// MULTIPLE PRODUCER MULTIPLE CONSUMER QUEUE
+
+	/**
+	 * A bounded, lock-free first in first out queue for any number of producer and consumer threads.<br/>
+	 * Each slot stores a sequence number that tells producers and consumers whose turn it is, so threads only contend on the two indices.
+	 */
+	template<typename Type>
+	class MPMCQueue final {
+
+		// CELL
+
+		/** A single slot in the queue. */
+		struct Cell final {
+
+			// DATA
+
+			/** The position this cell is ready to be pushed to, or one past the position it is ready to be popped from. */
+			Atomic<size_t> sequence;
+
+			/** The uninitialized memory of this cell's element. */
+			alignas(Type) unsigned char memory[sizeof(Type)];
+
+
+			// ELEMENT
+
+			/** Returns a reference to this cell's element. */
+			Type& Element() {
+				return *std::launder(reinterpret_cast<Type*>(memory));
+			}
+		};
+
+
+		// DATA
+
+		/** The position of the next element to push. */
+		alignas(CACHE_LINE_SIZE) Atomic<size_t> tail;
+
+		/** The position of the next element to pop. */
+		alignas(CACHE_LINE_SIZE) Atomic<size_t> head;
+
+		/** The power of two number of elements this queue can hold minus one. */
+		alignas(CACHE_LINE_SIZE) size_t mask;
+
+		/** Each cell of the queue. */
+		Cell* cells;
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Capacity constructor (the capacity is rounded up to a power of two). */
+		explicit MPMCQueue(const size_t Capacity = 1024) : tail(0), head(0), mask(ConcurrentCapacity(Capacity) - 1), cells(nullptr) {
+			cells = new Cell[mask + 1];
+			for (size_t Index = 0; Index <= mask; ++Index) {
+				cells[Index].sequence.store(Index, std::memory_order_relaxed);
+			}
+		}
+
+		/** Delete copy constructor. */
+		MPMCQueue(const MPMCQueue&) = delete;
+
+		/** Delete move constructor. */
+		MPMCQueue(MPMCQueue&&) noexcept = delete;
+
+		/** Destructor. */
+		~MPMCQueue() {
+			for (size_t Index = head.load(); Index != tail.load(); ++Index) {
+				cells[Index & mask].Element().~Type();
+			}
+			delete[] cells;
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+		/** Delete move assignment operator. */
+		MPMCQueue& operator=(MPMCQueue&&) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the maximum number of elements in the queue. */
+		size_t Capacity() const {
+			return mask + 1;
+		}
+
+		/** Returns an estimate of the number of elements in the queue. */
+		size_t Size() const {
+			const size_t Head = head.load(std::memory_order_acquire);
+			const size_t Tail = tail.load(std::memory_order_acquire);
+			return Tail > Head ? Tail - Head : 0;
+		}
+
+		/** Returns an estimate of whether the queue is empty. */
+		bool IsEmpty() const {
+			return Size() == 0;
+		}
+
+
+		// PRODUCERS
+
+		/** Constructs a new element at the back of the queue and returns whether the queue had room. */
+		template<typename... ArgumentTypes>
+		bool TryEmplace(ArgumentTypes&&... Arguments) {
+			size_t Position = tail.load(std::memory_order_relaxed);
+			while (true) {
+				Cell& Cell = cells[Position & mask];
+				const size_t Sequence = Cell.sequence.load(std::memory_order_acquire);
+				const ptrdiff_t Difference = static_cast<ptrdiff_t>(Sequence) - static_cast<ptrdiff_t>(Position);
+				if (Difference == 0) {
+					if (tail.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed)) {
+						new(Cell.memory) Type(std::forward<ArgumentTypes>(Arguments)...);
+						Cell.sequence.store(Position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (Difference < 0) {
+					return false;
+				}
+				else {
+					Position = tail.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/** Pushes a copy of the given value to the back of the queue and returns whether the queue had room. */
+		bool TryPush(const Type& Value) {
+			return TryEmplace(Value);
+		}
+
+		/** Moves the given value to the back of the queue and returns whether the queue had room. */
+		bool TryPush(Type&& Value) {
+			return TryEmplace(std::move(Value));
+		}
+
+		/** Pushes copies of the given elements in order until the queue is full and returns the number pushed. */
+		size_t TryPushRange(const Type* Array, const size_t Count) {
+			size_t Pushed = 0;
+			while (Pushed < Count && TryEmplace(Array[Pushed])) {
+				++Pushed;
+			}
+			return Pushed;
+		}
+
+
+		// CONSUMERS
+
+		/** Moves the element at the front of the queue into the given value and returns whether the queue had an element. */
+		bool TryPop(Type& Value) {
+			size_t Position = head.load(std::memory_order_relaxed);
+			while (true) {
+				Cell& Cell = cells[Position & mask];
+				const size_t Sequence = Cell.sequence.load(std::memory_order_acquire);
+				const ptrdiff_t Difference = static_cast<ptrdiff_t>(Sequence) - static_cast<ptrdiff_t>(Position + 1);
+				if (Difference == 0) {
+					if (head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed)) {
+						Type& Element = Cell.Element();
+						Value = std::move(Element);
+						Element.~Type();
+						Cell.sequence.store(Position + mask + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (Difference < 0) {
+					return false;
+				}
+				else {
+					Position = head.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/** Moves up to the given number of elements from the front of the queue into the given array and returns the number popped. */
+		size_t TryPopInto(Type* Array, const size_t Count) {
+			size_t Popped = 0;
+			while (Popped < Count && TryPop(Array[Popped])) {
+				++Popped;
+			}
+			return Popped;
+		}
+	};
+}
@@ -3,12 +3,12 @@
 // by Kyle Furey
 
 #pragma once
+#include <version>
 #include <chrono>
 #include <thread>
 #include <atomic>
 
 // Check for whether coroutines are supported.
-#pragma region INCLUDE_COROUTINE
 #if defined(__cpp_lib_coroutine) && (defined(__cpp_impl_coroutine) || defined(__cpp_coroutines))
 #include <coroutine>
 namespace coroutine = std;
@@ -24,8 +24,8 @@ namespace coroutine = std::experimental;
 // Whether coroutines are compiled.
 #define COROUTINES_COMPILED 0
 #endif
-#pragma endregion
 #include "Nullable.h"
+#include "Thread.h"
 
 #if COROUTINES_COMPILED
 
@@ -35,6 +35,144 @@ namespace coroutine = std::experimental;
 /** A collection of useful template types in C++. */
 namespace Toolbox {
 
+	// PROMISE TYPE
+
+	/** An interface that allows a function to be paused and be resumed later. */
+	template<typename GeneratorType, typename ReturnType>
+	struct PromiseType;
+
+
+	// SCHEDULER
+
+	/**
+	 * An interface for objects that resume suspended coroutines, such as an executor.<br/>
+	 * Tasks and delays awaited while a scheduler is resuming the current thread's coroutine are resumed by that scheduler instead of by a new thread.
+	 */
+	class Scheduler {
+
+		// FRIENDS
+
+		template<typename GeneratorType, typename ReturnType>
+		friend struct PromiseType;
+
+		friend struct FinalAwaiter;
+
+		// DATA
+
+		/** The scheduler resuming the current thread's coroutine, if any. */
+		static inline thread_local Scheduler* current = nullptr;
+
+		/** The scheduler the next void coroutine created on the current thread is adopted by, if any. */
+		static inline thread_local Scheduler* adopting = nullptr;
+
+	protected:
+
+		// ADOPTION
+
+		/** Adopts the next void coroutine created on the current thread into the given scheduler, which is told when the coroutine is created and when it ends. */
+		static void Adopt(Scheduler* Owner) {
+			adopting = Owner;
+		}
+
+		/** Called when a void coroutine is adopted by this scheduler. */
+		virtual void Adopted(coroutine::coroutine_handle<>) {
+		}
+
+		/** Called when a void coroutine adopted by this scheduler ends, which destroys the coroutine. */
+		virtual void Ended(coroutine::coroutine_handle<> Coroutine) {
+			Coroutine.destroy();
+		}
+
+		/** Sets the scheduler resuming the current thread's coroutine and returns the previous one. */
+		static Scheduler* SetCurrent(Scheduler* Scheduler) {
+			Toolbox::Scheduler* Previous = current;
+			current = Scheduler;
+			return Previous;
+		}
+
+	public:
+
+		// DESTRUCTOR
+
+		/** Virtual destructor. */
+		virtual ~Scheduler() = default;
+
+
+		// SCHEDULING
+
+		/** Returns the scheduler resuming the current thread's coroutine, or nullptr if there is none. */
+		static Scheduler* Current() {
+			return current;
+		}
+
+		/** Resumes the given suspended coroutine as soon as possible. */
+		virtual void Schedule(coroutine::coroutine_handle<> Coroutine) = 0;
+
+		/** Resumes the given suspended coroutine after the given number of milliseconds. */
+		virtual void ScheduleAfter(coroutine::coroutine_handle<> Coroutine, const size_t Milliseconds) = 0;
+	};
+
+
+	// READY AWAITER
+
+	/** Suspends a coroutine and then sets the given signal, so a thread woken by the signal may safely resume or destroy the coroutine. */
+	struct ReadyAwaiter final {
+
+		// DATA
+
+		/** The signal set once the coroutine is suspended. */
+		Signal* Ready;
+
+
+		// INTERFACE
+
+		/** Returns whether the coroutine should not suspend. */
+		bool await_ready() const noexcept {
+			return false;
+		}
+
+		/** Called once the coroutine is suspended. */
+		void await_suspend(coroutine::coroutine_handle<>) const noexcept {
+			Ready->Set();
+		}
+
+		/** Called when the coroutine is resumed. */
+		void await_resume() const noexcept {
+		}
+	};
+
+
+	// FINAL AWAITER
+
+	/** Suspends a finished void coroutine, and hands it to the scheduler that owns it to be destroyed if it is owned by one. */
+	struct FinalAwaiter final {
+
+		// DATA
+
+		/** The scheduler the coroutine is owned by, or nullptr if an async generator owns it. */
+		Scheduler* Owner;
+
+
+		// INTERFACE
+
+		/** Returns whether the coroutine should not suspend. */
+		bool await_ready() const noexcept {
+			return false;
+		}
+
+		/** Called once the coroutine is suspended. */
+		void await_suspend(coroutine::coroutine_handle<> Coroutine) const noexcept {
+			if (Owner != nullptr) {
+				Owner->Ended(Coroutine);
+			}
+		}
+
+		/** Called when the coroutine is resumed. */
+		void await_resume() const noexcept {
+		}
+	};
+
+
 	// PROMISE TYPES
 
 	/** An interface that allows a function to be paused and be resumed later. */
@@ -46,11 +184,14 @@ namespace Toolbox {
 		/** The value this promise type is currently storing for return. */
 		Nullable<ReturnType> Value;
 
+		/** Set whenever this promise stores a new value or finishes, waking threads waiting for its next value. */
+		Signal Ready;
+
 
 		// CONSTRUCTOR AND DESTRUCTOR
 
 		/** Default constructor. */
-		PromiseType() : Value(nullptr) {
+		PromiseType() : Value(nullptr), Ready() {
 		}
 
 		/** Virtual destructor. */
@@ -61,7 +202,7 @@ namespace Toolbox {
 
 		/** Returns the parent coroutine. */
 		virtual GeneratorType get_return_object() {
-			return { coroutine::coroutine_handle<GeneratorType::promise_type>::from_promise(*this) };
+			return { coroutine::coroutine_handle<typename GeneratorType::promise_type>::from_promise(*this) };
 		}
 
 		/** Called when the coroutine first starts. */
@@ -70,14 +211,14 @@ namespace Toolbox {
 		}
 
 		/** Called when the coroutine is about to end. */
-		virtual coroutine::suspend_always final_suspend() noexcept {
-			return {};
+		virtual ReadyAwaiter final_suspend() noexcept {
+			return { &Ready };
 		}
 
 		/** Called when the coroutine yields a new value. */
-		virtual coroutine::suspend_always yield_value(const ReturnType& Value) {
+		virtual ReadyAwaiter yield_value(const ReturnType& Value) {
 			this->Value.Set(Value);
-			return {};
+			return { &Ready };
 		}
 
 		/** Called when the coroutine returns its value. */
@@ -95,7 +236,21 @@ namespace Toolbox {
 	template<typename GeneratorType>
 	struct PromiseType<GeneratorType, void> {
 
-		// DESTRUCTOR
+		// DATA
+
+		/** The scheduler that owns this coroutine, or nullptr if an async generator owns it. */
+		Scheduler* Owner;
+
+
+		// CONSTRUCTOR AND DESTRUCTOR
+
+		/** Default constructor, which is adopted by the current thread's scheduler if it is spawning a coroutine. */
+		PromiseType() : Owner(Scheduler::adopting) {
+			if (Owner != nullptr) {
+				Scheduler::adopting = nullptr;
+				Owner->Adopted(coroutine::coroutine_handle<typename GeneratorType::promise_type>::from_promise(*this));
+			}
+		}
 
 		/** Virtual destructor. */
 		virtual ~PromiseType() = default;
@@ -105,7 +260,7 @@ namespace Toolbox {
 
 		/** Returns the parent coroutine. */
 		virtual GeneratorType get_return_object() {
-			return { coroutine::coroutine_handle<GeneratorType::promise_type>::from_promise(*this) };
+			return { coroutine::coroutine_handle<typename GeneratorType::promise_type>::from_promise(*this) };
 		}
 
 		/** Called when the coroutine first starts. */
@@ -114,8 +269,8 @@ namespace Toolbox {
 		}
 
 		/** Called when the coroutine is about to end. */
-		virtual coroutine::suspend_always final_suspend() noexcept {
-			return {};
+		virtual FinalAwaiter final_suspend() noexcept {
+			return { Owner };
 		}
 
 		/** Called when the coroutine yields. */
@@ -145,20 +300,29 @@ namespace Toolbox {
 		/** The value representing the result of this task. */
 		ReturnType Value;
 
-		/** A flag representing whether the task is complete and therefore when the coroutine should continue. */
-		std::atomic<Predicate> Complete;
+	private:
+
+		// DATA
+
+		/** A flag representing whether the task is complete, which is only set by Finish() so an awaiting coroutine is always resumed. */
+		std::atomic<Predicate> complete;
+
+		/** Whether the task is idle (0), awaited on a scheduler (1), or finished (2). */
+		Atomic<int> state;
+
+		/** The coroutine awaiting this task on a scheduler. */
+		coroutine::coroutine_handle<> waiting;
+
+		/** The scheduler that resumes the coroutine awaiting this task. */
+		Scheduler* scheduler;
+
+	public:
 
 
 		// CONSTRUCTORS
 
 		/** Default constructor. */
-		Task() : Complete(false), Value() {
-		}
-
-		/** Flag constructor. */
-		Task(std::atomic<Predicate>*& OutFlag, ReturnType*& OutValue) : Complete(false), Value() {
-			OutFlag = &Complete;
-			OutValue = &Value;
+		Task() : Value(), complete(false), state(0), waiting(), scheduler(nullptr) {
 		}
 
 		/** Delete copy constructor. */
@@ -177,32 +341,74 @@ namespace Toolbox {
 		Task& operator=(Task&&) noexcept = delete;
 
 
+		// GETTERS
+
+		/** Returns whether the task has been completed by Finish(). */
+		bool IsComplete() const {
+			return static_cast<bool>(complete.load());
+		}
+
+
 		// INTERFACE
 
-		/** Returns whether the task should not start. */
+		/** Returns whether the task is already finished and the coroutine should not suspend. */
 		virtual bool await_ready() {
-			return false;
+			return state.load() == 2;
 		}
 
-		/** Called when the task is awaited, blocking execution until it completes. */
+		/**
+		 * Called when the task is awaited, parking the coroutine until Finish() is called.<br/>
+		 * Coroutines resumed by a scheduler are scheduled on it again, otherwise the thread calling Finish() resumes them directly.
+		 */
 		virtual void await_suspend(coroutine::coroutine_handle<> Coroutine) {
 			if (!Coroutine) {
 				return;
 			}
-			std::thread([this, Coroutine] {
-				while (!Complete.load()) {
-					std::this_thread::yield();
+			Scheduler* Current = Scheduler::Current();
+			waiting = Coroutine;
+			scheduler = Current;
+			int Idle = 0;
+			if (!state.compare_exchange_strong(Idle, 1)) {
+				if (Current != nullptr) {
+					Current->Schedule(Coroutine);
 				}
-				if (Coroutine) {
+				else {
 					Coroutine.resume();
 				}
-				}).detach();
+			}
 		}
 
 		/** Called when the task is completed and returns its value. */
 		virtual ReturnType await_resume() {
 			return Value;
 		}
+
+
+		// COMPLETION
+
+		/**
+		 * Completes this task and schedules or resumes the coroutine awaiting it, if any.<br/>
+		 * The awaiting coroutine may continue and destroy this task as soon as its state is finished, so nothing is touched afterwards.
+		 */
+		void Finish() {
+			complete.store(true);
+			if (state.exchange(2) == 1) {
+				Scheduler* Resumer = scheduler;
+				const coroutine::coroutine_handle<> Waiting = waiting;
+				if (Resumer != nullptr) {
+					Resumer->Schedule(Waiting);
+				}
+				else {
+					Waiting.resume();
+				}
+			}
+		}
+
+		/** Stores the given result, completes this task, and schedules the coroutine awaiting it, if any. */
+		void Finish(const ReturnType& Result) {
+			Value = Result;
+			Finish();
+		}
 	};
 
 	/* An interface that allows a coroutine to be suspended until the task is completed when awaited. */
@@ -211,19 +417,29 @@ namespace Toolbox {
 
 		// DATA
 
-		/** A flag representing whether the task is complete and therefore when the coroutine should continue. */
-		std::atomic<Predicate> Complete;
+	private:
+
+		// DATA
+
+		/** A flag representing whether the task is complete, which is only set by Finish() so an awaiting coroutine is always resumed. */
+		std::atomic<Predicate> complete;
+
+		/** Whether the task is idle (0), awaited on a scheduler (1), or finished (2). */
+		Atomic<int> state;
+
+		/** The coroutine awaiting this task on a scheduler. */
+		coroutine::coroutine_handle<> waiting;
+
+		/** The scheduler that resumes the coroutine awaiting this task. */
+		Scheduler* scheduler;
+
+	public:
 
 
 		// CONSTRUCTORS
 
 		/** Default constructor. */
-		Task() : Complete(false) {
-		}
-
-		/** Flag constructor. */
-		Task(std::atomic<Predicate>*& OutFlag) : Complete(false) {
-			OutFlag = &Complete;
+		Task() : complete(false), state(0), waiting(), scheduler(nullptr) {
 		}
 
 		/** Delete copy constructor. */
@@ -242,31 +458,67 @@ namespace Toolbox {
 		Task& operator=(Task&&) noexcept = delete;
 
 
+		// GETTERS
+
+		/** Returns whether the task has been completed by Finish(). */
+		bool IsComplete() const {
+			return static_cast<bool>(complete.load());
+		}
+
+
 		// INTERFACE
 
-		/** Returns whether the task should not start. */
+		/** Returns whether the task is already finished and the coroutine should not suspend. */
 		virtual bool await_ready() {
-			return false;
+			return state.load() == 2;
 		}
 
-		/** Called when the task is awaited, blocking execution until it completes. */
+		/**
+		 * Called when the task is awaited, parking the coroutine until Finish() is called.<br/>
+		 * Coroutines resumed by a scheduler are scheduled on it again, otherwise the thread calling Finish() resumes them directly.
+		 */
 		virtual void await_suspend(coroutine::coroutine_handle<> Coroutine) {
 			if (!Coroutine) {
 				return;
 			}
-			std::thread([this, Coroutine] {
-				while (!Complete.load()) {
-					std::this_thread::yield();
+			Scheduler* Current = Scheduler::Current();
+			waiting = Coroutine;
+			scheduler = Current;
+			int Idle = 0;
+			if (!state.compare_exchange_strong(Idle, 1)) {
+				if (Current != nullptr) {
+					Current->Schedule(Coroutine);
 				}
-				if (Coroutine) {
+				else {
 					Coroutine.resume();
 				}
-				}).detach();
+			}
 		}
 
 		/** Called when the task is completed. */
 		virtual void await_resume() {
 		}
+
+
+		// COMPLETION
+
+		/**
+		 * Completes this task and schedules or resumes the coroutine awaiting it, if any.<br/>
+		 * The awaiting coroutine may continue and destroy this task as soon as its state is finished, so nothing is touched afterwards.
+		 */
+		void Finish() {
+			complete.store(true);
+			if (state.exchange(2) == 1) {
+				Scheduler* Resumer = scheduler;
+				const coroutine::coroutine_handle<> Waiting = waiting;
+				if (Resumer != nullptr) {
+					Resumer->Schedule(Waiting);
+				}
+				else {
+					Waiting.resume();
+				}
+			}
+		}
 	};
 
 
@@ -292,11 +544,21 @@ namespace Toolbox {
 
 		// TASK
 
-		/** Called when the task is awaited, blocking execution until it completes. */
+		/** Returns whether the delay is already over and the coroutine should not suspend. */
+		bool await_ready() override final {
+			return milliseconds == 0;
+		}
+
+		/** Called when the task is awaited, parking the coroutine on the current scheduler's timers or a sleeping thread until the delay is over. */
 		void await_suspend(coroutine::coroutine_handle<> Coroutine) override final {
 			if (!Coroutine) {
 				return;
 			}
+			Scheduler* Current = Scheduler::Current();
+			if (Current != nullptr) {
+				Current->ScheduleAfter(Coroutine, milliseconds);
+				return;
+			}
 			std::thread([this, Coroutine] {
 				std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
 				if (Coroutine) {
@@ -398,17 +660,30 @@ namespace Toolbox {
 			return coroutine.promise().Value.Release();
 		}
 
-		/** Continues the coroutine and returns a reference to this async generator's new value when it is ready. */
+		/**
+		 * Continues the coroutine and returns a reference to this async generator's new value when it is ready.<br/>
+		 * This waits until the coroutine has suspended with a value before resuming it and again before returning, since values are stored before the coroutine finishes suspending.
+		 */
 		Type Next() {
+			if (coroutine) {
+				coroutine.promise().Ready.Wait();
+				coroutine.promise().Ready.Reset();
+			}
 			if (!Resume()) {
 				throw std::runtime_error("ERROR: Attempted to fetch the next value of a completed coroutine!");
 			}
-			while (!IsValueReady()) {
-				std::this_thread::yield();
-			}
+			coroutine.promise().Ready.Wait();
 			return Get();
 		}
 
+		/** Waits until the coroutine has suspended with its current value or the given number of milliseconds pass, and returns whether it suspended. */
+		bool WaitFor(const size_t Milliseconds) {
+			if (!coroutine) {
+				return false;
+			}
+			return coroutine.promise().Ready.WaitFor(Milliseconds);
+		}
+
 		/** Returns whether the coroutine successfully completed. */
 		bool IsComplete() const {
 			if (!coroutine) {
@@ -417,12 +692,12 @@ namespace Toolbox {
 			return coroutine.done();
 		}
 
-		/** Returns whether the async generator's current value is ready. */
+		/** Returns whether the async generator's current value is ready, which is only read once the coroutine has suspended. */
 		bool IsValueReady() const {
 			if (!coroutine) {
 				return false;
 			}
-			return coroutine.promise().Value.IsValid();
+			return coroutine.promise().Ready.IsSet() && coroutine.promise().Value.IsValid();
 		}
 	};
 
@@ -517,6 +792,13 @@ namespace Toolbox {
 			}
 			return coroutine.done();
 		}
+
+		/** Releases ownership of the underlying coroutine and returns its handle, which is no longer destroyed by this async generator. */
+		handle_type Release() {
+			handle_type Released = coroutine;
+			coroutine = {};
+			return Released;
+		}
 	};
 }
 
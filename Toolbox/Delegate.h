@@ -3,11 +3,20 @@
 // by Kyle Furey
 
 #pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
 #include "Vector.h"
 
 // Whether delegates should throw an exception when invoked with a null function.
 #define THROW_ON_NULL_INVOKE 1
 
+// The number of bytes a callable stores inline before allocating its function object.
+#define DELEGATE_INLINE_SIZE (sizeof(void*) * 3)
+
+// The handle returned when a binding fails.
+#define INVALID_DELEGATE_HANDLE SIZE_MAX
+
 /** A collection of useful template types in C++. */
 namespace Toolbox {
 
@@ -18,9 +27,295 @@ namespace Toolbox {
 	using Function = ReturnType(*)(ArgumentTypes...);
 
 
+	// CALLABLE
+
+	/**
+	 * A type-erased function object, such as a function pointer, lambda, or bound member function.<br/>
+	 * Function objects up to DELEGATE_INLINE_SIZE bytes are stored inline, and larger ones are allocated as a fallback.
+	 */
+	template<typename ReturnType, typename ... ArgumentTypes>
+	class Callable final {
+
+		// OPERATIONS
+
+		/** The functions that invoke, copy, move, and destroy the stored function object. */
+		struct Operations final {
+
+			// DATA
+
+			/** Invokes the function object stored in the given storage. */
+			ReturnType(*Invoke)(void* Storage, ArgumentTypes&... Arguments);
+
+			/** Copy constructs the function object stored in the source storage into the destination storage. */
+			void(*Copy)(void* Destination, const void* Source);
+
+			/** Move constructs the function object stored in the source storage into the destination storage and destroys the source. */
+			void(*Move)(void* Destination, void* Source);
+
+			/** Destroys the function object stored in the given storage. */
+			void(*Destroy)(void* Storage);
+		};
+
+
+		// MODELS
+
+		/** The type an argument is passed on as, which moves rvalue reference arguments and passes all others by lvalue. */
+		template<typename ArgumentType>
+		using Pass = std::conditional_t<std::is_rvalue_reference_v<ArgumentType>, ArgumentType, ArgumentType&>;
+
+		/** The type an argument is passed on as when the original must be left unchanged, which copies rvalue reference arguments and passes all others by lvalue. */
+		template<typename ArgumentType>
+		using Unmoved = std::conditional_t<std::is_rvalue_reference_v<ArgumentType>, std::remove_cvref_t<ArgumentType>, ArgumentType&>;
+
+		/** Returns whether the given function object type is stored inline. */
+		template<typename FunctionType>
+		static constexpr bool IsInline() {
+			return sizeof(FunctionType) <= DELEGATE_INLINE_SIZE && alignof(FunctionType) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<FunctionType>;
+		}
+
+		/** Returns the stored function object of the given type. */
+		template<typename FunctionType>
+		static FunctionType& Target(void* Storage) {
+			if constexpr (IsInline<FunctionType>()) {
+				return *std::launder(reinterpret_cast<FunctionType*>(Storage));
+			}
+			else {
+				return **reinterpret_cast<FunctionType**>(Storage);
+			}
+		}
+
+		/** The operations of the given function object type. */
+		template<typename FunctionType>
+		static constexpr Operations Model = {
+			[](void* Storage, ArgumentTypes&... Arguments) -> ReturnType {
+				return Target<FunctionType>(Storage)(static_cast<Pass<ArgumentTypes>>(Arguments)...);
+			},
+			[](void* Destination, const void* Source) {
+				if constexpr (IsInline<FunctionType>()) {
+					new(Destination) FunctionType(Target<FunctionType>(const_cast<void*>(Source)));
+				}
+				else {
+					*reinterpret_cast<FunctionType**>(Destination) = new FunctionType(Target<FunctionType>(const_cast<void*>(Source)));
+				}
+			},
+			[](void* Destination, void* Source) {
+				if constexpr (IsInline<FunctionType>()) {
+					new(Destination) FunctionType(std::move(Target<FunctionType>(Source)));
+					Target<FunctionType>(Source).~FunctionType();
+				}
+				else {
+					*reinterpret_cast<FunctionType**>(Destination) = *reinterpret_cast<FunctionType**>(Source);
+				}
+			},
+			[](void* Storage) {
+				if constexpr (IsInline<FunctionType>()) {
+					Target<FunctionType>(Storage).~FunctionType();
+				}
+				else {
+					delete* reinterpret_cast<FunctionType**>(Storage);
+				}
+			}
+		};
+
+
+		// DATA
+
+		/** The memory of the stored function object, or a pointer to it if it is not stored inline. */
+		alignas(std::max_align_t) unsigned char storage[DELEGATE_INLINE_SIZE];
+
+		/** The operations of the stored function object, or nullptr if this callable is empty. */
+		const Operations* operations;
+
+
+		// STORAGE
+
+		/** Stores the given function object, which must be copyable so copying this callable cannot fail. */
+		template<typename FunctionType>
+		void Store(FunctionType&& Function) {
+			using Decayed = std::decay_t<FunctionType>;
+			static_assert(std::is_copy_constructible_v<Decayed>, "ERROR: Cannot store a function object that cannot be copied in a callable!");
+			if constexpr (IsInline<Decayed>()) {
+				new(storage) Decayed(std::forward<FunctionType>(Function));
+			}
+			else {
+				*reinterpret_cast<Decayed**>(static_cast<void*>(storage)) = new Decayed(std::forward<FunctionType>(Function));
+			}
+			operations = &Model<Decayed>;
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor. */
+		Callable() : storage(), operations(nullptr) {
+		}
+
+		/** Null constructor. */
+		Callable(std::nullptr_t) : storage(), operations(nullptr) {
+		}
+
+		/** Function pointer constructor, which stays empty if the pointer is null. */
+		Callable(ReturnType(*Function)(ArgumentTypes...)) : storage(), operations(nullptr) {
+			if (Function != nullptr) {
+				Store(Function);
+			}
+		}
+
+		/** Function object constructor. */
+		template<typename FunctionType, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctionType>, Callable> && std::is_invocable_r_v<ReturnType, std::decay_t<FunctionType>&, ArgumentTypes...>>>
+		Callable(FunctionType&& Function) : storage(), operations(nullptr) {
+			Store(std::forward<FunctionType>(Function));
+		}
+
+		/** Member function constructor, which calls the given method on the given object. */
+		template<typename ObjectType>
+		Callable(ObjectType* Object, ReturnType(ObjectType::* Method)(ArgumentTypes...)) : storage(), operations(nullptr) {
+			if (Object == nullptr || Method == nullptr) {
+				throw std::runtime_error("ERROR: Cannot bind a null object or method to a callable!");
+			}
+			Store([Object, Method](Pass<ArgumentTypes>... Arguments) -> ReturnType { return (Object->*Method)(static_cast<Pass<ArgumentTypes>>(Arguments)...); });
+		}
+
+		/** Constant member function constructor, which calls the given method on the given object. */
+		template<typename ObjectType>
+		Callable(const ObjectType* Object, ReturnType(ObjectType::* Method)(ArgumentTypes...) const) : storage(), operations(nullptr) {
+			if (Object == nullptr || Method == nullptr) {
+				throw std::runtime_error("ERROR: Cannot bind a null object or method to a callable!");
+			}
+			Store([Object, Method](Pass<ArgumentTypes>... Arguments) -> ReturnType { return (Object->*Method)(static_cast<Pass<ArgumentTypes>>(Arguments)...); });
+		}
+
+		/** Copy constructor. */
+		Callable(const Callable& Copied) : storage(), operations(nullptr) {
+			if (Copied.operations != nullptr) {
+				Copied.operations->Copy(storage, Copied.storage);
+				operations = Copied.operations;
+			}
+		}
+
+		/** Move constructor. */
+		Callable(Callable&& Moved) noexcept : storage(), operations(Moved.operations) {
+			if (operations != nullptr) {
+				operations->Move(storage, Moved.storage);
+				Moved.operations = nullptr;
+			}
+		}
+
+		/** Destructor. */
+		~Callable() {
+			Clear();
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		Callable& operator=(const Callable& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			Callable Copy(Copied);
+			*this = std::move(Copy);
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		Callable& operator=(Callable&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			Clear();
+			if (Moved.operations != nullptr) {
+				Moved.operations->Move(storage, Moved.storage);
+				operations = Moved.operations;
+				Moved.operations = nullptr;
+			}
+			return *this;
+		}
+
+		/** Null assignment operator. */
+		Callable& operator=(std::nullptr_t) {
+			Clear();
+			return *this;
+		}
+
+		/** Invoke operator. */
+		ReturnType operator()(ArgumentTypes... Arguments) const {
+			return Invoke(Arguments...);
+		}
+
+		/** Returns whether this callable stores a function object. */
+		explicit operator bool() const {
+			return operations != nullptr;
+		}
+
+		/** Returns whether this callable is empty. */
+		bool operator!() const {
+			return operations == nullptr;
+		}
+
+
+		// GETTERS
+
+		/** Returns whether this callable is empty. */
+		bool IsEmpty() const {
+			return operations == nullptr;
+		}
+
+		/** Returns whether the given function object type would be stored inline instead of allocated. */
+		template<typename FunctionType>
+		static constexpr bool FitsInline() {
+			return IsInline<std::decay_t<FunctionType>>();
+		}
+
+
+		// INVOKING
+
+		/** Invokes the stored function object with the given arguments, which are passed by reference. */
+		ReturnType Invoke(ArgumentTypes&... Arguments) const {
+#if THROW_ON_NULL_INVOKE
+			if (operations == nullptr) {
+				throw std::runtime_error("ERROR: Attempted to invoke an empty callable!");
+			}
+#endif
+			return operations->Invoke(const_cast<unsigned char*>(storage), Arguments...);
+		}
+
+		/** Invokes the stored function object with the given arguments, passing copies of rvalue reference arguments so the given arguments are never moved from. */
+		ReturnType InvokeCopies(ArgumentTypes&... Arguments) const {
+			return InvokeWith<Unmoved<ArgumentTypes>...>(static_cast<Unmoved<ArgumentTypes>>(Arguments)...);
+		}
+
+	private:
+
+		/** Invokes the stored function object with the given arguments passed on as lvalues. */
+		template<typename ... PassedTypes>
+		ReturnType InvokeWith(PassedTypes&&... Arguments) const {
+			return Invoke(Arguments...);
+		}
+
+	public:
+
+
+		// SETTERS
+
+		/** Destroys the stored function object. */
+		void Clear() {
+			if (operations != nullptr) {
+				operations->Destroy(storage);
+				operations = nullptr;
+			}
+		}
+	};
+
+
 	// MULTICAST DELEGATE
 
-	/** A hook for multiple functions that can be bound, unbound, and invoked at once. */
+	/**
+	 * A hook for multiple functions that can be bound, unbound, and invoked at once.<br/>
+	 * Function pointers, lambdas, and member functions may be bound, and each binding returns a handle that can unbind it later.
+	 */
 	template<typename ReturnType, typename ... ArgumentTypes>
 	class Delegate final {
 	public:
@@ -30,30 +325,108 @@ namespace Toolbox {
 		/** Represents the function pointer type that fits within this delegate. */
 		using Function = ReturnType(*)(ArgumentTypes...);
 
+
+		// CALLABLE
+
+		/** A type-erased function object that fits within this delegate. */
+		using CallableType = Toolbox::Callable<ReturnType, ArgumentTypes...>;
+
+
+		// HANDLE
+
+		/** A unique identifier for a binding that can be used to unbind it. */
+		using Handle = size_t;
+
+
+		// BINDING
+
+		/** A function bound to this delegate. */
+		struct Binding final {
+
+			// DATA
+
+			/** The bound function object. */
+			CallableType Target;
+
+			/** The bound function pointer, or nullptr if a function object was bound instead. */
+			Function Pointer;
+
+			/** The handle of this binding. */
+			Handle ID;
+		};
+
 	private:
 
 		// DATA
 
-		/** The underlying array of bound functions to be invoked. */
-		Vector<Function> bindings;
+		/** The underlying array of bound functions to be invoked, ordered by increasing handle. */
+		Vector<Binding> bindings;
+
+		/** The handle of the next binding. */
+		Handle next;
+
+
+		// HELPERS
+
+		/** Returns the index of the binding with the given handle, or -1 if it is not bound. */
+		ptrdiff_t IndexOf(const Handle Handle) const {
+			size_t Low = 0;
+			size_t High = bindings.Size();
+			while (Low < High) {
+				const size_t Middle = Low + (High - Low) / 2;
+				if (bindings[Middle].ID < Handle) {
+					Low = Middle + 1;
+				}
+				else {
+					High = Middle;
+				}
+			}
+			return Low < bindings.Size() && bindings[Low].ID == Handle ? static_cast<ptrdiff_t>(Low) : -1;
+		}
+
+		/** Appends a new binding and returns its handle. */
+		Handle Add(CallableType&& Target, const Function Pointer) {
+			const Handle New = next++;
+			bindings.PushBack(Binding{ std::move(Target), Pointer, New });
+			return New;
+		}
+
+		/**
+		 * Invokes each of the given bindings with the given arguments.<br/>
+		 * Every binding but the last receives copies of rvalue reference arguments, so only the last binding may move from them.
+		 */
+		static void InvokeEach(const Vector<Binding>& Bindings, ArgumentTypes&... Arguments) {
+			const size_t Count = Bindings.Size();
+			for (size_t Index = 0; Index + 1 < Count; ++Index) {
+				Bindings[Index].Target.InvokeCopies(Arguments...);
+			}
+			if (Count > 0) {
+				Bindings[Count - 1].Target.Invoke(Arguments...);
+			}
+		}
+
+		/** Whether the given type is a function rather than a handle, so a literal 0 is never mistaken for a null function. */
+		template<typename FunctionType>
+		static constexpr bool IsFunctionArgument = std::is_convertible_v<FunctionType, Function> && !std::is_integral_v<std::remove_cvref_t<FunctionType>>;
 
 	public:
 
 		// CONSTRUCTORS
 
 		/** Default constructor. */
-		Delegate(const size_t Capacity = 8) : bindings() {
+		Delegate(const size_t Capacity = 8) : bindings(), next(0) {
 			bindings.Resize(Capacity);
 		}
 
 		/** Function constructor. */
-		Delegate(const Function Function) : bindings() {
+		template<typename FunctionType, typename = std::enable_if_t<IsFunctionArgument<FunctionType>>>
+		Delegate(const FunctionType Function) : bindings(), next(0) {
 			bindings.Resize(8);
 			Bind(Function);
 		}
 
 		/** Initializer list constructor. */
-		Delegate(const std::initializer_list<Function>& List) : bindings() {
+		Delegate(const std::initializer_list<Function>& List) : bindings(), next(0) {
 			bindings.Resize(List.size());
 			for (size_t Index = 0; Index < List.size(); ++Index) {
 				Bind(*(List.begin() + Index));
@@ -69,6 +442,13 @@ namespace Toolbox {
 			return *this;
 		}
 
+		/** Function object bind operator. */
+		template<typename FunctionType>
+		Delegate& operator+=(FunctionType&& Function) {
+			Bind(std::forward<FunctionType>(Function));
+			return *this;
+		}
+
 		/** Unbind operator. */
 		Delegate& operator-=(const Function Function) {
 			Unbind(Function);
@@ -76,14 +456,14 @@ namespace Toolbox {
 		}
 
 		/** Invoke operator. */
-		Delegate& operator()(ArgumentTypes&&... Arguments) {
+		Delegate& operator()(ArgumentTypes... Arguments) {
 			Invoke(std::forward<ArgumentTypes>(Arguments)...);
 			return *this;
 		}
 
 		/** Constant invoke operator. */
-		const Delegate& operator()(ArgumentTypes&&... Arguments) const {
-			Invoke(Arguments...);
+		const Delegate& operator()(ArgumentTypes... Arguments) const {
+			Invoke(std::forward<ArgumentTypes>(Arguments)...);
 			return *this;
 		}
 
@@ -96,13 +476,30 @@ namespace Toolbox {
 		}
 
 		/** Returns whether the given function is bound to this delegate. */
-		bool IsBound(const Function Function) const {
-			return bindings.Contains(Function);
+		template<typename FunctionType, typename = std::enable_if_t<IsFunctionArgument<FunctionType>>>
+		bool IsBound(const FunctionType Function) const {
+			for (auto& Binding : bindings) {
+				if (Binding.Pointer == static_cast<Delegate::Function>(Function)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Returns whether the binding with the given handle is bound to this delegate. */
+		bool IsBound(const Handle Handle) const {
+			return IndexOf(Handle) != -1;
 		}
 
 		/** Returns the total number of times the given function is bound to this delegate. */
 		size_t Total(const Function Function) const {
-			return bindings.Total(Function);
+			size_t Total = 0;
+			for (auto& Binding : bindings) {
+				if (Binding.Pointer == Function) {
+					++Total;
+				}
+			}
+			return Total;
 		}
 
 		/** Returns whether the delegate has no bindings. */
@@ -119,8 +516,20 @@ namespace Toolbox {
 		}
 
 		/** Unbinds the given function once from this delegate and returns whether it was successful. */
-		bool Unbind(const Function Function) {
-			const ptrdiff_t Index = bindings.Find(Function);
+		template<typename FunctionType, typename = std::enable_if_t<IsFunctionArgument<FunctionType>>>
+		bool Unbind(const FunctionType Function) {
+			for (size_t Index = 0; Index < bindings.Size(); ++Index) {
+				if (bindings[Index].Pointer == static_cast<Delegate::Function>(Function)) {
+					bindings.Erase(Index);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Unbinds the binding with the given handle from this delegate and returns whether it was successful. */
+		bool Unbind(const Handle Handle) {
+			const ptrdiff_t Index = IndexOf(Handle);
 			if (Index == -1) {
 				return false;
 			}
@@ -128,53 +537,62 @@ namespace Toolbox {
 			return true;
 		}
 
-		/** Binds the given function to this delegate. */
-		void Bind(const Function Function) {
+		/** Binds the given function to this delegate and returns the handle of its binding. */
+		Handle Bind(const Function Function) {
 			if (Function == nullptr) {
 #if THROW_ON_NULL_INVOKE
 				throw std::runtime_error("ERROR: Cannot bind a null function to a delegate!");
 #endif
-				return;
+				return INVALID_DELEGATE_HANDLE;
 			}
-			bindings.PushBack(Function);
+			return Add(CallableType(Function), Function);
 		}
 
-		/** Invokes each function bound to this delegate with the given arguments. */
-		void Invoke(ArgumentTypes&&... Arguments) {
-			for (auto Function : bindings) {
-				if (Function == nullptr) {
+		/** Binds the given function object, such as a lambda, to this delegate and returns the handle of its binding. */
+		template<typename FunctionType, typename = std::enable_if_t<!std::is_convertible_v<FunctionType, Handle>>>
+		Handle Bind(FunctionType&& Function) {
+			CallableType Target(std::forward<FunctionType>(Function));
+			if (!Target) {
 #if THROW_ON_NULL_INVOKE
-					throw std::runtime_error("ERROR: A delegate attempted to invoke a null function!");
+				throw std::runtime_error("ERROR: Cannot bind a null function to a delegate!");
 #endif
-					continue;
-				}
-				Function(std::forward<ArgumentTypes>(Arguments)...);
+				return INVALID_DELEGATE_HANDLE;
 			}
+			return Add(std::move(Target), nullptr);
 		}
 
-		/** Invokes each function bound to this delegate with the given constant arguments. */
-		void Invoke(ArgumentTypes&&... Arguments) const {
-			for (auto Function : bindings) {
-				if (Function == nullptr) {
-#if THROW_ON_NULL_INVOKE
-					throw std::runtime_error("ERROR: A delegate attempted to invoke a null function!");
-#endif
-					continue;
-				}
-				Function(std::forward<ArgumentTypes>(Arguments)...);
-			}
+		/** Binds the given method of the given object to this delegate and returns the handle of its binding. */
+		template<typename ObjectType>
+		Handle Bind(ObjectType* Object, ReturnType(ObjectType::* Method)(ArgumentTypes...)) {
+			return Add(CallableType(Object, Method), nullptr);
+		}
+
+		/** Binds the given constant method of the given object to this delegate and returns the handle of its binding. */
+		template<typename ObjectType>
+		Handle Bind(const ObjectType* Object, ReturnType(ObjectType::* Method)(ArgumentTypes...) const) {
+			return Add(CallableType(Object, Method), nullptr);
+		}
+
+		/** Invokes each function bound to this delegate with the given arguments, which only the last binding may move from. */
+		void Invoke(ArgumentTypes... Arguments) {
+			InvokeEach(bindings, Arguments...);
+		}
+
+		/** Invokes each function bound to this delegate with the given constant arguments, which only the last binding may move from. */
+		void Invoke(ArgumentTypes... Arguments) const {
+			InvokeEach(bindings, Arguments...);
 		}
 
 
 		// AS VECTOR
 
-		/** Returns a reference to this delegate as a vector. */
-		Vector<Function>& AsVector() {
+		/** Returns a reference to this delegate's bindings as a vector. */
+		Vector<Binding>& AsVector() {
 			return bindings;
 		}
 
-		/** Returns a constant reference to this delegate as a vector. */
-		const Vector<Function>& AsVector() const {
+		/** Returns a constant reference to this delegate's bindings as a vector. */
+		const Vector<Binding>& AsVector() const {
 			return bindings;
 		}
 	};
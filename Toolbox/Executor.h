@@ -0,0 +1,453 @@
+// .h
+// Coroutine Executor Type
+// by Kyle Furey
+
+#pragma once
+#include <cstdint>
+#include "Coroutine.h"
+#include "Pool.h"
+#include "Ring.h"
+#include "Set.h"
+#include "ThreadPool.h"
+
+#if COROUTINES_COMPILED
+
+// The number of bits of time each level of an executor's timer wheel covers.
+#define EXECUTOR_WHEEL_BITS 6
+
+// The number of levels in an executor's timer wheel, which together cover 2 ^ (EXECUTOR_WHEEL_BITS * EXECUTOR_WHEEL_LEVELS) milliseconds.
+#define EXECUTOR_WHEEL_LEVELS 4
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// EXECUTOR
+
+	/**
+	 * A scheduler that owns a queue of ready coroutines and a hierarchical timer wheel of delayed coroutines.<br/>
+	 * Coroutines that await a Delay while resumed by an executor are parked in its timer wheel until their deadline, and tasks wake them when finished, so nothing is polled.<br/>
+	 * Executors resume coroutines on the thread calling Run() or RunOnce(), or on a thread pool's workers if given one.
+	 */
+	class Executor final : public Scheduler {
+
+		// WHEEL
+
+		/** The number of slots in each level of the timer wheel. */
+		static constexpr uint64_t SLOTS = static_cast<uint64_t>(1) << EXECUTOR_WHEEL_BITS;
+
+		/** The number of milliseconds the whole timer wheel covers. */
+		static constexpr uint64_t SPAN = static_cast<uint64_t>(1) << (EXECUTOR_WHEEL_BITS * EXECUTOR_WHEEL_LEVELS);
+
+
+		// TIMER
+
+		/** A coroutine waiting for its deadline in a slot of the timer wheel. */
+		struct Timer final {
+
+			// DATA
+
+			/** The delayed coroutine. */
+			coroutine::coroutine_handle<> Coroutine;
+
+			/** The millisecond after this executor started that the coroutine is resumed at, rounded up so it is never resumed early. */
+			uint64_t Deadline;
+
+			/** The next timer in the same slot. */
+			Timer* Next;
+		};
+
+
+		// HASHING
+
+		/** Returns the hash of the given coroutine address, which keeps the set of owned coroutines from depending on a function with internal linkage. */
+		static Hash HashAddress(void* const& Address) {
+			return Hashify(Address);
+		}
+
+
+		// DATA
+
+		/** The thread pool coroutines are resumed on, or nullptr if they are resumed by the thread running this executor. */
+		ThreadPool* pool;
+
+		/** Guards the ready queue, timer wheel and owned coroutines. */
+		Mutex mutex;
+
+		/** The coroutines waiting to be resumed. */
+		Ring<coroutine::coroutine_handle<>> ready;
+
+		/** The memory of each timer. */
+		Pool<Timer> timers;
+
+		/** Each slot of each level of the timer wheel. */
+		Timer* wheel[EXECUTOR_WHEEL_LEVELS][SLOTS];
+
+		/** The number of parked timers. */
+		size_t timed;
+
+		/** The last millisecond the timer wheel has advanced to. */
+		uint64_t now;
+
+		/** When this executor started. */
+		std::chrono::steady_clock::time_point epoch;
+
+		/** The number of spawned coroutines that have not finished. */
+		Atomic<size_t> live;
+
+		/** The addresses of each spawned coroutine that has not finished. */
+		Set<void*, HashAddress> owned;
+
+		/** The number of coroutines handed to the thread pool that have not returned. */
+		Atomic<size_t> running;
+
+		/** Whether this executor was requested to stop running. */
+		Atomic<bool> stopping;
+
+		/** Wakes the thread running this executor when a coroutine is scheduled. */
+		Signal wake;
+
+
+		// TIME
+
+		/** Returns the number of milliseconds since this executor started. */
+		uint64_t Elapsed() const {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - epoch).count());
+		}
+
+
+		// TIMER WHEEL
+
+		/** Parks the given timer in the level of the wheel that covers its deadline, or readies its coroutine if it is due (requires the lock). */
+		void Park(Timer* Timer) {
+			const uint64_t Delta = Timer->Deadline > now ? Timer->Deadline - now : 0;
+			if (Delta == 0) {
+				ready.PushBack(Timer->Coroutine);
+				timers.Delete(Timer);
+				--timed;
+				return;
+			}
+			size_t Level = 0;
+			while (Level < EXECUTOR_WHEEL_LEVELS - 1 && Delta >= (static_cast<uint64_t>(1) << (EXECUTOR_WHEEL_BITS * (Level + 1)))) {
+				++Level;
+			}
+			const uint64_t Target = Delta < SPAN ? Timer->Deadline : now + SPAN - 1;
+			Link(Level, Target, Timer);
+		}
+
+		/** Links the given timer into the slot of the given level that the given time falls in. */
+		void Link(const size_t Level, const uint64_t Time, Timer* Timer) {
+			Executor::Timer*& Slot = wheel[Level][(Time >> (EXECUTOR_WHEEL_BITS * Level)) & (SLOTS - 1)];
+			Timer->Next = Slot;
+			Slot = Timer;
+		}
+
+		/** Advances the timer wheel one millisecond at a time up to the given time, cascading higher levels down and readying due coroutines (requires the lock). */
+		void Advance(const uint64_t Time) {
+			while (now < Time) {
+				if (timed == 0) {
+					now = Time;
+					return;
+				}
+				++now;
+				for (size_t Level = 1; Level < EXECUTOR_WHEEL_LEVELS; ++Level) {
+					if ((now & ((static_cast<uint64_t>(1) << (EXECUTOR_WHEEL_BITS * Level)) - 1)) != 0) {
+						break;
+					}
+					Timer*& Slot = wheel[Level][(now >> (EXECUTOR_WHEEL_BITS * Level)) & (SLOTS - 1)];
+					Timer* Current = Slot;
+					Slot = nullptr;
+					while (Current != nullptr) {
+						Timer* Next = Current->Next;
+						Park(Current);
+						Current = Next;
+					}
+				}
+				Timer*& Slot = wheel[0][now & (SLOTS - 1)];
+				Timer* Current = Slot;
+				Slot = nullptr;
+				while (Current != nullptr) {
+					Timer* Next = Current->Next;
+					ready.PushBack(Current->Coroutine);
+					timers.Delete(Current);
+					--timed;
+					Current = Next;
+				}
+			}
+		}
+
+		/** Returns the number of milliseconds until the timer wheel next needs to advance, or SIZE_MAX if it is empty (requires the lock). */
+		size_t NextDeadline() const {
+			if (timed == 0) {
+				return SIZE_MAX;
+			}
+			const uint64_t Remaining = SLOTS - (now & (SLOTS - 1));
+			uint64_t Ticks = Remaining;
+			for (uint64_t Offset = 1; Offset < Remaining; ++Offset) {
+				if (wheel[0][(now + Offset) & (SLOTS - 1)] != nullptr) {
+					Ticks = Offset;
+					break;
+				}
+			}
+			const uint64_t Time = Elapsed();
+			return now + Ticks > Time ? static_cast<size_t>(now + Ticks - Time) : 0;
+		}
+
+
+		// RESUMING
+
+		/** Resumes the given coroutine as this thread's scheduler. */
+		void Resume(coroutine::coroutine_handle<> Coroutine) {
+			Scheduler* Previous = SetCurrent(this);
+			Coroutine.resume();
+			SetCurrent(Previous);
+		}
+
+		/** Resumes the given coroutine on the thread pool. */
+		void Dispatch(coroutine::coroutine_handle<> Coroutine) {
+			running.fetch_add(1);
+			pool->Run([this, Coroutine]() {
+				Resume(Coroutine);
+				Return();
+				});
+		}
+
+		/** Marks a coroutine handed to the thread pool as returned and wakes the running thread and destructor if it was the last one, under the lock so the destructor waits for it. */
+		void Return() {
+			std::lock_guard<Mutex> Lock(mutex);
+			if (running.fetch_sub(1) == 1) {
+				running.notify_all();
+				wake.Set();
+			}
+		}
+
+		/** Called when a spawned coroutine is created, which is owned by this executor until it ends. */
+		void Adopted(coroutine::coroutine_handle<> Coroutine) override {
+			std::lock_guard<Mutex> Lock(mutex);
+			owned.Insert(Coroutine.address());
+			live.fetch_add(1);
+		}
+
+		/** Called when a spawned coroutine ends, which destroys it. */
+		void Ended(coroutine::coroutine_handle<> Coroutine) override {
+			{
+				std::lock_guard<Mutex> Lock(mutex);
+				owned.Erase(Coroutine.address());
+			}
+			Coroutine.destroy();
+			live.fetch_sub(1);
+		}
+
+		/** Starts the given coroutine function as this thread's scheduler and takes ownership of the void coroutine it returns. */
+		template<typename FunctionType>
+		void Start(FunctionType& Function) {
+			Scheduler* Previous = SetCurrent(this);
+			Adopt(this);
+			Async<void> Coroutine = Function();
+			Adopt(nullptr);
+			SetCurrent(Previous);
+			Coroutine.Release();
+		}
+
+		/** Returns whether there is nothing left for this executor to run. */
+		bool IsIdle() {
+			std::lock_guard<Mutex> Lock(mutex);
+			return ready.IsEmpty() && timed == 0 && live.load() == 0 && running.load() == 0;
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor, which resumes coroutines on the given thread pool's workers if given one. */
+		explicit Executor(ThreadPool* Pool = nullptr) : pool(Pool), mutex(), ready(), timers(), wheel(), timed(0), now(0), epoch(std::chrono::steady_clock::now()), live(0), owned(), running(0), stopping(false), wake() {
+		}
+
+		/** Delete copy constructor. */
+		Executor(const Executor&) = delete;
+
+		/** Delete move constructor. */
+		Executor(Executor&&) noexcept = delete;
+
+		/**
+		 * Destructor, which waits for every coroutine handed to the thread pool to return and then destroys every spawned coroutine that has not finished.<br/>
+		 * NOTE: Coroutines still parked in this executor are never resumed, so tasks they await must not be finished afterwards!
+		 */
+		~Executor() {
+			for (size_t Running = running.load(); Running > 0; Running = running.load()) {
+				if (pool == nullptr || !pool->IsWorker() || !pool->RunPending()) {
+					running.wait(Running);
+				}
+			}
+			Vector<void*> Unfinished;
+			{
+				std::lock_guard<Mutex> Lock(mutex);
+				Unfinished = owned.Values();
+				owned.Clear();
+				ready.Clear();
+				for (auto& Level : wheel) {
+					for (auto& Slot : Level) {
+						while (Slot != nullptr) {
+							Timer* Next = Slot->Next;
+							timers.Delete(Slot);
+							Slot = Next;
+						}
+					}
+				}
+				timed = 0;
+			}
+			for (void* Address : Unfinished) {
+				coroutine::coroutine_handle<>::from_address(Address).destroy();
+			}
+			live.store(0);
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		Executor& operator=(const Executor&) = delete;
+
+		/** Delete move assignment operator. */
+		Executor& operator=(Executor&&) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the thread pool coroutines are resumed on, or nullptr if they are resumed by the thread running this executor. */
+		ThreadPool* Workers() const {
+			return pool;
+		}
+
+		/** Returns the number of spawned coroutines that have not finished. */
+		size_t Live() const {
+			return live.load();
+		}
+
+		/** Returns the number of coroutines parked in the timer wheel. */
+		size_t Timers() {
+			std::lock_guard<Mutex> Lock(mutex);
+			return timed;
+		}
+
+		/** Returns the number of coroutines waiting to be resumed. */
+		size_t Ready() {
+			std::lock_guard<Mutex> Lock(mutex);
+			return ready.Size();
+		}
+
+
+		// SCHEDULING
+
+		/** Resumes the given suspended coroutine as soon as possible. */
+		void Schedule(coroutine::coroutine_handle<> Coroutine) override {
+			if (pool != nullptr) {
+				Dispatch(Coroutine);
+				return;
+			}
+			{
+				std::lock_guard<Mutex> Lock(mutex);
+				ready.PushBack(Coroutine);
+			}
+			wake.Set();
+		}
+
+		/** Parks the given suspended coroutine in the timer wheel and resumes it after the given number of milliseconds. */
+		void ScheduleAfter(coroutine::coroutine_handle<> Coroutine, const size_t Milliseconds) override {
+			if (Milliseconds == 0) {
+				Schedule(Coroutine);
+				return;
+			}
+			{
+				std::lock_guard<Mutex> Lock(mutex);
+				Timer* New = timers.New();
+				New->Coroutine = Coroutine;
+				New->Deadline = Elapsed() + Milliseconds + 1;
+				New->Next = nullptr;
+				++timed;
+				Park(New);
+			}
+			wake.Set();
+		}
+
+		/**
+		 * Calls the given function, which returns an Async<void>, with this executor as the current scheduler, and takes ownership of the coroutine.<br/>
+		 * The coroutine starts immediately on the calling thread (or on a worker if this executor has a thread pool) and destroys itself when it ends.
+		 */
+		template<typename FunctionType>
+		void Spawn(FunctionType&& Function) {
+			if (pool != nullptr) {
+				running.fetch_add(1);
+				pool->Run([this, Function = std::forward<FunctionType>(Function)]() mutable {
+					Start(Function);
+					Return();
+					});
+				return;
+			}
+			Start(Function);
+		}
+
+
+		// RUNNING
+
+		/** Advances the timer wheel to the current time and resumes every coroutine that is ready, then returns how many were resumed. */
+		size_t RunOnce() {
+			Ring<coroutine::coroutine_handle<>> Batch;
+			{
+				std::lock_guard<Mutex> Lock(mutex);
+				Advance(Elapsed());
+				if (ready.IsEmpty()) {
+					return 0;
+				}
+				std::swap(Batch, ready);
+			}
+			const size_t Count = Batch.Size();
+			while (!Batch.IsEmpty()) {
+				coroutine::coroutine_handle<> Coroutine = Batch.Front();
+				Batch.PopFront();
+				if (pool != nullptr) {
+					Dispatch(Coroutine);
+				}
+				else {
+					Resume(Coroutine);
+				}
+			}
+			return Count;
+		}
+
+		/**
+		 * Runs this executor on the current thread until it is stopped or every spawned coroutine has finished and no timers are parked.<br/>
+		 * The thread sleeps until the next timer is due or a coroutine is scheduled instead of polling.
+		 */
+		void Run() {
+			stopping.store(false);
+			while (!stopping.load()) {
+				wake.Reset();
+				if (RunOnce() > 0) {
+					continue;
+				}
+				if (IsIdle()) {
+					return;
+				}
+				size_t Wait = SIZE_MAX;
+				{
+					std::lock_guard<Mutex> Lock(mutex);
+					Wait = ready.IsEmpty() ? NextDeadline() : 0;
+				}
+				if (Wait == SIZE_MAX) {
+					wake.Wait();
+				}
+				else if (Wait > 0) {
+					wake.WaitFor(Wait);
+				}
+			}
+		}
+
+		/** Requests the thread running this executor to return from Run(). */
+		void Stop() {
+			stopping.store(true);
+			wake.Set();
+		}
+	};
+}
+
+#endif	// COROUTINES_COMPILED
@@ -0,0 +1,364 @@
+// .h
+// Flat Hash Map Type
+// by Kyle Furey
+
+#pragma once
+#include "FlatSet.h"
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// FLAT HASH MAP
+
+	/**
+	 * A collection of key value pairs that allow fast value lookups via hashing a key.<br/>
+	 * Pairs are stored inline in a single power of two array using Robin Hood open addressing.
+	 */
+	template<typename KeyType, typename ValueType, Hash(*HASH_FUNC)(const KeyType&) = Hashify>
+	class FlatMap final {
+		static_assert(HASH_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
+
+		// SLOT
+
+		/** A single entry in the map's array storing a pair, its key's hash, and its distance from its home slot. */
+		struct Slot final {
+
+			// DATA
+
+			/** The number of slots this pair is from its home slot plus one, or 0 if this slot is empty. */
+			uint32_t distance;
+
+			/** The cached hash of this slot's key. */
+			Hash hash;
+
+			/** The key used to lookup this slot's value. */
+			KeyType key;
+
+			/** The value this slot is storing. */
+			ValueType value;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Slot() : distance(0), hash(0), key(), value() {
+			}
+		};
+
+
+		// DATA
+
+		/** The current number of pairs stored in the map. */
+		size_t size;
+
+		/** The maximum ratio of pairs to slots before the map grows. */
+		double maxLoadFactor;
+
+		/** The underlying power of two array of slots containing each of the map's pairs. */
+		Vector<Slot> slots;
+
+
+		// SLOTS
+
+		/** Returns the index of the slot containing the given key with the given hash, or -1 if it is not found. */
+		ptrdiff_t FindSlot(const KeyType& Key, const Hash Hash) const {
+			const Slot* Slots = slots.begin();
+			const size_t Mask = slots.Size() - 1;
+			size_t Index = HomeSlot(Hash, Mask);
+			uint32_t Distance = 1;
+			while (Slots[Index].distance >= Distance) {
+				if (Slots[Index].hash == Hash && Slots[Index].key == Key) {
+					return static_cast<ptrdiff_t>(Index);
+				}
+				Index = (Index + 1) & Mask;
+				++Distance;
+			}
+			return -1;
+		}
+
+		/** Places a new pair with the given hash into the map, displacing pairs closer to their home slots, and returns the new pair's index. */
+		size_t PlaceSlot(Slot&& New) {
+			Slot* Slots = slots.begin();
+			const size_t Mask = slots.Size() - 1;
+			size_t Index = HomeSlot(New.hash, Mask);
+			size_t Placed = slots.Size();
+			New.distance = 1;
+			while (Slots[Index].distance != 0) {
+				if (Slots[Index].distance < New.distance) {
+					std::swap(Slots[Index], New);
+					if (Placed == slots.Size()) {
+						Placed = Index;
+					}
+				}
+				Index = (Index + 1) & Mask;
+				++New.distance;
+			}
+			Slots[Index] = std::move(New);
+			return Placed == slots.Size() ? Index : Placed;
+		}
+
+		/** Returns whether one more pair would exceed the map's maximum load factor. */
+		bool IsOverloaded() const {
+			return static_cast<double>(size + 1) > static_cast<double>(slots.Size()) * maxLoadFactor;
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		FlatMap(const size_t BucketCount = FLAT_MIN_SLOTS, const double MaxLoadFactor = FLAT_LOAD_FACTOR) : size(0), maxLoadFactor(MaxLoadFactor), slots() {
+			if (maxLoadFactor <= 0 || maxLoadFactor >= 1) {
+				throw std::runtime_error("ERROR: A flat map's maximum load factor must be between 0 and 1!");
+			}
+			slots = Vector<Slot>(NextPowerOfTwo(BucketCount < FLAT_MIN_SLOTS ? FLAT_MIN_SLOTS : BucketCount));
+		}
+
+		/** Copy constructor. */
+		FlatMap(const FlatMap<KeyType, ValueType, HASH_FUNC>& Copied) : size(Copied.size), maxLoadFactor(Copied.maxLoadFactor), slots(Copied.slots) {
+		}
+
+		/** Move constructor. */
+		FlatMap(FlatMap<KeyType, ValueType, HASH_FUNC>&& Moved) noexcept : size(Moved.size), maxLoadFactor(Moved.maxLoadFactor), slots(std::move(Moved.slots)) {
+			Moved.size = 0;
+			Moved.slots = Vector<Slot>(FLAT_MIN_SLOTS);
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		FlatMap<KeyType, ValueType, HASH_FUNC>& operator=(const FlatMap<KeyType, ValueType, HASH_FUNC>& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			size = Copied.size;
+			maxLoadFactor = Copied.maxLoadFactor;
+			slots = Copied.slots;
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		FlatMap<KeyType, ValueType, HASH_FUNC>& operator=(FlatMap<KeyType, ValueType, HASH_FUNC>&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			size = Moved.size;
+			maxLoadFactor = Moved.maxLoadFactor;
+			slots = std::move(Moved.slots);
+			Moved.size = 0;
+			Moved.slots = Vector<Slot>(FLAT_MIN_SLOTS);
+			return *this;
+		}
+
+		/** Returns a reference to the given key's value, or inserts a new value with the given key. */
+		ValueType& operator[](const KeyType& Key) {
+			auto Value = Find(Key);
+			if (Value) {
+				return *Value;
+			}
+			return Insert(Key, ValueType());
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of pairs in the map. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns the number of slots in the map. */
+		size_t Buckets() const {
+			return slots.Size();
+		}
+
+		/** Returns the current ratio of pairs to slots in the map. */
+		double LoadFactor() const {
+			return static_cast<double>(size) / static_cast<double>(slots.Size());
+		}
+
+		/** Returns the maximum ratio of pairs to slots before the map grows. */
+		double MaxLoadFactor() const {
+			return maxLoadFactor;
+		}
+
+		/** Returns this map's hash function. */
+		Hash(*HashFunction() const)(const KeyType&) {
+			return HASH_FUNC;
+		}
+
+		/** Finds and returns a pointer to the given key's value in the map, or nullptr if it does not exist. */
+		ValueType* Find(const KeyType& Key) {
+			const ptrdiff_t Index = FindSlot(Key, HASH_FUNC(Key));
+			return Index != -1 ? &slots.begin()[Index].value : nullptr;
+		}
+
+		/** Finds and returns a constant pointer to the given key's value in the map, or nullptr if it does not exist. */
+		const ValueType* Find(const KeyType& Key) const {
+			const ptrdiff_t Index = FindSlot(Key, HASH_FUNC(Key));
+			return Index != -1 ? &slots.begin()[Index].value : nullptr;
+		}
+
+		/** Returns whether the given key is present in the map. */
+		bool ContainsKey(const KeyType& Key) const {
+			return Find(Key) != nullptr;
+		}
+
+		/** Returns whether the given value is present in the map. */
+		bool ContainsValue(const ValueType& Value) const {
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0 && Slot.value == Value) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Returns the total number of matching values in the map. */
+		size_t Total(const ValueType& Value) const {
+			size_t Total = 0;
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0 && Slot.value == Value) {
+					++Total;
+				}
+			}
+			return Total;
+		}
+
+		/** Returns whether the map is empty. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+		/** Returns a copy of each of the keys in the map in a vector. */
+		Vector<KeyType> Keys() const {
+			Vector<KeyType> Keys(size);
+			size_t Index = 0;
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0) {
+					Keys[Index] = Slot.key;
+					++Index;
+				}
+			}
+			return Keys;
+		}
+
+		/** Returns a copy of each of the values in the map in a vector. */
+		Vector<ValueType> Values() const {
+			Vector<ValueType> Values(size);
+			size_t Index = 0;
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0) {
+					Values[Index] = Slot.value;
+					++Index;
+				}
+			}
+			return Values;
+		}
+
+
+		// SETTERS
+
+		/** Sets the maximum ratio of pairs to slots before the map grows, growing the map if it is exceeded. */
+		void SetMaxLoadFactor(const double MaxLoadFactor) {
+			if (MaxLoadFactor <= 0 || MaxLoadFactor >= 1) {
+				throw std::runtime_error("ERROR: A flat map's maximum load factor must be between 0 and 1!");
+			}
+			maxLoadFactor = MaxLoadFactor;
+			Rehash(slots.Size());
+		}
+
+
+		// EXPANSION
+
+		/** Deallocates the map's pairs while keeping its slots. */
+		void Clear() {
+			for (auto& Slot : slots) {
+				Slot = FlatMap::Slot();
+			}
+			size = 0;
+		}
+
+		/** Inserts a copy of the given value into the map with the given key and returns a reference to the value. */
+		ValueType& Insert(const KeyType& Key, const ValueType& Value) {
+			const Hash Hash = HASH_FUNC(Key);
+			const ptrdiff_t Index = FindSlot(Key, Hash);
+			if (Index != -1) {
+				return slots.begin()[Index].value = Value;
+			}
+			if (IsOverloaded()) {
+				Rehash(slots.Size() * 2);
+			}
+			Slot New;
+			New.hash = Hash;
+			New.key = Key;
+			New.value = Value;
+			const size_t Placed = PlaceSlot(std::move(New));
+			++size;
+			return slots.begin()[Placed].value;
+		}
+
+		/** Erases any matching key found in the map and returns whether a pair was found and successfully erased. */
+		bool Erase(const KeyType& Key) {
+			ptrdiff_t Index = FindSlot(Key, HASH_FUNC(Key));
+			if (Index == -1) {
+				return false;
+			}
+			Slot* Slots = slots.begin();
+			const size_t Mask = slots.Size() - 1;
+			size_t Current = static_cast<size_t>(Index);
+			size_t Next = (Current + 1) & Mask;
+			while (Slots[Next].distance > 1) {
+				Slots[Current] = std::move(Slots[Next]);
+				--Slots[Current].distance;
+				Current = Next;
+				Next = (Next + 1) & Mask;
+			}
+			Slots[Current] = Slot();
+			--size;
+			return true;
+		}
+
+		/**
+		 * Resizes the map's number of slots to the smallest power of two that fits the given number and the maximum load factor.<br/>
+		 * All pairs are moved into the new slots based on their key's cached hash value.
+		 */
+		void Rehash(const size_t BucketCount) {
+			size_t Count = BucketCount < FLAT_MIN_SLOTS ? FLAT_MIN_SLOTS : BucketCount;
+			const size_t Required = static_cast<size_t>(static_cast<double>(size) / maxLoadFactor) + 1;
+			Count = NextPowerOfTwo(Count < Required ? Required : Count);
+			if (Count == slots.Size()) {
+				return;
+			}
+			Vector<Slot> Old = std::move(slots);
+			slots = Vector<Slot>(Count);
+			for (auto& Slot : Old) {
+				if (Slot.distance != 0) {
+					PlaceSlot(std::move(Slot));
+				}
+			}
+		}
+
+
+		// TO STRING
+
+		/** Returns the map as a string. */
+		std::string ToString() const {
+			std::string String = "{ ";
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0) {
+					String += "( " + std::to_string(Slot.key) + " : " + std::to_string(Slot.value) + " ), ";
+				}
+			}
+			if (size > 0) {
+				String.erase(String.length() - 2, 2);
+				String += " }";
+			}
+			else {
+				String += "}";
+			}
+			return String;
+		}
+	};
+}
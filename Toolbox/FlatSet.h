@@ -0,0 +1,330 @@
+// .h
+// Flat Hash Set Type
+// by Kyle Furey
+
+#pragma once
+#include "Set.h"
+
+// The default maximum ratio of occupied slots to total slots in a flat hash table before it grows.
+#define FLAT_LOAD_FACTOR 0.875
+
+// The minimum number of slots allocated by a flat hash table.
+#define FLAT_MIN_SLOTS 8
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// FLAT HASHING
+
+	/** Returns the next power of two greater than or equal to the given number. */
+	static size_t NextPowerOfTwo(const size_t Number) {
+		size_t Power = 1;
+		while (Power < Number) {
+			Power <<= 1;
+		}
+		return Power;
+	}
+
+	/** Returns the home slot of the given hash in a power of two table with the given mask. */
+	static size_t HomeSlot(const Hash Hash, const size_t Mask) {
+		const uint64_t Mixed = static_cast<uint64_t>(Hash) * 0x9E3779B97F4A7C15ull;
+		return static_cast<size_t>(Mixed ^ (Mixed >> 32)) & Mask;
+	}
+
+
+	// FLAT HASH SET
+
+	/**
+	 * A collection of values that allow fast lookups via hashing.<br/>
+	 * Values are stored inline in a single power of two array using Robin Hood open addressing.
+	 */
+	template<typename Type, Hash(*HASH_FUNC)(const Type&) = Hashify>
+	class FlatSet final {
+		static_assert(HASH_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
+
+		// SLOT
+
+		/** A single entry in the set's array storing a value, its hash, and its distance from its home slot. */
+		struct Slot final {
+
+			// DATA
+
+			/** The number of slots this value is from its home slot plus one, or 0 if this slot is empty. */
+			uint32_t distance;
+
+			/** The cached hash of this slot's value. */
+			Hash hash;
+
+			/** The value stored in this slot. */
+			Type value;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Slot() : distance(0), hash(0), value() {
+			}
+		};
+
+
+		// DATA
+
+		/** The current number of values stored in the set. */
+		size_t size;
+
+		/** The maximum ratio of values to slots before the set grows. */
+		double maxLoadFactor;
+
+		/** The underlying power of two array of slots containing each of the set's values. */
+		Vector<Slot> slots;
+
+
+		// SLOTS
+
+		/** Returns the index of the slot containing the given value with the given hash, or -1 if it is not found. */
+		ptrdiff_t FindSlot(const Type& Value, const Hash Hash) const {
+			const Slot* Slots = slots.begin();
+			const size_t Mask = slots.Size() - 1;
+			size_t Index = HomeSlot(Hash, Mask);
+			uint32_t Distance = 1;
+			while (Slots[Index].distance >= Distance) {
+				if (Slots[Index].hash == Hash && Slots[Index].value == Value) {
+					return static_cast<ptrdiff_t>(Index);
+				}
+				Index = (Index + 1) & Mask;
+				++Distance;
+			}
+			return -1;
+		}
+
+		/** Places a new value with the given hash into the set, displacing values closer to their home slots. */
+		void PlaceSlot(Slot&& New) {
+			Slot* Slots = slots.begin();
+			const size_t Mask = slots.Size() - 1;
+			size_t Index = HomeSlot(New.hash, Mask);
+			New.distance = 1;
+			while (Slots[Index].distance != 0) {
+				if (Slots[Index].distance < New.distance) {
+					std::swap(Slots[Index], New);
+				}
+				Index = (Index + 1) & Mask;
+				++New.distance;
+			}
+			Slots[Index] = std::move(New);
+		}
+
+		/** Returns whether one more value would exceed the set's maximum load factor. */
+		bool IsOverloaded() const {
+			return static_cast<double>(size + 1) > static_cast<double>(slots.Size()) * maxLoadFactor;
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		FlatSet(const size_t BucketCount = FLAT_MIN_SLOTS, const double MaxLoadFactor = FLAT_LOAD_FACTOR) : size(0), maxLoadFactor(MaxLoadFactor), slots() {
+			if (maxLoadFactor <= 0 || maxLoadFactor >= 1) {
+				throw std::runtime_error("ERROR: A flat set's maximum load factor must be between 0 and 1!");
+			}
+			slots = Vector<Slot>(NextPowerOfTwo(BucketCount < FLAT_MIN_SLOTS ? FLAT_MIN_SLOTS : BucketCount));
+		}
+
+		/** Copy constructor. */
+		FlatSet(const FlatSet<Type, HASH_FUNC>& Copied) : size(Copied.size), maxLoadFactor(Copied.maxLoadFactor), slots(Copied.slots) {
+		}
+
+		/** Move constructor. */
+		FlatSet(FlatSet<Type, HASH_FUNC>&& Moved) noexcept : size(Moved.size), maxLoadFactor(Moved.maxLoadFactor), slots(std::move(Moved.slots)) {
+			Moved.size = 0;
+			Moved.slots = Vector<Slot>(FLAT_MIN_SLOTS);
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		FlatSet<Type, HASH_FUNC>& operator=(const FlatSet<Type, HASH_FUNC>& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			size = Copied.size;
+			maxLoadFactor = Copied.maxLoadFactor;
+			slots = Copied.slots;
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		FlatSet<Type, HASH_FUNC>& operator=(FlatSet<Type, HASH_FUNC>&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			size = Moved.size;
+			maxLoadFactor = Moved.maxLoadFactor;
+			slots = std::move(Moved.slots);
+			Moved.size = 0;
+			Moved.slots = Vector<Slot>(FLAT_MIN_SLOTS);
+			return *this;
+		}
+
+		/** Returns whether the given value is present in the set. */
+		bool operator[](const Type& Value) {
+			return Contains(Value);
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of values in the set. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns the number of slots in the set. */
+		size_t Buckets() const {
+			return slots.Size();
+		}
+
+		/** Returns the current ratio of values to slots in the set. */
+		double LoadFactor() const {
+			return static_cast<double>(size) / static_cast<double>(slots.Size());
+		}
+
+		/** Returns the maximum ratio of values to slots before the set grows. */
+		double MaxLoadFactor() const {
+			return maxLoadFactor;
+		}
+
+		/** Returns this set's hash function. */
+		Hash(*HashFunction() const)(const Type&) {
+			return HASH_FUNC;
+		}
+
+		/** Returns whether the given value is present in the set. */
+		bool Contains(const Type& Value) const {
+			return FindSlot(Value, HASH_FUNC(Value)) != -1;
+		}
+
+		/** Returns whether the set is empty. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+		/** Returns a copy of each of the values in the set in a vector. */
+		Vector<Type> Values() const {
+			Vector<Type> Values(size);
+			size_t Index = 0;
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0) {
+					Values[Index] = Slot.value;
+					++Index;
+				}
+			}
+			return Values;
+		}
+
+
+		// SETTERS
+
+		/** Sets the maximum ratio of values to slots before the set grows, growing the set if it is exceeded. */
+		void SetMaxLoadFactor(const double MaxLoadFactor) {
+			if (MaxLoadFactor <= 0 || MaxLoadFactor >= 1) {
+				throw std::runtime_error("ERROR: A flat set's maximum load factor must be between 0 and 1!");
+			}
+			maxLoadFactor = MaxLoadFactor;
+			Rehash(slots.Size());
+		}
+
+
+		// EXPANSION
+
+		/** Deallocates the set's values while keeping its slots. */
+		void Clear() {
+			for (auto& Slot : slots) {
+				Slot = FlatSet::Slot();
+			}
+			size = 0;
+		}
+
+		/** Inserts a copy of the given value into the set and returns whether a new element was successfully inserted. */
+		bool Insert(const Type& Value) {
+			const Hash Hash = HASH_FUNC(Value);
+			const ptrdiff_t Index = FindSlot(Value, Hash);
+			if (Index != -1) {
+				slots.begin()[Index].value = Value;
+				return false;
+			}
+			if (IsOverloaded()) {
+				Rehash(slots.Size() * 2);
+			}
+			Slot New;
+			New.hash = Hash;
+			New.value = Value;
+			PlaceSlot(std::move(New));
+			++size;
+			return true;
+		}
+
+		/** Erases any matching value found in the set and returns whether the value was found and successfully erased. */
+		bool Erase(const Type& Value) {
+			ptrdiff_t Index = FindSlot(Value, HASH_FUNC(Value));
+			if (Index == -1) {
+				return false;
+			}
+			Slot* Slots = slots.begin();
+			const size_t Mask = slots.Size() - 1;
+			size_t Current = static_cast<size_t>(Index);
+			size_t Next = (Current + 1) & Mask;
+			while (Slots[Next].distance > 1) {
+				Slots[Current] = std::move(Slots[Next]);
+				--Slots[Current].distance;
+				Current = Next;
+				Next = (Next + 1) & Mask;
+			}
+			Slots[Current] = Slot();
+			--size;
+			return true;
+		}
+
+		/**
+		 * Resizes the set's number of slots to the smallest power of two that fits the given number and the maximum load factor.<br/>
+		 * All values are moved into the new slots based on their cached hash value.
+		 */
+		void Rehash(const size_t BucketCount) {
+			size_t Count = BucketCount < FLAT_MIN_SLOTS ? FLAT_MIN_SLOTS : BucketCount;
+			const size_t Required = static_cast<size_t>(static_cast<double>(size) / maxLoadFactor) + 1;
+			Count = NextPowerOfTwo(Count < Required ? Required : Count);
+			if (Count == slots.Size()) {
+				return;
+			}
+			Vector<Slot> Old = std::move(slots);
+			slots = Vector<Slot>(Count);
+			for (auto& Slot : Old) {
+				if (Slot.distance != 0) {
+					PlaceSlot(std::move(Slot));
+				}
+			}
+		}
+
+
+		// TO STRING
+
+		/** Returns the set as a string. */
+		std::string ToString() const {
+			std::string String = "{ ";
+			for (auto& Slot : slots) {
+				if (Slot.distance != 0) {
+					String += std::to_string(Slot.value) + ", ";
+				}
+			}
+			if (size > 0) {
+				String.erase(String.length() - 2, 2);
+				String += " }";
+			}
+			else {
+				String += "}";
+			}
+			return String;
+		}
+	};
+}
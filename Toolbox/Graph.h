@@ -4,9 +4,12 @@
 
 #pragma once
 #include <cfloat>
+#include <cstdint>
 #include "Stack.h"
-#include "PriorityQueue.h"
+#include "Heap.h"
 #include "Map.h"
+#include "Stats.h"
+#include "ThreadPool.h"
 
 // Represents an invalid node code.
 #define INVALID_NODE_CODE 0
@@ -20,6 +23,15 @@
 // The maximum number of loops when building a path in a graph.
 #define MAX_LOOPS 300
 
+// Represents an invalid node index in a compact graph.
+#define INVALID_NODE_INDEX UINT32_MAX
+
+// The cost of a node that a search did not reach.
+#define UNREACHED_WEIGHT SIZE_MAX
+
+// The minimum number of nodes in one level of a parallel breadth first search before the level is split across threads.
+#define PARALLEL_SEARCH_THRESHOLD 1024
+
 /** A collection of useful template types in C++. */
 namespace Toolbox {
 
@@ -100,7 +112,7 @@ namespace Toolbox {
 		// CONNECTION
 
 		/** Represents a link between two graph nodes. */
-		using Connection = Connection<Type>;
+		using Connection = Toolbox::Connection<Type>;
 
 	private:
 
@@ -234,15 +246,44 @@ namespace Toolbox {
 
 	/** Returns 0 as no heuristic was given. */
 	template <typename Type>
-	static Heuristic NoHeuristic(const GraphNode<Type>& Current, const GraphNode<Type>& End) {
+	static Heuristic NoHeuristic(const GraphNode<Type>&, const GraphNode<Type>&) {
 		return 0;
 	}
 
 
-	// GRAPH
+	// PATH QUERY
+
+	/** A request for the shortest path between two nodes. */
+	struct PathQuery final {
+
+		// DATA
+
+		/** The code of the node the path starts from. */
+		NodeCode Start;
+
+		/** The code of the node the path ends at. */
+		NodeCode End;
+
 
-	/** A collection of interconnected nodes that can be traversed based on their weights. */
+		// CONSTRUCTOR
+
+		/** Default constructor. */
+		PathQuery(const NodeCode Start = INVALID_NODE_CODE, const NodeCode End = INVALID_NODE_CODE) : Start(Start), End(End) {
+		}
+	};
+
+
+	// COMPACT GRAPH
+
+	/** An immutable snapshot of a graph with dense node indices and contiguous connections. */
 	template<typename Type, Heuristic(*HEURISTIC_FUNC)(const GraphNode<Type>&, const GraphNode<Type>&) = NoHeuristic>
+	class CompactGraph;
+
+
+	// GRAPH
+
+	/** A collection of interconnected nodes that can be traversed based on their weights, with its node memory drawn from the given allocator. */
+	template<typename Type, Heuristic(*HEURISTIC_FUNC)(const GraphNode<Type>&, const GraphNode<Type>&) = NoHeuristic, typename AllocatorType = HeapAllocator>
 	class Graph final {
 		static_assert(HEURISTIC_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
 	public:
@@ -262,7 +303,7 @@ namespace Toolbox {
 		using Node = GraphNode<Type>;
 
 		/** Represents a link between two graph nodes. */
-		using Connection = Connection<Type>;
+		using Connection = Toolbox::Connection<Type>;
 
 	private:
 
@@ -272,29 +313,33 @@ namespace Toolbox {
 		size_t nextCode;
 
 		/** Each of the nodes this graph manages. */
-		Map<NodeCode, Node> nodes;
+		Map<NodeCode, Node, Hashify, AllocatorType> nodes;
 
 	public:
 
 		// CONSTRUCTORS
 
 		/** Default constructor. */
-		Graph(const size_t BucketCount = 16) : nextCode(1), nodes(BucketCount) {
+		Graph(const size_t BucketCount = 16, const AllocatorType& Allocator = AllocatorType()) : nextCode(1), nodes(BucketCount, Allocator) {
+		}
+
+		/** Allocator constructor. */
+		explicit Graph(const AllocatorType& Allocator) : nextCode(1), nodes(16, Allocator) {
 		}
 
 		/** Copy constructor. */
-		Graph(const Graph<Type>& Copied) : nextCode(1), nodes(Copied.nodes) {
+		Graph(const Graph& Copied) : nextCode(1), nodes(Copied.nodes) {
 		}
 
 		/** Move constructor. */
-		Graph(Graph<Type>&& Moved) noexcept : nextCode(1), nodes(std::move(Moved.nodes)) {
+		Graph(Graph&& Moved) noexcept : nextCode(1), nodes(std::move(Moved.nodes)) {
 		}
 
 
 		// OPERATORS
 
 		/** Copy assignment operator. */
-		Graph<Type>& operator=(const Graph<Type>& Copied) {
+		Graph& operator=(const Graph& Copied) {
 			if (this == &Copied) {
 				return *this;
 			}
@@ -304,7 +349,7 @@ namespace Toolbox {
 		}
 
 		/** Move assignment operator. */
-		Graph<Type>& operator=(Graph<Type>&& Moved) noexcept {
+		Graph& operator=(Graph&& Moved) noexcept {
 			if (this == &Moved) {
 				return *this;
 			}
@@ -379,12 +424,29 @@ namespace Toolbox {
 			return nodes.Insert(Next, Node(Next, Value, Weight, Active)).Code();
 		}
 
+		/**
+		 * Inserts a new node into the graph with the given code and a copy of the given value, and returns a pointer to it.<br/>
+		 * Returns nullptr if the code is invalid or already used. Nodes inserted later are given codes after the largest restored code.
+		 */
+		Node* Restore(const NodeCode Code, const Type& Value, const NodeWeight Weight = DEFAULT_WEIGHT, const bool Active = true) {
+			if (Code == INVALID_NODE_CODE || nodes.ContainsKey(Code)) {
+				return nullptr;
+			}
+			if (Code >= nextCode) {
+				nextCode = Code + 1;
+				if (nextCode == INVALID_NODE_CODE) {
+					++nextCode;
+				}
+			}
+			return &nodes.Insert(Code, Node(Code, Value, Weight, Active));
+		}
+
 		/** Removes the given node from the graph and returns whether it was successful. */
 		bool Erase(const NodeCode Node) {
 			if (nodes.ContainsKey(Node)) {
 				Vector<NodeCode> Codes = nodes.Keys();
 				for (auto Code : Codes) {
-					struct Node* Current = nodes.Find(Code);
+					GraphNode<Type>* Current = nodes.Find(Code);
 					if (Current != nullptr) {
 						Current->Disconnect(Node);
 					}
@@ -448,8 +510,9 @@ namespace Toolbox {
 			if (CurrentNode == nullptr || EndNode == nullptr) {
 				return Stack<NodeCode>();
 			}
-			PriorityQueue<NodeCode, Heuristic> Frontier;
-			Frontier.Push(Start, 0);
+			IndexedHeap<NodeCode, Heuristic> Frontier;
+			Map<NodeCode, typename IndexedHeap<NodeCode, Heuristic>::Handle> Handles;
+			Handles.Insert(Start, Frontier.Push(Start, 0));
 			Map<NodeCode, NodeCode> From;
 			From.Insert(Start, INVALID_NODE_CODE);
 			Map<NodeCode, NodeWeight> Weights;
@@ -480,12 +543,21 @@ namespace Toolbox {
 					NodeWeight NewCost = Weights[CurrentNode->Code()] + Connection.Weight + ToNode->Weight;
 					if (!From.ContainsKey(Connection.To()) || NewCost < Weights[Connection.To()]) {
 						Weights[Connection.To()] = NewCost;
-						Frontier.Push(Connection.To(), static_cast<Heuristic>(NewCost) + HEURISTIC_FUNC(*ToNode, *EndNode));
+						const Heuristic Priority = static_cast<Heuristic>(NewCost) + HEURISTIC_FUNC(*ToNode, *EndNode);
+						auto Handle = Handles.Find(Connection.To());
+						if (Handle != nullptr && Frontier.Contains(*Handle)) {
+							Frontier.Update(*Handle, Priority);
+						}
+						else {
+							Handles[Connection.To()] = Frontier.Push(Connection.To(), Priority);
+						}
 						From[Connection.To()] = CurrentNode->Code();
 					}
 				}
 			}
 			Frontier.Clear();
+			TOOLBOX_COUNT(Graph, Searches, 1);
+			TOOLBOX_COUNT(Graph, Expanded, LoopCount);
 			if (CurrentNode != EndNode) {
 				CurrentNode = Find(Start);
 				Heuristic CurrentHeuristic = HEURISTIC_MAX;
@@ -511,6 +583,19 @@ namespace Toolbox {
 			return Route;
 		}
 
+		/**
+		 * Returns an immutable compact snapshot of this graph for repeated searches.<br/>
+		 * Inactive nodes and connections are left out of the snapshot, so it must be frozen again after they change.
+		 */
+		CompactGraph<Type, HEURISTIC_FUNC> Freeze() const {
+			return CompactGraph<Type, HEURISTIC_FUNC>(*this);
+		}
+
+		/** Calculates the shortest path for each of the given queries across the given pool's threads and returns each path in the same order. */
+		Vector<Stack<NodeCode>> BuildPaths(const Vector<PathQuery>& Queries, ThreadPool& Pool = ThreadPool::Default()) const {
+			return Freeze().BuildPaths(Queries, Pool);
+		}
+
 
 		// TO STRING
 
@@ -558,14 +643,625 @@ namespace Toolbox {
 
 		// AS MAP
 
+		/** Returns the allocator used for this graph's nodes. */
+		const AllocatorType& GetAllocator() const {
+			return nodes.GetAllocator();
+		}
+
 		/** Returns a reference to this graph's underlying map. */
-		Map<NodeCode, Node>& AsMap() {
+		Map<NodeCode, Node, Hashify, AllocatorType>& AsMap() {
 			return nodes;
 		}
 
 		/** Returns a constant reference to this graph's underlying map. */
-		const Map<NodeCode, Node>& AsMap() const {
+		const Map<NodeCode, Node, Hashify, AllocatorType>& AsMap() const {
 			return nodes;
 		}
 	};
+
+
+	// NODE INDEX
+
+	/** A dense number used to represent an individual node in a compact graph. */
+	using NodeIndex = uint32_t;
+
+
+	// SEARCH CONTEXT
+
+	/**
+	 * Reusable scratch memory for searches on compact graphs.<br/>
+	 * Each search stamps the nodes it reaches with a new generation, so starting a search never clears the whole context.
+	 */
+	class SearchContext final {
+
+		// FRIENDS
+
+		template<typename OtherType, Heuristic(*OTHER_HEURISTIC_FUNC)(const GraphNode<OtherType>&, const GraphNode<OtherType>&)>
+		friend class CompactGraph;
+
+
+		// ENTRY
+
+		/** A node waiting in a search's frontier and the cost it was pushed with. */
+		struct Entry final {
+
+			// DATA
+
+			/** The index of the node to expand. */
+			NodeIndex index;
+
+			/** The cost of reaching the node when it was pushed, used to skip outdated entries. */
+			NodeWeight cost;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Entry(const NodeIndex Index = INVALID_NODE_INDEX, const NodeWeight Cost = 0) : index(Index), cost(Cost) {
+			}
+		};
+
+
+		// DATA
+
+		/** The current generation of each node, which is only valid for this search if it matches the context's generation. */
+		Vector<uint32_t> stamps;
+
+		/** The cost of reaching each node in the current search. */
+		Vector<NodeWeight> costs;
+
+		/** The node each node was reached from in the current search. */
+		Vector<NodeIndex> parents;
+
+		/** Each node reached by the current search in the order they were reached. */
+		Vector<NodeIndex> reached;
+
+		/** The weighted frontier of the current search. */
+		Heap<Entry, Heuristic> frontier;
+
+		/** The generation of the current search. */
+		uint32_t generation;
+
+
+		// SEARCHING
+
+		/** Prepares this context for a new search of a graph with the given number of nodes. */
+		void Begin(const size_t Count) {
+			if (stamps.Size() < Count) {
+				stamps = Vector<uint32_t>(Count);
+				costs = Vector<NodeWeight>(Count, UNREACHED_WEIGHT);
+				parents = Vector<NodeIndex>(Count, INVALID_NODE_INDEX);
+				generation = 0;
+			}
+			++generation;
+			if (generation == 0) {
+				stamps.Fill(0);
+				generation = 1;
+			}
+			reached.Clear();
+			frontier.Clear();
+		}
+
+		/** Reaches the given node with the given cost if it is cheaper than its current cost, and returns whether it was. */
+		bool Relax(const NodeIndex Index, const NodeWeight Cost, const NodeIndex Parent) {
+			if (stamps.Unchecked(Index) != generation) {
+				stamps.Unchecked(Index) = generation;
+				reached.PushBack(Index);
+			}
+			else if (!(Cost < costs.Unchecked(Index))) {
+				return false;
+			}
+			costs.Unchecked(Index) = Cost;
+			parents.Unchecked(Index) = Parent;
+			return true;
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		SearchContext(const size_t Count = 0) : stamps(Count), costs(Count, UNREACHED_WEIGHT), parents(Count, INVALID_NODE_INDEX), reached(), frontier(), generation(0) {
+		}
+
+		/** Copy constructor. */
+		SearchContext(const SearchContext& Copied) = default;
+
+		/** Move constructor. */
+		SearchContext(SearchContext&& Moved) noexcept = default;
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		SearchContext& operator=(const SearchContext& Copied) = default;
+
+		/** Move assignment operator. */
+		SearchContext& operator=(SearchContext&& Moved) noexcept = default;
+
+
+		// GETTERS
+
+		/** Returns whether the last search reached the given node. */
+		bool IsReached(const NodeIndex Index) const {
+			return Index < stamps.Size() && generation != 0 && stamps.Unchecked(Index) == generation;
+		}
+
+		/** Returns the cost of reaching the given node in the last search, or UNREACHED_WEIGHT if it was not reached. */
+		NodeWeight Cost(const NodeIndex Index) const {
+			return IsReached(Index) ? costs.Unchecked(Index) : UNREACHED_WEIGHT;
+		}
+
+		/** Returns the node the given node was reached from in the last search, or INVALID_NODE_INDEX if it is a source or was not reached. */
+		NodeIndex Parent(const NodeIndex Index) const {
+			return IsReached(Index) ? parents.Unchecked(Index) : INVALID_NODE_INDEX;
+		}
+
+		/** Returns each node reached by the last search in the order they were reached. */
+		const Vector<NodeIndex>& Reached() const {
+			return reached;
+		}
+	};
+
+
+	// COMPACT GRAPH
+
+	/**
+	 * An immutable snapshot of a graph with dense node indices and contiguous connections (compressed sparse rows).<br/>
+	 * Searches read flat arrays and write only to a caller owned search context, so one snapshot can be searched by many threads at once.
+	 */
+	template<typename Type, Heuristic(*HEURISTIC_FUNC)(const GraphNode<Type>&, const GraphNode<Type>&)>
+	class CompactGraph final {
+		static_assert(HEURISTIC_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
+	public:
+
+		// NODE AND GRAPH
+
+		/** Represents an individual graph node with its own data (compact graph nodes keep no connections). */
+		using Node = GraphNode<Type>;
+
+		/** A collection of interconnected nodes that can be traversed based on their weights. */
+		using Graph = Toolbox::Graph<Type, HEURISTIC_FUNC>;
+
+	private:
+
+		// DATA
+
+		/** The code of each node sorted in ascending order, so a node's index is its position in this array. */
+		Vector<NodeCode> codes;
+
+		/** A copy of each node's code, data, and weight. */
+		Vector<Node> nodes;
+
+		/** The index of each node's first connection, followed by the total number of connections. */
+		Vector<size_t> offsets;
+
+		/** The index of the node each connection is linked towards. */
+		Vector<NodeIndex> targets;
+
+		/** The cost of traversing each connection, which includes the weight of the node it is linked towards. */
+		Vector<NodeWeight> weights;
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		CompactGraph() : codes(), nodes(), offsets(1), targets(), weights() {
+		}
+
+		/** Graph constructor, which accepts a graph using any allocator. */
+		template<typename AllocatorType>
+		explicit CompactGraph(const Toolbox::Graph<Type, HEURISTIC_FUNC, AllocatorType>& Source) : codes(), nodes(), offsets(), targets(), weights() {
+			const size_t Count = Source.Size();
+			if (Count >= INVALID_NODE_INDEX) {
+				throw std::runtime_error("ERROR: Too many nodes to compact a graph!");
+			}
+			codes.Reserve(Count);
+			for (auto& Bucket : Source.AsMap().AsVector()) {
+				for (auto& Pair : Bucket) {
+					codes.PushBack(Pair.key);
+				}
+			}
+			codes.RadixSort();
+			nodes.Reserve(Count);
+			offsets.Reserve(Count + 1);
+			offsets.PushBack(0);
+			for (const NodeCode Code : codes) {
+				const Node* Current = Source.Find(Code);
+				nodes.EmplaceBack(Code, Current->Data, Current->Weight, Current->Active);
+				for (auto& Bucket : Current->Connections().AsVector()) {
+					for (auto& Pair : Bucket) {
+						const Connection<Type>& Connection = Pair.value;
+						if (!Connection.Active) {
+							continue;
+						}
+						const Node* ToNode = Source.Find(Connection.To());
+						if (ToNode == nullptr || !ToNode->Active) {
+							continue;
+						}
+						targets.PushBack(IndexOf(Connection.To()));
+						weights.PushBack(Connection.Weight + ToNode->Weight);
+					}
+				}
+				offsets.PushBack(targets.Size());
+			}
+		}
+
+		/** Copy constructor. */
+		CompactGraph(const CompactGraph& Copied) = default;
+
+		/** Move constructor. */
+		CompactGraph(CompactGraph&& Moved) noexcept = default;
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		CompactGraph& operator=(const CompactGraph& Copied) = default;
+
+		/** Move assignment operator. */
+		CompactGraph& operator=(CompactGraph&& Moved) noexcept = default;
+
+
+		// GETTERS
+
+		/** Returns the number of nodes in the graph. */
+		size_t Size() const {
+			return nodes.Size();
+		}
+
+		/** Returns the total number of active connections in the graph. */
+		size_t TotalConnections() const {
+			return targets.Size();
+		}
+
+		/** Returns whether the graph is empty. */
+		bool IsEmpty() const {
+			return nodes.IsEmpty();
+		}
+
+		/** Returns the index of the given node code, or INVALID_NODE_INDEX if it is not in the graph. */
+		NodeIndex IndexOf(const NodeCode Code) const {
+			size_t Low = 0;
+			size_t High = codes.Size();
+			while (Low < High) {
+				const size_t Middle = Low + (High - Low) / 2;
+				if (codes.Unchecked(Middle) < Code) {
+					Low = Middle + 1;
+				}
+				else {
+					High = Middle;
+				}
+			}
+			return Low < codes.Size() && codes.Unchecked(Low) == Code ? static_cast<NodeIndex>(Low) : INVALID_NODE_INDEX;
+		}
+
+		/** Returns the code of the node at the given index. */
+		NodeCode CodeOf(const NodeIndex Index) const {
+			return codes.At(Index);
+		}
+
+		/** Returns a constant reference to the node at the given index. */
+		const Node& At(const NodeIndex Index) const {
+			return nodes.At(Index);
+		}
+
+		/** Finds and returns a constant pointer to the given node in the graph, or nullptr if it does not exist. */
+		const Node* Find(const NodeCode Code) const {
+			const NodeIndex Index = IndexOf(Code);
+			return Index != INVALID_NODE_INDEX ? &nodes.Unchecked(Index) : nullptr;
+		}
+
+		/** Returns whether the given node is present in the graph. */
+		bool Contains(const NodeCode Code) const {
+			return IndexOf(Code) != INVALID_NODE_INDEX;
+		}
+
+		/** Returns the number of connections leaving the node at the given index. */
+		size_t TotalConnections(const NodeIndex Index) const {
+			return offsets.At(Index + 1) - offsets.At(Index);
+		}
+
+
+		// NAVIGATION
+
+		/**
+		 * Calculates the shortest path from the given start node to the given end node using the A Star Search algorithm.<br/>
+		 * This matches Graph::BuildPath, but reuses the given context's memory instead of allocating its own.
+		 */
+		Stack<NodeCode> BuildPath(const NodeCode Start, const NodeCode End, SearchContext& Context) const {
+			if (Start == INVALID_NODE_CODE || End == INVALID_NODE_CODE || Start == End) {
+				return Stack<NodeCode>();
+			}
+			const NodeIndex StartIndex = IndexOf(Start);
+			const NodeIndex EndIndex = IndexOf(End);
+			if (StartIndex == INVALID_NODE_INDEX || EndIndex == INVALID_NODE_INDEX) {
+				return Stack<NodeCode>();
+			}
+			Context.Begin(nodes.Size());
+			Context.Relax(StartIndex, 0, INVALID_NODE_INDEX);
+			Context.frontier.Push(SearchContext::Entry(StartIndex, 0), 0);
+			const Node& EndNode = nodes.Unchecked(EndIndex);
+			NodeIndex Current = StartIndex;
+			size_t LoopCount = 0;
+			while (!Context.frontier.IsEmpty()) {
+				const SearchContext::Entry Entry = Context.frontier.Pop();
+				if (Entry.cost != Context.costs.Unchecked(Entry.index)) {
+					continue;
+				}
+				++LoopCount;
+				if (LoopCount > MAX_LOOPS) {
+					break;
+				}
+				Current = Entry.index;
+				if (Current == EndIndex) {
+					break;
+				}
+				for (size_t Edge = offsets.Unchecked(Current); Edge < offsets.Unchecked(Current + 1); ++Edge) {
+					const NodeIndex To = targets.Unchecked(Edge);
+					const NodeWeight NewCost = Entry.cost + weights.Unchecked(Edge);
+					if (Context.Relax(To, NewCost, Current)) {
+						const Heuristic Priority = static_cast<Heuristic>(NewCost) + HEURISTIC_FUNC(nodes.Unchecked(To), EndNode);
+						Context.frontier.Push(SearchContext::Entry(To, NewCost), Priority);
+					}
+				}
+			}
+			Context.frontier.Clear();
+			TOOLBOX_COUNT(Graph, Searches, 1);
+			TOOLBOX_COUNT(Graph, Expanded, LoopCount);
+			if (Current != EndIndex) {
+				Current = StartIndex;
+				Heuristic CurrentHeuristic = HEURISTIC_MAX;
+				for (const NodeIndex Index : Context.reached) {
+					const Heuristic NewHeuristic = HEURISTIC_FUNC(nodes.Unchecked(Index), EndNode);
+					if (NewHeuristic < CurrentHeuristic) {
+						Current = Index;
+						CurrentHeuristic = NewHeuristic;
+					}
+				}
+			}
+			return Route(Current, Context);
+		}
+
+		/**
+		 * Calculates the cheapest cost from the given start node to every node it can reach using Dijkstra's algorithm.<br/>
+		 * The costs and paths are stored in the given context and returns the number of nodes reached.
+		 */
+		size_t Dijkstra(const NodeCode Start, SearchContext& Context) const {
+			Context.Begin(nodes.Size());
+			Seed(Start, Context);
+			Settle<false>(Context);
+			return Context.reached.Size();
+		}
+
+		/**
+		 * Calculates the cheapest cost from the nearest of the given start nodes to every node they can reach using Dijkstra's algorithm.<br/>
+		 * The costs and paths are stored in the given context and returns the number of nodes reached.
+		 */
+		size_t Dijkstra(const Vector<NodeCode>& Starts, SearchContext& Context) const {
+			Context.Begin(nodes.Size());
+			for (const NodeCode Start : Starts) {
+				Seed(Start, Context);
+			}
+			Settle<false>(Context);
+			return Context.reached.Size();
+		}
+
+		/**
+		 * Calculates the cheapest cost from every node to its nearest goal node, and returns the index of the next node each node should move to.<br/>
+		 * Goals and nodes that cannot reach a goal move to INVALID_NODE_INDEX, and each node's cost to its goal is stored in the given context.<br/>
+		 * NOTE: This assumes each connection has a matching connection back with the same weight, as Graph::Connect creates.
+		 */
+		Vector<NodeIndex> FlowField(const Vector<NodeCode>& Goals, SearchContext& Context) const {
+			Context.Begin(nodes.Size());
+			for (const NodeCode Goal : Goals) {
+				Seed(Goal, Context);
+			}
+			Settle<true>(Context);
+			Vector<NodeIndex> Next(nodes.Size(), INVALID_NODE_INDEX);
+			for (const NodeIndex Index : Context.reached) {
+				Next.Unchecked(Index) = Context.parents.Unchecked(Index);
+			}
+			return Next;
+		}
+
+		/**
+		 * Calculates the fewest number of connections from the given start node to every node it can reach using a breadth first search.<br/>
+		 * The connection counts (stored as costs) and paths are stored in the given context and returns the number of nodes reached.
+		 */
+		size_t BreadthFirst(const NodeCode Start, SearchContext& Context) const {
+			Context.Begin(nodes.Size());
+			const NodeIndex StartIndex = IndexOf(Start);
+			if (StartIndex == INVALID_NODE_INDEX) {
+				return 0;
+			}
+			Context.Relax(StartIndex, 0, INVALID_NODE_INDEX);
+			for (size_t Next = 0; Next < Context.reached.Size(); ++Next) {
+				const NodeIndex Current = Context.reached.Unchecked(Next);
+				const NodeWeight NewCost = Context.costs.Unchecked(Current) + 1;
+				for (size_t Edge = offsets.Unchecked(Current); Edge < offsets.Unchecked(Current + 1); ++Edge) {
+					const NodeIndex To = targets.Unchecked(Edge);
+					if (Context.stamps.Unchecked(To) != Context.generation) {
+						Context.Relax(To, NewCost, Current);
+					}
+				}
+			}
+			return Context.reached.Size();
+		}
+
+		/**
+		 * Calculates the fewest number of connections from the nearest of the given start nodes to every node they can reach, one level at a time across the given pool's threads.<br/>
+		 * The connection counts (stored as costs) and paths are stored in the given context and returns the number of nodes reached.<br/>
+		 * Searching from goal nodes gives each node's next step towards its nearest goal as its parent, assuming connections go both ways.
+		 */
+		size_t ParallelBreadthFirst(const Vector<NodeCode>& Starts, SearchContext& Context, ThreadPool& Pool = ThreadPool::Default()) const {
+			Context.Begin(nodes.Size());
+			for (const NodeCode Start : Starts) {
+				const NodeIndex StartIndex = IndexOf(Start);
+				if (StartIndex != INVALID_NODE_INDEX) {
+					Context.Relax(StartIndex, 0, INVALID_NODE_INDEX);
+				}
+			}
+			Vector<Vector<NodeIndex>> Found(Pool.Threads() + 1);
+			Vector<uint8_t> Claimed(Found.Size());
+			const uint32_t Generation = Context.generation;
+			size_t LevelBegin = 0;
+			NodeWeight Level = 0;
+			while (LevelBegin < Context.reached.Size()) {
+				const size_t LevelEnd = Context.reached.Size();
+				++Level;
+				if (LevelEnd - LevelBegin < PARALLEL_SEARCH_THRESHOLD) {
+					for (size_t Next = LevelBegin; Next < LevelEnd; ++Next) {
+						const NodeIndex Current = Context.reached.Unchecked(Next);
+						for (size_t Edge = offsets.Unchecked(Current); Edge < offsets.Unchecked(Current + 1); ++Edge) {
+							const NodeIndex To = targets.Unchecked(Edge);
+							if (Context.stamps.Unchecked(To) != Generation) {
+								Context.Relax(To, Level, Current);
+							}
+						}
+					}
+				}
+				else {
+					Pool.ParallelFor(LevelBegin, LevelEnd, [&](const size_t First, const size_t Last) {
+						const SlotClaim Slot(Claimed);
+						Vector<NodeIndex>& Local = Found.Unchecked(Slot.index);
+						for (size_t Next = First; Next < Last; ++Next) {
+							const NodeIndex Current = Context.reached.Unchecked(Next);
+							for (size_t Edge = offsets.Unchecked(Current); Edge < offsets.Unchecked(Current + 1); ++Edge) {
+								const NodeIndex To = targets.Unchecked(Edge);
+								std::atomic_ref<uint32_t> Stamp(Context.stamps.Unchecked(To));
+								uint32_t Previous = Stamp.load(std::memory_order_relaxed);
+								if (Previous != Generation && Stamp.compare_exchange_strong(Previous, Generation, std::memory_order_relaxed)) {
+									Context.costs.Unchecked(To) = Level;
+									Context.parents.Unchecked(To) = Current;
+									Local.PushBack(To);
+								}
+							}
+						}
+					});
+					for (auto& Local : Found) {
+						for (const NodeIndex Index : Local) {
+							Context.reached.PushBack(Index);
+						}
+						Local.Clear();
+					}
+				}
+				LevelBegin = LevelEnd;
+			}
+			return Context.reached.Size();
+		}
+
+		/**
+		 * Calculates the shortest path for each of the given queries across the given pool's threads and returns each path in the same order.<br/>
+		 * Each chunk of queries claims a search context that no other chunk is using and reuses it for every query in the chunk.
+		 */
+		Vector<Stack<NodeCode>> BuildPaths(const Vector<PathQuery>& Queries, ThreadPool& Pool = ThreadPool::Default()) const {
+			Vector<Stack<NodeCode>> Paths(Queries.Size());
+			Vector<SearchContext> Contexts(Pool.Threads() + 1);
+			Vector<uint8_t> Claimed(Contexts.Size());
+			Pool.ParallelFor(0, Queries.Size(), [&](const size_t First, const size_t Last) {
+				const SlotClaim Slot(Claimed);
+				SearchContext& Context = Contexts.Unchecked(Slot.index);
+				for (size_t Index = First; Index < Last; ++Index) {
+					const PathQuery& Query = Queries.Unchecked(Index);
+					Paths.Unchecked(Index) = BuildPath(Query.Start, Query.End, Context);
+				}
+			});
+			return Paths;
+		}
+
+		/** Returns the path to the given node from the source of the given context's last search, or an empty path if it was not reached. */
+		Stack<NodeCode> PathTo(const NodeCode End, const SearchContext& Context) const {
+			const NodeIndex EndIndex = IndexOf(End);
+			if (!Context.IsReached(EndIndex)) {
+				return Stack<NodeCode>();
+			}
+			return Route(EndIndex, Context);
+		}
+
+	private:
+
+		// SCRATCH
+
+		/**
+		 * Claims an unused slot of a parallel search's scratch space for as long as it exists.<br/>
+		 * A pool runs at most one chunk per worker plus the calling thread at once, so one slot per worker plus one is always enough.
+		 */
+		struct SlotClaim final {
+
+			/** The flags of which slots are in use. */
+			Vector<uint8_t>& claimed;
+
+			/** The index of the claimed slot. */
+			size_t index;
+
+			/** Default constructor that claims the first unused slot of the given flags. */
+			explicit SlotClaim(Vector<uint8_t>& Claimed) : claimed(Claimed), index(0) {
+				for (;; index = index + 1 < claimed.Size() ? index + 1 : 0) {
+					std::atomic_ref<uint8_t> Flag(claimed.Unchecked(index));
+					uint8_t Unused = 0;
+					if (Flag.load(std::memory_order_relaxed) == 0 && Flag.compare_exchange_strong(Unused, 1, std::memory_order_acquire)) {
+						return;
+					}
+				}
+			}
+
+			/** Delete copy constructor. */
+			SlotClaim(const SlotClaim&) = delete;
+
+			/** Destructor that releases the claimed slot. */
+			~SlotClaim() {
+				std::atomic_ref<uint8_t>(claimed.Unchecked(index)).store(0, std::memory_order_release);
+			}
+		};
+
+
+		// SEARCHING
+
+		/** Starts the given context's search from the given node if it is in the graph. */
+		void Seed(const NodeCode Start, SearchContext& Context) const {
+			const NodeIndex StartIndex = IndexOf(Start);
+			if (StartIndex != INVALID_NODE_INDEX && Context.Relax(StartIndex, 0, INVALID_NODE_INDEX)) {
+				Context.frontier.Push(SearchContext::Entry(StartIndex, 0), 0);
+			}
+		}
+
+		/**
+		 * Expands the given context's frontier in order of cost until it is empty.<br/>
+		 * Reversed searches measure the cost of travelling back along each connection, so costs are towards the sources rather than from them.
+		 */
+		template<bool REVERSED>
+		void Settle(SearchContext& Context) const {
+			while (!Context.frontier.IsEmpty()) {
+				const SearchContext::Entry Entry = Context.frontier.Pop();
+				if (Entry.cost != Context.costs.Unchecked(Entry.index)) {
+					continue;
+				}
+				for (size_t Edge = offsets.Unchecked(Entry.index); Edge < offsets.Unchecked(Entry.index + 1); ++Edge) {
+					const NodeIndex To = targets.Unchecked(Edge);
+					NodeWeight NewCost = Entry.cost + weights.Unchecked(Edge);
+					if constexpr (REVERSED) {
+						NewCost = NewCost - nodes.Unchecked(To).Weight + nodes.Unchecked(Entry.index).Weight;
+					}
+					if (Context.Relax(To, NewCost, Entry.index)) {
+						Context.frontier.Push(SearchContext::Entry(To, NewCost), static_cast<Heuristic>(NewCost));
+					}
+				}
+			}
+		}
+
+
+		// ROUTES
+
+		/** Builds the path to the given reached node by following each node's parent in the given context. */
+		Stack<NodeCode> Route(NodeIndex Current, const SearchContext& Context) const {
+			Stack<NodeCode> Route;
+			while (Context.parents.Unchecked(Current) != INVALID_NODE_INDEX) {
+				Route.Push(codes.Unchecked(Current));
+				Current = Context.parents.Unchecked(Current);
+			}
+			return Route;
+		}
+	};
 }
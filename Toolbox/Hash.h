@@ -0,0 +1,204 @@
+// .h
+// Hash Functions
+// by Kyle Furey
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+// The default seed of the byte hash function.
+#define HASH_SEED 0xA0761D6478BD642Full
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// HASH FUNCTION
+
+	/** A unique value that represents the current state of an instance. */
+	using Hash = size_t;
+
+	/** Returns a unique unsigned number representing the state of the given value's binary. */
+	template<typename Type>
+	inline Hash Hashify(const Type& Value) {
+		return std::hash<Type>{}(Value);
+		/*
+		void* Memory = (void*)&Value;
+		switch (sizeof(Type)) {
+		case 1:
+			return (Hash)(*(uint8_t*)Memory);
+		case 2:
+		case 3:
+			return (Hash)(*(uint16_t*)Memory);
+		case 4:
+		case 5:
+		case 6:
+		case 7:
+			return (Hash)(*(uint32_t*)Memory);
+		default:
+			return (Hash)(*(uint64_t*)Memory);
+		}
+		*/
+	}
+
+
+	// MIXING
+
+	/** The constants the byte hash function mixes its input with. */
+	inline constexpr uint64_t HashSecret[4] = { 0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull, 0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull };
+
+	/** Multiplies the given numbers into a 128 bit product and stores its lower half in the left number and upper half in the right number. */
+	inline void HashMultiply(uint64_t& Left, uint64_t& Right) {
+#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 Product = static_cast<unsigned __int128>(Left) * Right;
+		Left = static_cast<uint64_t>(Product);
+		Right = static_cast<uint64_t>(Product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		Left = _umul128(Left, Right, &Right);
+#else
+		const uint64_t LeftHigh = Left >> 32, LeftLow = static_cast<uint32_t>(Left), RightHigh = Right >> 32, RightLow = static_cast<uint32_t>(Right);
+		const uint64_t High = LeftHigh * RightHigh, Middle = LeftHigh * RightLow, Crossed = LeftLow * RightHigh, Low = LeftLow * RightLow;
+		const uint64_t Carry = ((Low >> 32) + static_cast<uint32_t>(Middle) + static_cast<uint32_t>(Crossed)) >> 32;
+		Left = Low + (Middle << 32) + (Crossed << 32);
+		Right = High + (Middle >> 32) + (Crossed >> 32) + Carry;
+#endif
+	}
+
+	/** Returns both halves of the 128 bit product of the given numbers combined together. */
+	inline uint64_t HashMix(uint64_t Left, uint64_t Right) {
+		HashMultiply(Left, Right);
+		return Left ^ Right;
+	}
+
+	/** Returns the given integer with its bits fully mixed, so nearby integers produce unrelated hashes. */
+	inline Hash MixHash(uint64_t Value) {
+		Value ^= Value >> 30;
+		Value *= 0xBF58476D1CE4E5B9ull;
+		Value ^= Value >> 27;
+		Value *= 0x94D049BB133111EBull;
+		Value ^= Value >> 31;
+		return static_cast<Hash>(Value);
+	}
+
+	/** Returns the given hashes combined into one hash that depends on their order. */
+	inline Hash CombineHash(const Hash Seed, const Hash Value) {
+		return static_cast<Hash>(HashMix(static_cast<uint64_t>(Seed) ^ HashSecret[0], static_cast<uint64_t>(Value) ^ HashSecret[1]));
+	}
+
+
+	// BYTES
+
+	/** Reads the given number of bytes as an unsigned integer in the machine's byte order. */
+	template<typename Type>
+	inline uint64_t HashRead(const unsigned char* Bytes) {
+		Type Value;
+		std::memcpy(&Value, Bytes, sizeof(Type));
+		return Value;
+	}
+
+	/**
+	 * Returns a hash of the given number of bytes (wyhash), which reads eight bytes at a time and mixes with 128 bit products.<br/>
+	 * Hashes depend on the machine's byte order, so they should not be stored across machines.
+	 */
+	inline Hash HashBytes(const void* Data, const size_t Length, uint64_t Seed = HASH_SEED) {
+		const unsigned char* Bytes = static_cast<const unsigned char*>(Data);
+		Seed ^= HashMix(Seed ^ HashSecret[0], HashSecret[1]);
+		uint64_t Left, Right;
+		if (Length <= 16) {
+			if (Length >= 4) {
+				const size_t Offset = (Length >> 3) << 2;
+				Left = (HashRead<uint32_t>(Bytes) << 32) | HashRead<uint32_t>(Bytes + Offset);
+				Right = (HashRead<uint32_t>(Bytes + Length - 4) << 32) | HashRead<uint32_t>(Bytes + Length - 4 - Offset);
+			}
+			else if (Length > 0) {
+				Left = (static_cast<uint64_t>(Bytes[0]) << 16) | (static_cast<uint64_t>(Bytes[Length >> 1]) << 8) | Bytes[Length - 1];
+				Right = 0;
+			}
+			else {
+				Left = Right = 0;
+			}
+		}
+		else {
+			size_t Remaining = Length;
+			if (Remaining > 48) {
+				uint64_t First = Seed, Second = Seed;
+				do {
+					Seed = HashMix(HashRead<uint64_t>(Bytes) ^ HashSecret[1], HashRead<uint64_t>(Bytes + 8) ^ Seed);
+					First = HashMix(HashRead<uint64_t>(Bytes + 16) ^ HashSecret[2], HashRead<uint64_t>(Bytes + 24) ^ First);
+					Second = HashMix(HashRead<uint64_t>(Bytes + 32) ^ HashSecret[3], HashRead<uint64_t>(Bytes + 40) ^ Second);
+					Bytes += 48;
+					Remaining -= 48;
+				} while (Remaining > 48);
+				Seed ^= First ^ Second;
+			}
+			while (Remaining > 16) {
+				Seed = HashMix(HashRead<uint64_t>(Bytes) ^ HashSecret[1], HashRead<uint64_t>(Bytes + 8) ^ Seed);
+				Bytes += 16;
+				Remaining -= 16;
+			}
+			Left = HashRead<uint64_t>(Bytes + Remaining - 16);
+			Right = HashRead<uint64_t>(Bytes + Remaining - 8);
+		}
+		Left ^= HashSecret[1];
+		Right ^= Seed;
+		HashMultiply(Left, Right);
+		return static_cast<Hash>(HashMix(Left ^ HashSecret[0] ^ Length, Right ^ HashSecret[1]));
+	}
+
+
+	// CHARACTERS
+
+	/** Whether the given type is a string that stores its characters contiguously behind begin() and counts them with Length(). */
+	template<typename Type, typename = void>
+	constexpr bool HasCharacters = false;
+
+	/** Whether the given type is a string that stores its characters contiguously behind begin() and counts them with Length(). */
+	template<typename Type>
+	constexpr bool HasCharacters<Type, std::void_t<decltype(std::declval<const Type&>().Length()), std::enable_if_t<std::is_pointer_v<decltype(std::declval<const Type&>().begin())>>>> = true;
+
+
+	// FAST HASH FUNCTION
+
+	/**
+	 * Returns a high quality hash of the given value, which can be passed as any hash table's HASH_FUNC.<br/>
+	 * Integers, enumerations, and pointers are mixed, strings and types without padding have their bytes hashed, and other types mix their std::hash.
+	 */
+	template<typename Type>
+	inline Hash FastHash(const Type& Value) {
+		if constexpr (std::is_integral_v<Type> || std::is_enum_v<Type>) {
+			return MixHash(static_cast<uint64_t>(Value));
+		}
+		else if constexpr (std::is_pointer_v<Type>) {
+			return MixHash(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Value)));
+		}
+		else if constexpr (HasCharacters<Type>) {
+			return HashBytes(Value.begin(), Value.Length() * sizeof(*Value.begin()));
+		}
+		else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+			const std::string_view View = Value;
+			return HashBytes(View.data(), View.size());
+		}
+		else if constexpr (std::has_unique_object_representations_v<Type>) {
+			return HashBytes(&Value, sizeof(Type));
+		}
+		else {
+			return MixHash(static_cast<uint64_t>(std::hash<Type>{}(Value)));
+		}
+	}
+
+	/** Returns a hash of the given integer with its bits fully mixed, which can be passed as any hash table's HASH_FUNC. */
+	template<typename Type>
+	inline Hash IntegerHash(const Type& Value) {
+		static_assert(std::is_integral_v<Type> || std::is_enum_v<Type>, "ERROR: Only integers can be hashed with an integer hash!");
+		return MixHash(static_cast<uint64_t>(Value));
+	}
+}
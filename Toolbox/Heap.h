@@ -0,0 +1,547 @@
+// .h
+// Heap Types
+// by Kyle Furey
+
+#pragma once
+#include "Vector.h"
+
+// The default number of children of each node in a heap.
+#define HEAP_ARITY 4
+
+// Represents an invalid heap handle.
+#define INVALID_HEAP_HANDLE SIZE_MAX
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// HEAP
+
+	/**
+	 * A contiguous d-ary min heap where the element with the lowest priority is always popped first.<br/>
+	 * Pushing and popping are both logarithmic and never allocate individual nodes.
+	 */
+	template<typename Type, typename PriorityType = double, size_t ARITY = HEAP_ARITY>
+	class Heap final {
+		static_assert(ARITY >= 2, "ERROR: A heap must have an arity of at least 2!");
+
+		// NODE
+
+		/** Represents an element's data and its priority in the heap. */
+		struct Node final {
+
+			// DATA
+
+			/** The data of this node. */
+			Type data;
+
+			/** The priority value of this node. */
+			PriorityType priority;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Node(const Type& Data = Type(), const PriorityType Priority = 0) : data(Data), priority(Priority) {
+			}
+		};
+
+
+		// DATA
+
+		/** The underlying array of nodes ordered as an implicit d-ary tree. */
+		Vector<Node> nodes;
+
+
+		// SIFTING
+
+		/** Moves the node at the given index towards the root until its parent has a lower or equal priority. */
+		void SiftUp(size_t Index) {
+			Node* Nodes = nodes.begin();
+			Node Moving = std::move(Nodes[Index]);
+			while (Index > 0) {
+				const size_t Parent = (Index - 1) / ARITY;
+				if (!(Moving.priority < Nodes[Parent].priority)) {
+					break;
+				}
+				Nodes[Index] = std::move(Nodes[Parent]);
+				Index = Parent;
+			}
+			Nodes[Index] = std::move(Moving);
+		}
+
+		/** Moves the node at the given index towards the leaves until each of its children has a greater or equal priority. */
+		void SiftDown(size_t Index) {
+			Node* Nodes = nodes.begin();
+			const size_t Size = nodes.Size();
+			Node Moving = std::move(Nodes[Index]);
+			while (true) {
+				const size_t First = Index * ARITY + 1;
+				if (First >= Size) {
+					break;
+				}
+				const size_t Last = First + ARITY < Size ? First + ARITY : Size;
+				size_t Lowest = First;
+				for (size_t Child = First + 1; Child < Last; ++Child) {
+					if (Nodes[Child].priority < Nodes[Lowest].priority) {
+						Lowest = Child;
+					}
+				}
+				if (!(Nodes[Lowest].priority < Moving.priority)) {
+					break;
+				}
+				Nodes[Index] = std::move(Nodes[Lowest]);
+				Index = Lowest;
+			}
+			Nodes[Index] = std::move(Moving);
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		Heap(const size_t Capacity = 0) : nodes() {
+			nodes.Resize(Capacity);
+		}
+
+		/** Copy constructor. */
+		Heap(const Heap<Type, PriorityType, ARITY>& Copied) : nodes(Copied.nodes) {
+		}
+
+		/** Move constructor. */
+		Heap(Heap<Type, PriorityType, ARITY>&& Moved) noexcept : nodes(std::move(Moved.nodes)) {
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		Heap<Type, PriorityType, ARITY>& operator=(const Heap<Type, PriorityType, ARITY>& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			nodes = Copied.nodes;
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		Heap<Type, PriorityType, ARITY>& operator=(Heap<Type, PriorityType, ARITY>&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			nodes = std::move(Moved.nodes);
+			return *this;
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of elements in the heap. */
+		size_t Size() const {
+			return nodes.Size();
+		}
+
+		/** Returns the number of elements the heap can hold before reallocating. */
+		size_t Capacity() const {
+			return nodes.Capacity();
+		}
+
+		/** Returns a constant reference to the element with the lowest priority in the heap. */
+		const Type& Peek() const {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			return nodes.begin()->data;
+		}
+
+		/** Returns the current lowest priority value in the heap (the closest to being popped). */
+		PriorityType LowestPriority() const {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			return nodes.begin()->priority;
+		}
+
+		/** Returns whether the heap is empty. */
+		bool IsEmpty() const {
+			return nodes.IsEmpty();
+		}
+
+
+		// EXPANSION
+
+		/** Removes each element from the heap while keeping its memory. */
+		void Clear() {
+			nodes.Clear();
+		}
+
+		/** Ensures the heap can hold at least the given number of elements without reallocating. */
+		void Reserve(const size_t Capacity) {
+			if (Capacity > nodes.Capacity()) {
+				nodes.Resize(Capacity);
+			}
+		}
+
+		/** Pushes a copy of the given data to the heap relative to its priority value. */
+		void Push(const Type& Value, const PriorityType Priority) {
+			nodes.PushBack(Node(Value, Priority));
+			SiftUp(nodes.Size() - 1);
+		}
+
+		/** Removes and returns the element with the lowest priority in the heap. */
+		Type Pop() {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			Node* Nodes = nodes.begin();
+			Type Value = std::move(Nodes[0].data);
+			const size_t Last = nodes.Size() - 1;
+			if (Last > 0) {
+				Nodes[0] = std::move(Nodes[Last]);
+			}
+			nodes.PopBack();
+			if (Last > 1) {
+				SiftDown(0);
+			}
+			return Value;
+		}
+
+
+		// TO STRING
+
+		/** Returns the heap as a string in its underlying order. */
+		std::string ToString() const {
+			std::string String;
+			for (auto& Node : nodes) {
+				String += "{ " + std::to_string(Node.data) + " : " + std::to_string(Node.priority) + " }, ";
+			}
+			if (!String.empty()) {
+				String.erase(String.length() - 2, 2);
+			}
+			else {
+				return "{ }";
+			}
+			return String;
+		}
+	};
+
+
+	// INDEXED HEAP
+
+	/**
+	 * A contiguous d-ary min heap that returns a handle for each pushed element.<br/>
+	 * Handles can be used to check, reprioritize, or erase their elements in logarithmic time.<br/>
+	 * Handles are never reused until the heap is cleared.
+	 */
+	template<typename Type, typename PriorityType = double, size_t ARITY = HEAP_ARITY>
+	class IndexedHeap final {
+		static_assert(ARITY >= 2, "ERROR: A heap must have an arity of at least 2!");
+	public:
+
+		// HANDLE
+
+		/** A unique number used to refer to an element pushed to an indexed heap. */
+		using Handle = size_t;
+
+	private:
+
+		// NODE
+
+		/** Represents an element's data, its priority, and its handle in the heap. */
+		struct Node final {
+
+			// DATA
+
+			/** The data of this node. */
+			Type data;
+
+			/** The priority value of this node. */
+			PriorityType priority;
+
+			/** The handle used to refer to this node. */
+			Handle handle;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Node(const Type& Data = Type(), const PriorityType Priority = 0, const Handle Handle = INVALID_HEAP_HANDLE) : data(Data), priority(Priority), handle(Handle) {
+			}
+		};
+
+
+		// DATA
+
+		/** The underlying array of nodes ordered as an implicit d-ary tree. */
+		Vector<Node> nodes;
+
+		/** The current index of each handle's node, or INVALID_HEAP_HANDLE if it is no longer in the heap. */
+		Vector<size_t> positions;
+
+
+		// SIFTING
+
+		/** Moves the node at the given index towards the root until its parent has a lower or equal priority. */
+		void SiftUp(size_t Index) {
+			Node* Nodes = nodes.begin();
+			size_t* Positions = positions.begin();
+			Node Moving = std::move(Nodes[Index]);
+			while (Index > 0) {
+				const size_t Parent = (Index - 1) / ARITY;
+				if (!(Moving.priority < Nodes[Parent].priority)) {
+					break;
+				}
+				Nodes[Index] = std::move(Nodes[Parent]);
+				Positions[Nodes[Index].handle] = Index;
+				Index = Parent;
+			}
+			Positions[Moving.handle] = Index;
+			Nodes[Index] = std::move(Moving);
+		}
+
+		/** Moves the node at the given index towards the leaves until each of its children has a greater or equal priority. */
+		void SiftDown(size_t Index) {
+			Node* Nodes = nodes.begin();
+			size_t* Positions = positions.begin();
+			const size_t Size = nodes.Size();
+			Node Moving = std::move(Nodes[Index]);
+			while (true) {
+				const size_t First = Index * ARITY + 1;
+				if (First >= Size) {
+					break;
+				}
+				const size_t Last = First + ARITY < Size ? First + ARITY : Size;
+				size_t Lowest = First;
+				for (size_t Child = First + 1; Child < Last; ++Child) {
+					if (Nodes[Child].priority < Nodes[Lowest].priority) {
+						Lowest = Child;
+					}
+				}
+				if (!(Nodes[Lowest].priority < Moving.priority)) {
+					break;
+				}
+				Nodes[Index] = std::move(Nodes[Lowest]);
+				Positions[Nodes[Index].handle] = Index;
+				Index = Lowest;
+			}
+			Positions[Moving.handle] = Index;
+			Nodes[Index] = std::move(Moving);
+		}
+
+		/** Removes the node at the given index and restores the heap's order. */
+		void RemoveAt(const size_t Index) {
+			Node* Nodes = nodes.begin();
+			positions[Nodes[Index].handle] = INVALID_HEAP_HANDLE;
+			const size_t Last = nodes.Size() - 1;
+			if (Index != Last) {
+				Nodes[Index] = std::move(Nodes[Last]);
+				positions[Nodes[Index].handle] = Index;
+				nodes.PopBack();
+				if (Index > 0 && Nodes[Index].priority < Nodes[(Index - 1) / ARITY].priority) {
+					SiftUp(Index);
+				}
+				else {
+					SiftDown(Index);
+				}
+			}
+			else {
+				nodes.PopBack();
+			}
+		}
+
+		/** Returns the index of the given handle's node or throws if it is no longer in the heap. */
+		size_t IndexOf(const Handle Handle) const {
+			if (!Contains(Handle)) {
+				throw std::runtime_error(
+					std::string("ERROR: Handle ") +
+					std::to_string(Handle) +
+					" is not in the heap!");
+			}
+			return positions[Handle];
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		IndexedHeap(const size_t Capacity = 0) : nodes(), positions() {
+			nodes.Resize(Capacity);
+			positions.Resize(Capacity);
+		}
+
+		/** Copy constructor. */
+		IndexedHeap(const IndexedHeap<Type, PriorityType, ARITY>& Copied) : nodes(Copied.nodes), positions(Copied.positions) {
+		}
+
+		/** Move constructor. */
+		IndexedHeap(IndexedHeap<Type, PriorityType, ARITY>&& Moved) noexcept : nodes(std::move(Moved.nodes)), positions(std::move(Moved.positions)) {
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		IndexedHeap<Type, PriorityType, ARITY>& operator=(const IndexedHeap<Type, PriorityType, ARITY>& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			nodes = Copied.nodes;
+			positions = Copied.positions;
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		IndexedHeap<Type, PriorityType, ARITY>& operator=(IndexedHeap<Type, PriorityType, ARITY>&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			nodes = std::move(Moved.nodes);
+			positions = std::move(Moved.positions);
+			return *this;
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of elements in the heap. */
+		size_t Size() const {
+			return nodes.Size();
+		}
+
+		/** Returns a constant reference to the element with the lowest priority in the heap. */
+		const Type& Peek() const {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			return nodes.begin()->data;
+		}
+
+		/** Returns the handle of the element with the lowest priority in the heap. */
+		Handle PeekHandle() const {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			return nodes.begin()->handle;
+		}
+
+		/** Returns the current lowest priority value in the heap (the closest to being popped). */
+		PriorityType LowestPriority() const {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			return nodes.begin()->priority;
+		}
+
+		/** Returns whether the given handle's element is still in the heap. */
+		bool Contains(const Handle Handle) const {
+			return Handle < positions.Size() && positions[Handle] != INVALID_HEAP_HANDLE;
+		}
+
+		/** Returns a constant reference to the given handle's element. */
+		const Type& Get(const Handle Handle) const {
+			return nodes[IndexOf(Handle)].data;
+		}
+
+		/** Returns the priority of the given handle's element. */
+		PriorityType Priority(const Handle Handle) const {
+			return nodes[IndexOf(Handle)].priority;
+		}
+
+		/** Returns whether the heap is empty. */
+		bool IsEmpty() const {
+			return nodes.IsEmpty();
+		}
+
+
+		// SETTERS
+
+		/** Lowers the priority of the given handle's element, throwing if the new priority is greater than its current priority. */
+		void DecreaseKey(const Handle Handle, const PriorityType Priority) {
+			const size_t Index = IndexOf(Handle);
+			if (nodes[Index].priority < Priority) {
+				throw std::runtime_error("ERROR: Cannot decrease a heap element's key to a greater priority!");
+			}
+			nodes[Index].priority = Priority;
+			SiftUp(Index);
+		}
+
+		/** Sets the priority of the given handle's element to any new priority. */
+		void Update(const Handle Handle, const PriorityType Priority) {
+			const size_t Index = IndexOf(Handle);
+			const bool Decreased = Priority < nodes[Index].priority;
+			nodes[Index].priority = Priority;
+			if (Decreased) {
+				SiftUp(Index);
+			}
+			else {
+				SiftDown(Index);
+			}
+		}
+
+
+		// EXPANSION
+
+		/** Removes each element from the heap and invalidates every handle while keeping its memory. */
+		void Clear() {
+			nodes.Clear();
+			positions.Clear();
+		}
+
+		/** Ensures the heap can hold at least the given number of elements and handles without reallocating. */
+		void Reserve(const size_t Capacity) {
+			if (Capacity > nodes.Capacity()) {
+				nodes.Resize(Capacity);
+			}
+			if (Capacity > positions.Capacity()) {
+				positions.Resize(Capacity);
+			}
+		}
+
+		/** Pushes a copy of the given data to the heap relative to its priority value and returns its new handle. */
+		Handle Push(const Type& Value, const PriorityType Priority) {
+			const Handle New = positions.Size();
+			positions.PushBack(nodes.Size());
+			nodes.PushBack(Node(Value, Priority, New));
+			SiftUp(nodes.Size() - 1);
+			return New;
+		}
+
+		/** Removes and returns the element with the lowest priority in the heap. */
+		Type Pop() {
+			if (nodes.IsEmpty()) {
+				throw std::runtime_error("ERROR: The heap is empty!");
+			}
+			Type Value = std::move(nodes.begin()->data);
+			RemoveAt(0);
+			return Value;
+		}
+
+		/** Removes the given handle's element from the heap and returns whether it was still in the heap. */
+		bool Erase(const Handle Handle) {
+			if (!Contains(Handle)) {
+				return false;
+			}
+			RemoveAt(positions[Handle]);
+			return true;
+		}
+
+
+		// TO STRING
+
+		/** Returns the heap as a string in its underlying order. */
+		std::string ToString() const {
+			std::string String;
+			for (auto& Node : nodes) {
+				String += "{ " + std::to_string(Node.data) + " : " + std::to_string(Node.priority) + " }, ";
+			}
+			if (!String.empty()) {
+				String.erase(String.length() - 2, 2);
+			}
+			else {
+				return "{ }";
+			}
+			return String;
+		}
+	};
+}
@@ -9,19 +9,21 @@
 #include <stdexcept>
 #include <utility>
 #include "Sorting.h"
+#include "Pool.h"
+#include "Stats.h"
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
 
 	// LINKED LIST
 
-	/** Represents a doubly linked list of the given type. */
-	template<typename Type>
+	/** Represents a doubly linked list of the given type, whose nodes are pooled in slabs allocated with the given allocator. */
+	template<typename Type, typename AllocatorType = HeapAllocator>
 	class List final {
 
 		// NODE
 
-		/** An individual doubly linked node in a linked list. */
+		/** An individual doubly linked node in a linked list that stores its element inline. */
 		struct Node final {
 
 			// DATA
@@ -29,166 +31,157 @@ namespace Toolbox {
 			/** A pointer to the previous node. */
 			Node* previous;
 
-			/** The underlying data of this node. */
-			Type* data;
-
 			/** A pointer to the next node. */
 			Node* next;
 
+			/** The underlying data of this node. */
+			Type data;
 
-			// CONSTRUCTORS AND DESTRUCTOR
 
-			/** Default constructor. */
-			Node(const Type& Value = Type(), Node* Previous = nullptr, Node* Next = nullptr) : previous(Previous), data(new Type(Value)), next(Next) {
-			}
+			// CONSTRUCTOR
 
-			/** Null constructor. */
-			Node(std::nullptr_t) : previous(nullptr), data(nullptr), next(nullptr) {
+			/** Constructs this node's element in place with the given arguments. */
+			template<typename... ArgumentTypes>
+			Node(Node* Previous, Node* Next, ArgumentTypes&&... Arguments) : previous(Previous), next(Next), data(std::forward<ArgumentTypes>(Arguments)...) {
 			}
+		};
 
+	public:
 
-			// OPERATORS
+		// ITERATOR
 
-			/** Null assignment operator. */
-			Node& operator=(std::nullptr_t) {
-				previous = nullptr;
-				data = nullptr;
-				next = nullptr;
-				return *this;
-			}
+		/** A two-way iterator that traverses the nodes of a linked list. */
+		template<typename NodeType, typename ElementType>
+		struct NodeIterator final {
+		private:
 
-			/** Returns a reference to the underlying element of this node. */
-			Type& operator*() {
-				return *data;
-			}
+			// DATA
 
-			/** Returns a constant reference to the underlying element of this node. */
-			const Type& operator*() const {
-				return *data;
-			}
+			/** A pointer to the current node, or nullptr if this iterator is past either end of its list. */
+			NodeType* node;
 
-			/** Returns a dereferenced pointer to the underlying element of this node. */
-			Type* operator->() {
-				return data;
-			}
+			template<typename, typename>
+			friend struct NodeIterator;
 
-			/** Returns a dereferenced constant pointer to the underlying element of this node. */
-			const Type* operator->() const {
-				return data;
+			friend class List<Type, AllocatorType>;
+
+		public:
+
+			// CONSTRUCTORS
+
+			/** Default constructor. */
+			NodeIterator(NodeType* Current = nullptr) : node(Current) {
 			}
 
-			/** Increments this node to the next element. */
-			Node& operator++() {
-				if (next == nullptr) {
-					*this = nullptr;
-					return *this;
-				}
-				*this = *next;
-				return *this;
+			/** Constant conversion constructor. */
+			template<typename OtherNodeType, typename OtherElementType>
+			NodeIterator(const NodeIterator<OtherNodeType, OtherElementType>& Iterator) : node(Iterator.node) {
 			}
 
-			/** Increments this node to the next node and returns a copy of the previous node. */
-			Node& operator++(int) {
-				++(*this);
-				return *previous;
+
+			// OPERATORS
+
+			/** Returns a reference to the underlying element of this iterator. */
+			ElementType& operator*() const {
+				return node->data;
 			}
 
-			/** Returns a copy of this node after incrementing the given count. */
-			Node& operator+(const ptrdiff_t Count) {
-				if (Count == 0) {
-					return *this;
-				}
-				Node Copy = *this;
-				Copy += Count - 1;
-				return *Copy.next;
+			/** Returns a dereferenced pointer to the underlying element of this iterator. */
+			ElementType* operator->() const {
+				return node != nullptr ? &node->data : nullptr;
 			}
 
-			/** Returns a reference to this node after incrementing the given count. */
-			Node& operator+=(ptrdiff_t Count) {
-				while (Count > 0) {
-					++(*this);
-					--Count;
-				}
-				while (Count < 0) {
-					--(*this);
-					++Count;
-				}
+			/** Increments this iterator to the next element. */
+			NodeIterator& operator++() {
+				node = node->next;
 				return *this;
 			}
 
-			/** Decrements this node to the previous element. */
-			Node& operator--() {
-				if (previous == nullptr) {
-					*this = nullptr;
-					return *this;
-				}
-				*this = *previous;
+			/** Increments this iterator to the next element and returns a copy of the previous iterator. */
+			NodeIterator operator++(int) {
+				NodeIterator Copy = *this;
+				node = node->next;
+				return Copy;
+			}
+
+			/** Decrements this iterator to the previous element. */
+			NodeIterator& operator--() {
+				node = node->previous;
 				return *this;
 			}
 
-			/** Decrements this node to the previous node and returns a copy of the next node. */
-			Node& operator--(int) {
-				--(*this);
-				return *next;
+			/** Decrements this iterator to the previous element and returns a copy of the next iterator. */
+			NodeIterator operator--(int) {
+				NodeIterator Copy = *this;
+				node = node->previous;
+				return Copy;
 			}
 
-			/** Returns a copy of this node after decrementing the given count. */
-			Node& operator-(const ptrdiff_t Count) {
-				if (Count == 0) {
-					return *this;
-				}
-				Node Copy = *this;
-				Copy -= Count + 1;
-				return *Copy.previous;
+			/** Returns a copy of this iterator after incrementing the given count. */
+			NodeIterator operator+(const ptrdiff_t Count) const {
+				NodeIterator Copy = *this;
+				Copy += Count;
+				return Copy;
 			}
 
-			/** Returns a reference to this node after decrementing the given count. */
-			Node& operator-=(ptrdiff_t Count) {
+			/** Returns a reference to this iterator after incrementing the given count. */
+			NodeIterator& operator+=(ptrdiff_t Count) {
 				while (Count > 0) {
-					--(*this);
+					node = node->next;
 					--Count;
 				}
 				while (Count < 0) {
-					++(*this);
+					node = node->previous;
 					++Count;
 				}
 				return *this;
 			}
 
-			/** Returns a reference to this node's element after incrementing the given count. */
-			Type& operator[](size_t Index) {
-				return *(*this + Index);
+			/** Returns a copy of this iterator after decrementing the given count. */
+			NodeIterator operator-(const ptrdiff_t Count) const {
+				NodeIterator Copy = *this;
+				Copy -= Count;
+				return Copy;
 			}
 
-			/** Returns a constant reference to this node's element after incrementing the given count. */
-			const Type& operator[](size_t Index) const {
-				return *(*this + Index);
+			/** Returns a reference to this iterator after decrementing the given count. */
+			NodeIterator& operator-=(const ptrdiff_t Count) {
+				return *this += -Count;
 			}
 
-			/** Returns whether the given nodes are equal. */
-			bool operator==(const Node& Other) const {
-				return data == Other.data;
+			/** Returns a reference to this iterator's element after incrementing the given count. */
+			ElementType& operator[](const size_t Index) const {
+				return *(*this + static_cast<ptrdiff_t>(Index));
 			}
 
-			/** Returns whether this node has a valid next pointer. */
-			bool operator!=(const Node& Other) const {
-				return !(*this == Other);
+			/** Returns whether the given iterators are equal. */
+			bool operator==(const NodeIterator& Other) const {
+				return node == Other.node;
 			}
 
-			/** Returns whether this node is valid. */
+			/** Returns whether the given iterators are not equal. */
+			bool operator!=(const NodeIterator& Other) const {
+				return node != Other.node;
+			}
+
+			/** Returns whether this iterator is valid. */
 			explicit operator bool() const {
-				return data != nullptr;
+				return node != nullptr;
 			}
 
-			/** Returns whether this node is not valid. */
+			/** Returns whether this iterator is not valid. */
 			bool operator!() const {
-				if (*this) {
-					return false;
-				}
-				return true;
+				return node == nullptr;
 			}
 		};
 
+		/** A two-way iterator that traverses the elements of a linked list. */
+		using Iterator = NodeIterator<Node, Type>;
+
+		/** A two-way iterator that traverses the constant elements of a linked list. */
+		using ConstantIterator = NodeIterator<const Node, const Type>;
+
+	private:
 
 		// DATA
 
@@ -201,14 +194,14 @@ namespace Toolbox {
 		/** A pointer to the last node of the list. */
 		Node* tail;
 
-		/** A sentinel node used to indicate the end of a list. */
-		Node NIL;
+		/** The pool each of the list's nodes are allocated from. */
+		Pool<Node, AllocatorType> pool;
 
 
 		// NODE
 
 		/** Traverses the list to reach the node at the given index using the shortest path. */
-		Node& Traverse(const size_t Index) {
+		Node* Traverse(const size_t Index) const {
 			if (!IsValidIndex(Index)) {
 				throw std::runtime_error(
 					std::string("ERROR: Index ") +
@@ -216,29 +209,40 @@ namespace Toolbox {
 					" is out of bounds of the list of size " +
 					std::to_string(size) + ".");
 			}
+			Node* Current;
 			if (Index > size / 2) {
-				return *tail - (size - Index - 1);
+				Current = tail;
+				for (size_t Count = size - Index - 1; Count > 0; --Count) {
+					Current = Current->previous;
+				}
 			}
 			else {
-				return *head + Index;
+				Current = head;
+				for (size_t Count = Index; Count > 0; --Count) {
+					Current = Current->next;
+				}
 			}
+			return Current;
 		}
 
-		/** Traverses the list to reach the node at the given index using the shortest path (constant). */
-		const Node& Traverse(const size_t Index) const {
-			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the list of size " +
-					std::to_string(size) + ".");
+		/** Unlinks the given node from the list and returns it to the list's pool. */
+		void Unlink(Node* Removed) {
+			if (Removed->previous != nullptr) {
+				Removed->previous->next = Removed->next;
 			}
-			if (Index > size / 2) {
-				return *tail - (size - Index - 1);
+			else {
+				head = Removed->next;
+			}
+			if (Removed->next != nullptr) {
+				Removed->next->previous = Removed->previous;
 			}
 			else {
-				return *head + Index;
+				tail = Removed->previous;
 			}
+			pool.Delete(Removed);
+			TOOLBOX_COUNT(List, Deallocations, 1);
+			TOOLBOX_COUNT(List, DeallocatedBytes, sizeof(Node));
+			--size;
 		}
 
 	public:
@@ -246,39 +250,43 @@ namespace Toolbox {
 		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		List() : size(0), head(nullptr), tail(nullptr), NIL(nullptr) {
+		List() : size(0), head(nullptr), tail(nullptr), pool() {
+		}
+
+		/** Allocator constructor. */
+		explicit List(const AllocatorType& Allocator) : size(0), head(nullptr), tail(nullptr), pool(Allocator) {
 		}
 
 		/** Fill constructor. */
-		List(size_t Size, const Type& Value = Type()) : size(0), head(nullptr), tail(nullptr), NIL(nullptr) {
+		List(size_t Size, const Type& Value = Type(), const AllocatorType& Allocator = AllocatorType()) : size(0), head(nullptr), tail(nullptr), pool(Allocator) {
 			for (size_t Index = 0; Index < Size; ++Index) {
 				PushBack(Value);
 			}
 		}
 
 		/** Array constructor. */
-		List(const size_t Size, const Type* Array) : size(0), head(nullptr), tail(nullptr), NIL(nullptr) {
+		List(const size_t Size, const Type* Array, const AllocatorType& Allocator = AllocatorType()) : size(0), head(nullptr), tail(nullptr), pool(Allocator) {
 			for (size_t Index = 0; Index < Size; ++Index) {
 				PushBack(Array[Index]);
 			}
 		}
 
 		/** Initializer list constructor. */
-		List(const std::initializer_list<Type>& List) : size(0), head(nullptr), tail(nullptr), NIL(nullptr) {
+		List(const std::initializer_list<Type>& List, const AllocatorType& Allocator = AllocatorType()) : size(0), head(nullptr), tail(nullptr), pool(Allocator) {
 			for (size_t Index = 0; Index < List.size(); ++Index) {
 				PushBack(List.begin()[Index]);
 			}
 		}
 
 		/** Copy constructor. */
-		List(const List<Type>& Copied) : size(0), head(nullptr), tail(nullptr), NIL(nullptr) {
+		List(const List& Copied) : size(0), head(nullptr), tail(nullptr), pool(Copied.pool.GetAllocator()) {
 			for (auto& Element : Copied) {
 				PushBack(Element);
 			}
 		}
 
 		/** Move constructor. */
-		List(List<Type>&& Moved) noexcept : size(Moved.size), head(Moved.head), tail(Moved.tail), NIL(nullptr) {
+		List(List&& Moved) noexcept : size(Moved.size), head(Moved.head), tail(Moved.tail), pool(std::move(Moved.pool)) {
 			Moved.size = 0;
 			Moved.head = nullptr;
 			Moved.tail = nullptr;
@@ -293,7 +301,7 @@ namespace Toolbox {
 		// OPERATORS
 
 		/** Copy assignment operator. */
-		List<Type>& operator=(const List<Type>& Copied) {
+		List& operator=(const List& Copied) {
 			if (this == &Copied) {
 				return *this;
 			}
@@ -305,7 +313,7 @@ namespace Toolbox {
 		}
 
 		/** Move assignment operator. */
-		List<Type>& operator=(List<Type>&& Moved) noexcept {
+		List& operator=(List&& Moved) noexcept {
 			if (this == &Moved) {
 				return *this;
 			}
@@ -313,6 +321,7 @@ namespace Toolbox {
 			size = Moved.size;
 			head = Moved.head;
 			tail = Moved.tail;
+			pool = std::move(Moved.pool);
 			Moved.size = 0;
 			Moved.head = nullptr;
 			Moved.tail = nullptr;
@@ -328,7 +337,7 @@ namespace Toolbox {
 					" is out of bounds of the list of size " +
 					std::to_string(size) + ".");
 			}
-			return *Traverse(Index);
+			return Traverse(Index)->data;
 		}
 
 		/** Returns a constant reference to the data at the given index. */
@@ -340,36 +349,30 @@ namespace Toolbox {
 					" is out of bounds of the list of size " +
 					std::to_string(size) + ".");
 			}
-			return *Traverse(Index);
+			return Traverse(Index)->data;
 		}
 
 
 		// ITERATORS
 
-		/** Returns a reference to the first node in the list. */
-		Node& begin() {
-			if (head == nullptr) {
-				return NIL;
-			}
-			return *head;
+		/** Returns an iterator to the first element in the list. */
+		Iterator begin() {
+			return Iterator(head);
 		}
 
-		/** Returns a constant reference to the first node in the list. */
-		const Node& begin() const {
-			if (head == nullptr) {
-				return NIL;
-			}
-			return *head;
+		/** Returns a constant iterator to the first element in the list. */
+		ConstantIterator begin() const {
+			return ConstantIterator(head);
 		}
 
-		/** Returns a reference to the NIL node. */
-		Node& end() {
-			return NIL;
+		/** Returns an iterator to the element after the last element in the list. */
+		Iterator end() {
+			return Iterator();
 		}
 
-		/** Returns a constant reference to the NIL node. */
-		const Node& end() const {
-			return NIL;
+		/** Returns a constant iterator to the element after the last element in the list. */
+		ConstantIterator end() const {
+			return ConstantIterator();
 		}
 
 
@@ -430,13 +433,13 @@ namespace Toolbox {
 		/** Returns the index of the last matching value in the list, or -1 if no match is found. */
 		ptrdiff_t FindLast(const Type& Value) const {
 			ptrdiff_t Index = size - 1;
-			Node* Node = tail;
-			while (Node != nullptr) {
-				if (Value == **Node) {
+			const Node* Current = tail;
+			while (Current != nullptr) {
+				if (Value == Current->data) {
 					return Index;
 				}
 				--Index;
-				Node = Node->previous;
+				Current = Current->previous;
 			}
 			return -1;
 		}
@@ -467,6 +470,11 @@ namespace Toolbox {
 			return size == 0;
 		}
 
+		/** Returns the allocator the list's nodes are allocated with. */
+		const AllocatorType& GetAllocator() const {
+			return pool.GetAllocator();
+		}
+
 
 		// SETTERS
 
@@ -491,11 +499,7 @@ namespace Toolbox {
 					" is out of bounds of the list of size " +
 					std::to_string(size) + ".");
 			}
-			Node* LeftNode = &Traverse(Left);
-			Node* RightNode = &Traverse(Right);
-			Type Swapped = **LeftNode;
-			**LeftNode = **RightNode;
-			**RightNode = Swapped;
+			std::swap(Traverse(Left)->data, Traverse(Right)->data);
 		}
 
 		/** Fills the list with a copy of the given value. */
@@ -538,67 +542,63 @@ namespace Toolbox {
 
 		// EXPANSION
 
-		/** Deallocates the list. */
+		/** Destroys each element in the list while keeping its pooled node memory. */
 		void Clear() {
 			Node* Current = head;
 			while (Current != nullptr) {
 				Node* Next = Current->next;
-				delete Current->data;
-				Current->data = nullptr;
-				delete Current;
+				pool.Delete(Current);
 				Current = Next;
 			}
-			Current = nullptr;
+			TOOLBOX_COUNT(List, Deallocations, size);
+			TOOLBOX_COUNT(List, DeallocatedBytes, sizeof(Node) * size);
 			size = 0;
 			head = nullptr;
 			tail = nullptr;
 		}
 
+		/** Destroys each element in the list and returns its node memory to the system. */
+		void Reset() {
+			Clear();
+			pool.Reset();
+		}
+
+		/** Ensures the list can hold at least the given number of additional elements without allocating. */
+		void Reserve(const size_t Count) {
+			pool.Reserve(Count);
+		}
+
 		/** Inserts a copy of the given data at the given index in the list. */
 		Type& Insert(const size_t Index, const Type& Value) {
-			if (Index > size) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the list of size " +
-					std::to_string(size) + ".");
-			}
-			if (Index == size) {
-				if (IsEmpty()) {
-					head = new Node(Value);
-					tail = head;
-					++size;
-					return **head;
-				}
-				tail->next = new Node(Value, tail);
-				tail = tail->next;
-				++size;
-				return **tail;
-			}
-			Node* Next = &Traverse(Index);
-			Node* New = new Node(Value, Next->previous, Next);
-			if (Next->previous != nullptr) {
-				Next->previous->next = New;
-			}
-			else {
-				head = New;
-			}
-			Next->previous = New;
-			++size;
-			return *New->data;
+			return Emplace(Index, Value);
+		}
+
+		/** Inserts the given data at the given index in the list. */
+		Type& Insert(const size_t Index, Type&& Value) {
+			return Emplace(Index, std::move(Value));
 		}
 
 		/** Pushes a copy of the given data to the front of the list. */
 		Type& PushFront(const Type& Value) {
-			return Insert(0, Value);
+			return Emplace(0, Value);
+		}
+
+		/** Pushes the given data to the front of the list. */
+		Type& PushFront(Type&& Value) {
+			return Emplace(0, std::move(Value));
 		}
 
 		/** Pushes a copy of the given data to the back of the list. */
 		Type& PushBack(const Type& Value) {
-			return Insert(size, Value);
+			return Emplace(size, Value);
 		}
 
-		/** Inserts a new element with the given arguments at the given index in the list. */
+		/** Pushes the given data to the back of the list. */
+		Type& PushBack(Type&& Value) {
+			return Emplace(size, std::move(Value));
+		}
+
+		/** Constructs a new element in place with the given arguments at the given index in the list. */
 		template<typename... ArgumentTypes>
 		Type& Emplace(const size_t Index, ArgumentTypes&&... Arguments) {
 			if (Index > size) {
@@ -608,97 +608,65 @@ namespace Toolbox {
 					" is out of bounds of the list of size " +
 					std::to_string(size) + ".");
 			}
-			if (Index == size) {
-				if (IsEmpty()) {
-					head = new Node(Type(std::forward<ArgumentTypes>(Arguments)...));
-					tail = head;
-					++size;
-					return **head;
-				}
-				tail->next = new Node(Type(std::forward<ArgumentTypes>(Arguments)...), tail);
-				tail = tail->next;
-				++size;
-				return **tail;
-			}
-			Node* Next = &Traverse(Index);
-			Node* New = new Node(Type(std::forward<ArgumentTypes>(Arguments)...), Next->previous, Next);
-			if (Next->previous != nullptr) {
-				Next->previous->next = New;
+			Node* Next = Index == size ? nullptr : Traverse(Index);
+			Node* Previous = Next != nullptr ? Next->previous : tail;
+			Node* New = pool.New(Previous, Next, std::forward<ArgumentTypes>(Arguments)...);
+			TOOLBOX_COUNT(List, Allocations, 1);
+			TOOLBOX_COUNT(List, AllocatedBytes, sizeof(Node));
+			if (Previous != nullptr) {
+				Previous->next = New;
 			}
 			else {
 				head = New;
 			}
-			Next->previous = New;
+			if (Next != nullptr) {
+				Next->previous = New;
+			}
+			else {
+				tail = New;
+			}
 			++size;
-			return *New->data;
+			return New->data;
 		}
 
-		/** Pushes a new element with the given arguments to the front of the list. */
+		/** Constructs a new element in place with the given arguments at the front of the list. */
 		template<typename... ArgumentTypes>
 		Type& EmplaceFront(ArgumentTypes&&... Arguments) {
-			return Emplace(0, Arguments...);
+			return Emplace(0, std::forward<ArgumentTypes>(Arguments)...);
 		}
 
-		/** Pushes a new element with the given arguments to the back of the list. */
+		/** Constructs a new element in place with the given arguments at the back of the list. */
 		template<typename... ArgumentTypes>
 		Type& EmplaceBack(ArgumentTypes&&... Arguments) {
-			return Emplace(size, Arguments...);
+			return Emplace(size, std::forward<ArgumentTypes>(Arguments)...);
 		}
 
 		/** Removes the element at the given index. */
 		void Erase(const size_t Index) {
-			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the list of size " +
-					std::to_string(size) + ".");
-			}
-			if (Index == 0) {
-				if (size == 1) {
-					delete head->data;
-					head->data = nullptr;
-					delete head;
-					head = nullptr;
-					tail = nullptr;
-				}
-				else {
-					head = head->next;
-					delete head->previous->data;
-					head->previous->data = nullptr;
-					delete head->previous;
-					head->previous = nullptr;
-				}
-			}
-			else if (Index == size - 1) {
-				tail = tail->previous;
-				delete tail->next->data;
-				tail->next->data = nullptr;
-				delete tail->next;
-				tail->next = nullptr;
-			}
-			else {
-				Node* Next = Traverse(Index).next;
-				Node* Previous = Next->previous->previous;
-				delete Next->previous->data;
-				Next->previous->data = nullptr;
-				delete Next->previous;
-				Next->previous = Previous;
-				if (Previous != nullptr) {
-					Previous->next = Next;
-				}
-			}
-			--size;
+			Unlink(Traverse(Index));
+		}
+
+		/** Removes the element at the given iterator and returns an iterator to the following element. */
+		Iterator Erase(const Iterator& Position) {
+			Node* Next = Position.node->next;
+			Unlink(Position.node);
+			return Iterator(Next);
 		}
 
 		/** Removes the element at the front of the list. */
 		void PopFront() {
-			Erase(0);
+			if (IsEmpty()) {
+				throw std::runtime_error("ERROR: Index 0 is out of bounds of the list of size 0.");
+			}
+			Unlink(head);
 		}
 
 		/** Removes the element at the back of the list. */
 		void PopBack() {
-			Erase(size - 1);
+			if (IsEmpty()) {
+				throw std::runtime_error("ERROR: Index 0 is out of bounds of the list of size 0.");
+			}
+			Unlink(tail);
 		}
 
 
@@ -10,8 +10,8 @@ namespace Toolbox {
 
 	// HASH MAP
 
-	/** A collection of key value pairs that allow fast value lookups via hashing a key. */
-	template<typename KeyType, typename ValueType, Hash(*HASH_FUNC)(const KeyType&) = Hashify>
+	/** A collection of key value pairs that allow fast value lookups via hashing a key, whose buckets and pairs are allocated with the given allocator. Every bucket's pairs are pooled in shared slabs. */
+	template<typename KeyType, typename ValueType, Hash(*HASH_FUNC)(const KeyType&) = Hashify, typename AllocatorType = HeapAllocator>
 	class Map final {
 		static_assert(HASH_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
 
@@ -28,60 +28,141 @@ namespace Toolbox {
 			/** The value this pair is storing. */
 			ValueType value;
 
+			/** The cached hash of this pair's key. */
+			Hash hash;
+
 
 			// CONSTRUCTOR
 
 			/** Default constructor. */
-			Pair(const KeyType& Key = KeyType(), const ValueType& Value = ValueType()) : key(Key), value(Value) {
+			Pair(const KeyType& Key = KeyType(), const ValueType& Value = ValueType(), const Hash Hash = 0) : key(Key), value(Value), hash(Hash) {
 			}
 		};
 
 
+		// STORAGE
+
+		/** A bucket of pairs whose keys have the same hash index. */
+		using Bucket = HashBucket<Pair>;
+
+		/** The array of buckets a map stores its pairs in. */
+		using Storage = Vector<Bucket, 0, AllocatorType>;
+
+
 		// DATA
 
 		/** The current number of pairs stored in the map. */
 		size_t size;
 
 		/** The underlying array of buckets containing each of the map's pairs. */
-		Vector<List<Pair>> buckets;
+		Storage buckets;
+
+		/** The pool each of the map's pairs are allocated from. */
+		Pool<typename Bucket::Node, AllocatorType> pool;
+
+
+		// LOOKUP
+
+		/** Returns a pointer to the pair with the given key and hash, or nullptr if it does not exist. */
+		Pair* Locate(const KeyType& Key, const Hash Hash) {
+			size_t Probes = 0;
+			for (auto& Pair : buckets[Hash % buckets.Size()]) {
+				++Probes;
+				if (Pair.hash == Hash && Pair.key == Key) {
+					TOOLBOX_COUNT_LOOKUP(Map, Probes);
+					return &Pair;
+				}
+			}
+			TOOLBOX_COUNT_LOOKUP(Map, Probes);
+			return nullptr;
+		}
+
+		/** Returns a constant pointer to the pair with the given key and hash, or nullptr if it does not exist. */
+		const Pair* Locate(const KeyType& Key, const Hash Hash) const {
+			size_t Probes = 0;
+			for (auto& Pair : buckets[Hash % buckets.Size()]) {
+				++Probes;
+				if (Pair.hash == Hash && Pair.key == Key) {
+					TOOLBOX_COUNT_LOOKUP(Map, Probes);
+					return &Pair;
+				}
+			}
+			TOOLBOX_COUNT_LOOKUP(Map, Probes);
+			return nullptr;
+		}
+
+
+
+		// COPYING
+
+		/** Copies each of the given map's pairs into this map's buckets, which must be empty and match the given map's bucket count. */
+		void CopyFrom(const Map& Copied) {
+			for (size_t Index = 0; Index < buckets.Size(); ++Index) {
+				buckets[Index].Assign(pool, Copied.buckets[Index]);
+			}
+			size = Copied.size;
+		}
+
+		/** Returns the given number of empty buckets in memory from the given allocator. */
+		static Storage EmptyBuckets(const size_t Count, const AllocatorType& Allocator) {
+			Storage Buckets(Allocator);
+			Buckets.Reserve(Count);
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Buckets.EmplaceBack();
+			}
+			return Buckets;
+		}
 
 	public:
 
-		// CONSTRUCTORS
+		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		Map(const size_t BucketCount = 8) : size(0), buckets(BucketCount == 0 ? 1 : BucketCount) {
+		Map(const size_t BucketCount = 8, const AllocatorType& Allocator = AllocatorType()) : size(0), buckets(EmptyBuckets(BucketCount == 0 ? 1 : BucketCount, Allocator)), pool(Allocator) {
+		}
+
+		/** Allocator constructor. */
+		explicit Map(const AllocatorType& Allocator) : size(0), buckets(EmptyBuckets(8, Allocator)), pool(Allocator) {
 		}
 
 		/** Copy constructor. */
-		Map(const Map<KeyType, ValueType, HASH_FUNC>& Copied) : size(Copied.size), buckets(Copied.buckets) {
+		Map(const Map& Copied) : size(0), buckets(EmptyBuckets(Copied.buckets.Size(), Copied.GetAllocator())), pool(Copied.GetAllocator()) {
+			CopyFrom(Copied);
 		}
 
 		/** Move constructor. */
-		Map(Map<KeyType, ValueType, HASH_FUNC>&& Moved) noexcept : size(Moved.size), buckets(std::move(Moved.buckets)) {
+		Map(Map&& Moved) noexcept : size(Moved.size), buckets(std::move(Moved.buckets)), pool(std::move(Moved.pool)) {
 			Moved.size = 0;
 		}
 
+		/** Destructor. */
+		~Map() {
+			Clear();
+		}
+
 
 		// OPERATORS
 
 		/** Copy assignment operator. */
-		Map<KeyType, ValueType, HASH_FUNC>& operator=(const Map<KeyType, ValueType, HASH_FUNC>& Copied) {
+		Map& operator=(const Map& Copied) {
 			if (this == &Copied) {
 				return *this;
 			}
-			size = Copied.size;
-			buckets = Copied.buckets;
+			Clear();
+			buckets = EmptyBuckets(Copied.buckets.Size(), buckets.GetAllocator());
+			CopyFrom(Copied);
 			return *this;
 		}
 
-		/** Move assignment operator. */
-		Map<KeyType, ValueType, HASH_FUNC>& operator=(Map<KeyType, ValueType, HASH_FUNC>&& Moved) noexcept {
+		/** Move assignment operator, which takes the other map's allocator along with its pairs. */
+		Map& operator=(Map&& Moved) noexcept {
 			if (this == &Moved) {
 				return *this;
 			}
+			Clear();
 			size = Moved.size;
 			buckets = std::move(Moved.buckets);
+			pool = std::move(Moved.pool);
 			Moved.size = 0;
 			return *this;
 		}
@@ -108,6 +189,20 @@ namespace Toolbox {
 			return buckets.Size();
 		}
 
+		/** Returns a snapshot of how the map's pairs are spread across its buckets, such as its bucket length histogram and average probe length. */
+		TableStats Statistics() const {
+			TableStats Statistics;
+			for (auto& Bucket : buckets) {
+				Statistics.Add(Bucket.Size());
+			}
+			return Statistics;
+		}
+
+		/** Returns the allocator the map's buckets and pairs are allocated with. */
+		const AllocatorType& GetAllocator() const {
+			return buckets.GetAllocator();
+		}
+
 		/** Returns this map's hash function. */
 		Hash(*HashFunction() const)(const KeyType&) {
 			return HASH_FUNC;
@@ -115,28 +210,24 @@ namespace Toolbox {
 
 		/** Finds and returns a pointer to the given key's value in the map, or nullptr if it does not exist. */
 		ValueType* Find(const KeyType& Key) {
-			size_t Index = HASH_FUNC(Key) % buckets.Size();
-			size_t ElementIndex = 0;
-			for (auto& Pair : buckets[Index]) {
-				if (Pair.key == Key) {
-					return &buckets[Index][ElementIndex].value;
-				}
-				++ElementIndex;
-			}
-			return nullptr;
+			return Find(Key, HASH_FUNC(Key));
 		}
 
 		/** Finds and returns a constant pointer to the given key's value in the map, or nullptr if it does not exist. */
 		const ValueType* Find(const KeyType& Key) const {
-			size_t Index = HASH_FUNC(Key) % buckets.Size();
-			size_t ElementIndex = 0;
-			for (auto& Pair : buckets[Index]) {
-				if (Pair.key == Key) {
-					return &buckets[Index][ElementIndex].value;
-				}
-				++ElementIndex;
-			}
-			return nullptr;
+			return Find(Key, HASH_FUNC(Key));
+		}
+
+		/** Finds and returns a pointer to the given key's value in the map using the given precomputed hash of the key, or nullptr if it does not exist. */
+		ValueType* Find(const KeyType& Key, const Hash Hash) {
+			Pair* Found = Locate(Key, Hash);
+			return Found != nullptr ? &Found->value : nullptr;
+		}
+
+		/** Finds and returns a constant pointer to the given key's value in the map using the given precomputed hash of the key, or nullptr if it does not exist. */
+		const ValueType* Find(const KeyType& Key, const Hash Hash) const {
+			const Pair* Found = Locate(Key, Hash);
+			return Found != nullptr ? &Found->value : nullptr;
 		}
 
 		/** Returns whether the given key is present in the map. */
@@ -144,6 +235,11 @@ namespace Toolbox {
 			return Find(Key) != nullptr;
 		}
 
+		/** Returns whether the given key is present in the map using the given precomputed hash of the key. */
+		bool ContainsKey(const KeyType& Key, const Hash Hash) const {
+			return Locate(Key, Hash) != nullptr;
+		}
+
 		/** Returns whether the given value is present in the map. */
 		bool ContainsValue(const ValueType& Value) const {
 			for (auto& Bucket : buckets) {
@@ -206,61 +302,64 @@ namespace Toolbox {
 		/** Deallocates the map. */
 		void Clear() {
 			for (auto& Bucket : buckets) {
-				Bucket.Clear();
+				Bucket.Clear(pool);
 			}
+			pool.Reset();
 			size = 0;
 		}
 
 		/** Inserts a copy of the given value into the map with the given key and returns a reference to the value. */
 		ValueType& Insert(const KeyType& Key, const ValueType& Value) {
-			size_t Index = HASH_FUNC(Key) % buckets.Size();
-			size_t ElementIndex = 0;
-			for (auto& Pair : buckets[Index]) {
-				if (Pair.key == Key) {
-					buckets[Index][ElementIndex].value = Value;
-					return buckets[Index][ElementIndex].value;
-				}
-				++ElementIndex;
+			return Insert(Key, Value, HASH_FUNC(Key));
+		}
+
+		/** Inserts a copy of the given value into the map with the given key using the given precomputed hash of the key, and returns a reference to the value. */
+		ValueType& Insert(const KeyType& Key, const ValueType& Value, const Hash Hash) {
+			Pair* Found = Locate(Key, Hash);
+			if (Found != nullptr) {
+				Found->value = Value;
+				return Found->value;
 			}
-			buckets[Index].PushBack(Pair(Key, Value));
+			size_t Index = Hash % buckets.Size();
+			Pair& Inserted = buckets[Index].Emplace(pool, Key, Value, Hash);
 			++size;
-			ValueType* NewValue = &buckets[Index].Back().value;
-			if (buckets[Index].Size() > REHASH_MAX) {
+			if (size > buckets.Size() * REHASH_MAX_LOAD) {
 				Rehash(buckets.Size() * 2);
 			}
-			return *NewValue;
+			return Inserted.value;
 		}
 
 		/** Erases any matching key found in the map and returns whether a pair was found and successfully erased. */
 		bool Erase(const KeyType& Key) {
-			size_t Index = HASH_FUNC(Key) % buckets.Size();
-			size_t ElementIndex = 0;
-			for (auto& Pair : buckets[Index]) {
-				if (Pair.key == Key) {
-					buckets[Index].Erase(ElementIndex);
-					--size;
-					return true;
-				}
-				++ElementIndex;
+			return Erase(Key, HASH_FUNC(Key));
+		}
+
+		/** Erases any matching key found in the map using the given precomputed hash of the key, and returns whether a pair was found and successfully erased. */
+		bool Erase(const KeyType& Key, const Hash Hash) {
+			if (buckets[Hash % buckets.Size()].EraseFirst(pool, [&Key, Hash](const Pair& Erased) { return Erased.hash == Hash && Erased.key == Key; })) {
+				--size;
+				return true;
 			}
 			return false;
 		}
 
 		/**
 		 * Resizes the map's number of buckets to the given number.<br/>
-		 * All pairs are copied into the new buckets based on their key's hash value.
+		 * All pairs are relinked into the new buckets based on their cached hash value, so no key is hashed again and no pair is moved.
 		 */
 		void Rehash(const size_t BucketCount) {
 			if (BucketCount == 0 || BucketCount == buckets.Size()) {
 				return;
 			}
-			Vector<List<Pair>> Buckets(BucketCount);
+			TOOLBOX_COUNT(Map, Rehashes, 1);
+			Storage Buckets = EmptyBuckets(BucketCount, buckets.GetAllocator());
 			for (auto& Bucket : buckets) {
-				for (auto& Element : Bucket) {
-					Buckets[HASH_FUNC(Element.key) % Buckets.Size()].PushBack(Pair(Element.key, Element.value));
+				while (!Bucket.IsEmpty()) {
+					auto* Node = Bucket.Unlink();
+					Buckets[Node->data.hash % Buckets.Size()].Link(Node);
 				}
 			}
-			buckets = Buckets;
+			buckets = std::move(Buckets);
 		}
 
 
@@ -310,12 +409,12 @@ namespace Toolbox {
 		// AS VECTOR
 
 		/** Returns a reference to this map's underlying vector. */
-		Vector<List<Pair>>& AsVector() {
+		Storage& AsVector() {
 			return buckets;
 		}
 
 		/** Returns a constant reference to this map's underlying vector. */
-		const Vector<List<Pair>>& AsVector() const {
+		const Storage& AsVector() const {
 			return buckets;
 		}
 	};
@@ -39,6 +39,17 @@ namespace Toolbox {
 			return Delta.Magnitude();
 		}
 
+		/** Returns the squared distance from the start point to the end point, which avoids a square root when only comparing distances. */
+		template<size_t DIMENSIONS = 3, typename PrecisionType = DEFAULT_PRECISION>
+		static PrecisionType DistanceSquared(const Point<DIMENSIONS, PrecisionType>& Start, const Point<DIMENSIONS, PrecisionType>& End) {
+			PrecisionType Sum = 0;
+			for (size_t Index = 0; Index < DIMENSIONS; ++Index) {
+				const PrecisionType Delta = Start[Index] - End[Index];
+				Sum += Delta * Delta;
+			}
+			return Sum;
+		}
+
 		/** Rotates the given 2D point by the given radians. */
 		template<typename PrecisionType = DEFAULT_PRECISION>
 		static Point<2, PrecisionType> Rotate(const Point<2, PrecisionType>& Point, const PrecisionType Radians) {
@@ -0,0 +1,982 @@
+// .h
+// Lazy Pipeline Types
+// by Kyle Furey
+
+#pragma once
+#include <new>
+#include <type_traits>
+#include "Vector.h"
+#include "Iterator.h"
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// PIPELINE
+
+	/**
+	 * Lazy adapters over collections that compose into a single loop.<br/>
+	 * Each adapter wraps the previous stage by value and only runs its functor as elements are pulled through it.<br/>
+	 * Nothing is allocated until a pipeline is collected with ToVector() or Collect().
+	 */
+	namespace Pipeline {
+
+		// PIPE
+
+		template<typename StageType>
+		class Pipe;
+
+		template<typename InnerIterator>
+		class SourceStage;
+
+		template<typename StageType, typename PredicateType>
+		class FilterStage;
+
+		template<typename StageType, typename FunctionType>
+		class TransformStage;
+
+		template<typename StageType>
+		class TakeStage;
+
+		template<typename FirstStage, typename SecondStage>
+		class ZipStage;
+
+		template<typename StageType>
+		class EnumerateStage;
+
+
+		// ELEMENTS
+
+		/** The element type that a stage's iterator references. */
+		template<typename InnerIterator>
+		using ElementOf = std::remove_reference_t<decltype(*std::declval<InnerIterator&>())>;
+
+		/** A pair of references to elements of two zipped stages. */
+		template<typename FirstType, typename SecondType>
+		struct Zipped final {
+
+			// DATA
+
+			/** The element of the first stage. */
+			FirstType& First;
+
+			/** The element of the second stage. */
+			SecondType& Second;
+		};
+
+		/** A reference to an element of a stage and its index within that stage. */
+		template<typename Type>
+		struct Enumerated final {
+
+			// DATA
+
+			/** The index of the element. */
+			size_t Index;
+
+			/** The element. */
+			Type& Value;
+		};
+
+
+		// CACHE
+
+		/** Storage for the most recent element produced by an iterator, which is reconstructed in place as the iterator advances. */
+		template<typename Type>
+		class Cached final {
+
+			// DATA
+
+			/** The memory of the cached element. */
+			alignas(Type) unsigned char storage[sizeof(Type)];
+
+			/** Whether an element is currently cached. */
+			bool valid;
+
+		public:
+
+			// CONSTRUCTORS AND DESTRUCTOR
+
+			/** Default constructor. */
+			Cached() : storage(), valid(false) {
+			}
+
+			/** Copy constructor, which does not copy the cached element. */
+			Cached(const Cached& Copied) : storage(), valid(false) {
+			}
+
+			/** Destructor. */
+			~Cached() {
+				Clear();
+			}
+
+
+			// OPERATORS
+
+			/** Copy assignment operator, which does not copy the cached element. */
+			Cached& operator=(const Cached& Copied) {
+				Clear();
+				return *this;
+			}
+
+
+			// CACHE
+
+			/** Replaces the cached element with a new element constructed with the given arguments and returns it. */
+			template<typename ... ArgumentTypes>
+			Type& Emplace(ArgumentTypes&&... Arguments) {
+				Clear();
+				new(storage) Type(std::forward<ArgumentTypes>(Arguments)...);
+				valid = true;
+				return *std::launder(reinterpret_cast<Type*>(storage));
+			}
+
+			/** Destroys the cached element. */
+			void Clear() {
+				if (valid) {
+					std::launder(reinterpret_cast<Type*>(storage))->~Type();
+					valid = false;
+				}
+			}
+		};
+
+
+		// ITERATORS
+
+		/** An iterator over a range of another iterator type. */
+		template<typename InnerIterator>
+		struct SourceIterator final : public Toolbox::Iterator<SourceIterator<InnerIterator>, ElementOf<InnerIterator>> {
+
+			// TYPE
+
+			/** The element type of this iterator. */
+			using Type = ElementOf<InnerIterator>;
+
+		private:
+
+			// DATA
+
+			/** The current position. */
+			InnerIterator current;
+
+			/** The position after the last element. */
+			InnerIterator last;
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Range constructor. */
+			SourceIterator(InnerIterator Current, InnerIterator Last) : current(Current), last(Last) {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the underlying element of this iterator. */
+			Type& operator*() override {
+				return *current;
+			}
+
+			/** Returns a constant reference to the underlying element of this iterator. */
+			const Type& operator*() const override {
+				return *const_cast<SourceIterator&>(*this).current;
+			}
+
+			/** Increments this iterator to the next element. */
+			SourceIterator& operator++() override {
+				++current;
+				return *this;
+			}
+
+			/** Returns whether the given iterators are at the same position. */
+			bool operator==(const Toolbox::Iterator<SourceIterator, Type>& Other) const override {
+				return current == static_cast<const SourceIterator&>(Other).current;
+			}
+
+			/** Returns whether this iterator has not reached the end of its range. */
+			explicit operator bool() const override {
+				return current != last;
+			}
+		};
+
+		/** An iterator that skips elements of another iterator that do not match a predicate. */
+		template<typename InnerIterator, typename PredicateType>
+		struct FilterIterator final : public Toolbox::Iterator<FilterIterator<InnerIterator, PredicateType>, ElementOf<InnerIterator>> {
+
+			// TYPE
+
+			/** The element type of this iterator. */
+			using Type = ElementOf<InnerIterator>;
+
+		private:
+
+			// DATA
+
+			/** The current position. */
+			InnerIterator inner;
+
+			/** The predicate elements must match. */
+			const PredicateType* predicate;
+
+
+			// HELPERS
+
+			/** Advances to the next element that matches the predicate. */
+			void Skip() {
+				while (inner && !(*predicate)(*inner)) {
+					++inner;
+				}
+			}
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Inner iterator constructor. */
+			FilterIterator(InnerIterator Inner, const PredicateType* Predicate) : inner(Inner), predicate(Predicate) {
+				Skip();
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the underlying element of this iterator. */
+			Type& operator*() override {
+				return *inner;
+			}
+
+			/** Returns a constant reference to the underlying element of this iterator. */
+			const Type& operator*() const override {
+				return *const_cast<FilterIterator&>(*this).inner;
+			}
+
+			/** Increments this iterator to the next matching element. */
+			FilterIterator& operator++() override {
+				++inner;
+				Skip();
+				return *this;
+			}
+
+			/** Returns whether the given iterators are at the same position. */
+			bool operator==(const Toolbox::Iterator<FilterIterator, Type>& Other) const override {
+				return inner == static_cast<const FilterIterator&>(Other).inner;
+			}
+
+			/** Returns whether this iterator has not reached the end of its range. */
+			explicit operator bool() const override {
+				return static_cast<bool>(inner);
+			}
+		};
+
+		/** The element type of a transform iterator, which is the referenced type if the function returns a reference. */
+		template<typename InnerIterator, typename FunctionType>
+		using TransformedOf = std::remove_reference_t<std::invoke_result_t<const FunctionType&, ElementOf<InnerIterator>&>>;
+
+		/**
+		 * An iterator that calls a function on each element of another iterator.<br/>
+		 * Functions returning a reference are passed through, and functions returning a value have it cached until the next element.
+		 */
+		template<typename InnerIterator, typename FunctionType>
+		struct TransformIterator final : public Toolbox::Iterator<TransformIterator<InnerIterator, FunctionType>, TransformedOf<InnerIterator, FunctionType>> {
+
+			// TYPE
+
+			/** The element type of this iterator. */
+			using Type = TransformedOf<InnerIterator, FunctionType>;
+
+			/** Whether the function returns a reference. */
+			static constexpr bool IsReference = std::is_lvalue_reference_v<std::invoke_result_t<const FunctionType&, ElementOf<InnerIterator>&>>;
+
+		private:
+
+			// DATA
+
+			/** The current position. */
+			InnerIterator inner;
+
+			/** The function to call on each element. */
+			const FunctionType* function;
+
+			/** The result of the function on the current element if it does not return a reference. */
+			Cached<std::conditional_t<IsReference, char, Type>> cache;
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Inner iterator constructor. */
+			TransformIterator(InnerIterator Inner, const FunctionType* Function) : inner(Inner), function(Function), cache() {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the result of the function on the underlying element of this iterator. */
+			Type& operator*() override {
+				if constexpr (IsReference) {
+					return (*function)(*inner);
+				}
+				else {
+					return cache.Emplace((*function)(*inner));
+				}
+			}
+
+			/** Returns a constant reference to the result of the function on the underlying element of this iterator. */
+			const Type& operator*() const override {
+				return *const_cast<TransformIterator&>(*this);
+			}
+
+			/** Increments this iterator to the next element. */
+			TransformIterator& operator++() override {
+				++inner;
+				return *this;
+			}
+
+			/** Returns whether the given iterators are at the same position. */
+			bool operator==(const Toolbox::Iterator<TransformIterator, Type>& Other) const override {
+				return inner == static_cast<const TransformIterator&>(Other).inner;
+			}
+
+			/** Returns whether this iterator has not reached the end of its range. */
+			explicit operator bool() const override {
+				return static_cast<bool>(inner);
+			}
+		};
+
+		/** An iterator over at most a given number of elements of another iterator. */
+		template<typename InnerIterator>
+		struct TakeIterator final : public Toolbox::Iterator<TakeIterator<InnerIterator>, ElementOf<InnerIterator>> {
+
+			// TYPE
+
+			/** The element type of this iterator. */
+			using Type = ElementOf<InnerIterator>;
+
+		private:
+
+			// DATA
+
+			/** The current position. */
+			InnerIterator inner;
+
+			/** The number of elements left to take. */
+			size_t remaining;
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Inner iterator constructor. */
+			TakeIterator(InnerIterator Inner, const size_t Remaining) : inner(Inner), remaining(Remaining) {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the underlying element of this iterator. */
+			Type& operator*() override {
+				return *inner;
+			}
+
+			/** Returns a constant reference to the underlying element of this iterator. */
+			const Type& operator*() const override {
+				return *const_cast<TakeIterator&>(*this).inner;
+			}
+
+			/** Increments this iterator to the next element. */
+			TakeIterator& operator++() override {
+				++inner;
+				--remaining;
+				return *this;
+			}
+
+			/** Returns whether the given iterators are at the same position, or both at their end. */
+			bool operator==(const Toolbox::Iterator<TakeIterator, Type>& Other) const override {
+				const TakeIterator& Iterator = static_cast<const TakeIterator&>(Other);
+				if (!*this || !Iterator) {
+					return !*this && !Iterator;
+				}
+				return inner == Iterator.inner;
+			}
+
+			/** Returns whether this iterator has elements left to take. */
+			explicit operator bool() const override {
+				return remaining > 0 && static_cast<bool>(inner);
+			}
+		};
+
+		/** An iterator over pairs of elements of two other iterators, which ends when either iterator ends. */
+		template<typename FirstIterator, typename SecondIterator>
+		struct ZipIterator final : public Toolbox::Iterator<ZipIterator<FirstIterator, SecondIterator>, Zipped<ElementOf<FirstIterator>, ElementOf<SecondIterator>>> {
+
+			// TYPE
+
+			/** The element type of this iterator. */
+			using Type = Zipped<ElementOf<FirstIterator>, ElementOf<SecondIterator>>;
+
+		private:
+
+			// DATA
+
+			/** The current position of the first iterator. */
+			FirstIterator first;
+
+			/** The current position of the second iterator. */
+			SecondIterator second;
+
+			/** The current pair of elements. */
+			Cached<Type> cache;
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Inner iterators constructor. */
+			ZipIterator(FirstIterator First, SecondIterator Second) : first(First), second(Second), cache() {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the current pair of elements. */
+			Type& operator*() override {
+				return cache.Emplace(*first, *second);
+			}
+
+			/** Returns a constant reference to the current pair of elements. */
+			const Type& operator*() const override {
+				return *const_cast<ZipIterator&>(*this);
+			}
+
+			/** Increments both iterators to their next elements. */
+			ZipIterator& operator++() override {
+				++first;
+				++second;
+				return *this;
+			}
+
+			/** Returns whether the given iterators are at the same position, or both at their end. */
+			bool operator==(const Toolbox::Iterator<ZipIterator, Type>& Other) const override {
+				const ZipIterator& Iterator = static_cast<const ZipIterator&>(Other);
+				if (!*this || !Iterator) {
+					return !*this && !Iterator;
+				}
+				return first == Iterator.first && second == Iterator.second;
+			}
+
+			/** Returns whether neither iterator has reached its end. */
+			explicit operator bool() const override {
+				return static_cast<bool>(first) && static_cast<bool>(second);
+			}
+		};
+
+		/** An iterator over the elements of another iterator and their indices. */
+		template<typename InnerIterator>
+		struct EnumerateIterator final : public Toolbox::Iterator<EnumerateIterator<InnerIterator>, Enumerated<ElementOf<InnerIterator>>> {
+
+			// TYPE
+
+			/** The element type of this iterator. */
+			using Type = Enumerated<ElementOf<InnerIterator>>;
+
+		private:
+
+			// DATA
+
+			/** The current position. */
+			InnerIterator inner;
+
+			/** The index of the current element. */
+			size_t index;
+
+			/** The current element and its index. */
+			Cached<Type> cache;
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Inner iterator constructor. */
+			EnumerateIterator(InnerIterator Inner) : inner(Inner), index(0), cache() {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the current element and its index. */
+			Type& operator*() override {
+				return cache.Emplace(index, *inner);
+			}
+
+			/** Returns a constant reference to the current element and its index. */
+			const Type& operator*() const override {
+				return *const_cast<EnumerateIterator&>(*this);
+			}
+
+			/** Increments this iterator to the next element. */
+			EnumerateIterator& operator++() override {
+				++inner;
+				++index;
+				return *this;
+			}
+
+			/** Returns whether the given iterators are at the same position. */
+			bool operator==(const Toolbox::Iterator<EnumerateIterator, Type>& Other) const override {
+				return inner == static_cast<const EnumerateIterator&>(Other).inner;
+			}
+
+			/** Returns whether this iterator has not reached the end of its range. */
+			explicit operator bool() const override {
+				return static_cast<bool>(inner);
+			}
+		};
+
+
+		// PIPE
+
+		/**
+		 * The adapters and terminal operations shared by every stage of a pipeline.<br/>
+		 * Functors are stored by value in each stage and must be callable when constant.
+		 */
+		template<typename StageType>
+		class Pipe {
+
+			// HELPERS
+
+			/** Returns this pipe as its stage. */
+			const StageType& Self() const {
+				return static_cast<const StageType&>(*this);
+			}
+
+		public:
+
+			// ADAPTERS
+
+			/** Returns a stage over the elements of this stage that match the given predicate. */
+			template<typename PredicateType>
+			FilterStage<StageType, std::decay_t<PredicateType>> Filter(PredicateType&& Predicate) const {
+				return FilterStage<StageType, std::decay_t<PredicateType>>(Self(), std::forward<PredicateType>(Predicate));
+			}
+
+			/** Returns a stage over the results of calling the given function on each element of this stage. */
+			template<typename FunctionType>
+			TransformStage<StageType, std::decay_t<FunctionType>> Transform(FunctionType&& Function) const {
+				return TransformStage<StageType, std::decay_t<FunctionType>>(Self(), std::forward<FunctionType>(Function));
+			}
+
+			/** Returns a stage over at most the given number of elements of this stage. */
+			TakeStage<StageType> Take(const size_t Count) const {
+				return TakeStage<StageType>(Self(), Count);
+			}
+
+			/** Returns a stage over pairs of elements of this stage and the given stage. */
+			template<typename OtherStage>
+			ZipStage<StageType, OtherStage> Zip(const Pipe<OtherStage>& Other) const {
+				return ZipStage<StageType, OtherStage>(Self(), static_cast<const OtherStage&>(Other));
+			}
+
+			/** Returns a stage over pairs of elements of this stage and the given collection. */
+			template<typename CollectionType, typename = std::enable_if_t<!std::is_base_of_v<Pipe<std::remove_const_t<CollectionType>>, std::remove_const_t<CollectionType>>>>
+			ZipStage<StageType, SourceStage<decltype(std::declval<CollectionType&>().begin())>> Zip(CollectionType& Collection) const {
+				using Source = SourceStage<decltype(std::declval<CollectionType&>().begin())>;
+				return ZipStage<StageType, Source>(Self(), Source(Collection.begin(), Collection.end()));
+			}
+
+			/** Returns a stage over the elements of this stage and their indices. */
+			EnumerateStage<StageType> Enumerate() const {
+				return EnumerateStage<StageType>(Self());
+			}
+
+
+			// TERMINALS
+
+			/** Calls the given function on each element of this stage. */
+			template<typename FunctionType>
+			void ForEach(FunctionType&& Function) const {
+				for (auto Iterator = Self().begin(); Iterator; ++Iterator) {
+					Function(*Iterator);
+				}
+			}
+
+			/**
+			 * Returns the result of combining each element of this stage into the given starting value with the given accumulator.<br/>
+			 * The accumulator may either return the combined value or modify the value passed to it by reference.
+			 */
+			template<typename Type, typename AccumulatorType>
+			Type Reduce(Type Start, AccumulatorType&& Accumulator) const {
+				for (auto Iterator = Self().begin(); Iterator; ++Iterator) {
+					if constexpr (std::is_void_v<std::invoke_result_t<AccumulatorType&, Type&, decltype(*Iterator)>>) {
+						Accumulator(Start, *Iterator);
+					}
+					else {
+						Start = Accumulator(Start, *Iterator);
+					}
+				}
+				return Start;
+			}
+
+			/** Returns the number of elements in this stage. */
+			size_t Count() const {
+				size_t Count = 0;
+				for (auto Iterator = Self().begin(); Iterator; ++Iterator) {
+					++Count;
+				}
+				return Count;
+			}
+
+			/** Returns whether any element of this stage matches the given predicate. */
+			template<typename PredicateType>
+			bool Any(PredicateType&& Predicate) const {
+				for (auto Iterator = Self().begin(); Iterator; ++Iterator) {
+					if (Predicate(*Iterator)) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			/** Returns whether every element of this stage matches the given predicate. */
+			template<typename PredicateType>
+			bool All(PredicateType&& Predicate) const {
+				for (auto Iterator = Self().begin(); Iterator; ++Iterator) {
+					if (!Predicate(*Iterator)) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			/** Pushes a copy of each element of this stage onto the back of the given collection and returns it. */
+			template<typename CollectionType>
+			CollectionType& Collect(CollectionType& Collection) const {
+				for (auto Iterator = Self().begin(); Iterator; ++Iterator) {
+					Collection.PushBack(*Iterator);
+				}
+				return Collection;
+			}
+
+			/** Returns a new vector of copies of each element of this stage. */
+			auto ToVector() const {
+				Vector<std::remove_cv_t<typename decltype(Self().begin())::Type>> Vector;
+				Collect(Vector);
+				return Vector;
+			}
+		};
+
+
+		// STAGES
+
+		/** A stage over a range of an iterator, such as a collection's begin() and end(). */
+		template<typename InnerIterator>
+		class SourceStage final : public Iterable<SourceIterator<InnerIterator>, SourceIterator<InnerIterator>>, public Pipe<SourceStage<InnerIterator>> {
+
+			// DATA
+
+			/** The first position of the range. */
+			InnerIterator first;
+
+			/** The position after the last element of the range. */
+			InnerIterator last;
+
+		public:
+
+			// ITERATOR
+
+			/** The iterator type of this stage. */
+			using Iterator = SourceIterator<InnerIterator>;
+
+
+			// CONSTRUCTOR
+
+			/** Range constructor. */
+			SourceStage(InnerIterator First, InnerIterator Last) : first(First), last(Last) {
+			}
+
+
+			// ITERATORS
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() override {
+				return Iterator(first, last);
+			}
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() const override {
+				return Iterator(first, last);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() override {
+				return Iterator(last, last);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() const override {
+				return Iterator(last, last);
+			}
+		};
+
+		/** A stage over the elements of another stage that match a predicate. */
+		template<typename StageType, typename PredicateType>
+		class FilterStage final : public Iterable<FilterIterator<typename StageType::Iterator, PredicateType>, FilterIterator<typename StageType::Iterator, PredicateType>>, public Pipe<FilterStage<StageType, PredicateType>> {
+
+			// DATA
+
+			/** The stage being filtered. */
+			StageType stage;
+
+			/** The predicate elements must match. */
+			PredicateType predicate;
+
+		public:
+
+			// ITERATOR
+
+			/** The iterator type of this stage. */
+			using Iterator = FilterIterator<typename StageType::Iterator, PredicateType>;
+
+
+			// CONSTRUCTOR
+
+			/** Stage constructor. */
+			template<typename ArgumentType>
+			FilterStage(const StageType& Stage, ArgumentType&& Predicate) : stage(Stage), predicate(std::forward<ArgumentType>(Predicate)) {
+			}
+
+
+			// ITERATORS
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() override {
+				return Iterator(stage.begin(), &predicate);
+			}
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() const override {
+				return Iterator(stage.begin(), &predicate);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() override {
+				return Iterator(stage.end(), &predicate);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() const override {
+				return Iterator(stage.end(), &predicate);
+			}
+		};
+
+		/** A stage over the results of calling a function on each element of another stage. */
+		template<typename StageType, typename FunctionType>
+		class TransformStage final : public Iterable<TransformIterator<typename StageType::Iterator, FunctionType>, TransformIterator<typename StageType::Iterator, FunctionType>>, public Pipe<TransformStage<StageType, FunctionType>> {
+
+			// DATA
+
+			/** The stage being transformed. */
+			StageType stage;
+
+			/** The function to call on each element. */
+			FunctionType function;
+
+		public:
+
+			// ITERATOR
+
+			/** The iterator type of this stage. */
+			using Iterator = TransformIterator<typename StageType::Iterator, FunctionType>;
+
+
+			// CONSTRUCTOR
+
+			/** Stage constructor. */
+			template<typename ArgumentType>
+			TransformStage(const StageType& Stage, ArgumentType&& Function) : stage(Stage), function(std::forward<ArgumentType>(Function)) {
+			}
+
+
+			// ITERATORS
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() override {
+				return Iterator(stage.begin(), &function);
+			}
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() const override {
+				return Iterator(stage.begin(), &function);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() override {
+				return Iterator(stage.end(), &function);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() const override {
+				return Iterator(stage.end(), &function);
+			}
+		};
+
+		/** A stage over at most a given number of elements of another stage. */
+		template<typename StageType>
+		class TakeStage final : public Iterable<TakeIterator<typename StageType::Iterator>, TakeIterator<typename StageType::Iterator>>, public Pipe<TakeStage<StageType>> {
+
+			// DATA
+
+			/** The stage being taken from. */
+			StageType stage;
+
+			/** The maximum number of elements to take. */
+			size_t count;
+
+		public:
+
+			// ITERATOR
+
+			/** The iterator type of this stage. */
+			using Iterator = TakeIterator<typename StageType::Iterator>;
+
+
+			// CONSTRUCTOR
+
+			/** Stage constructor. */
+			TakeStage(const StageType& Stage, const size_t Count) : stage(Stage), count(Count) {
+			}
+
+
+			// ITERATORS
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() override {
+				return Iterator(stage.begin(), count);
+			}
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() const override {
+				return Iterator(stage.begin(), count);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() override {
+				return Iterator(stage.end(), 0);
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() const override {
+				return Iterator(stage.end(), 0);
+			}
+		};
+
+		/** A stage over pairs of elements of two other stages, which ends when either stage ends. */
+		template<typename FirstStage, typename SecondStage>
+		class ZipStage final : public Iterable<ZipIterator<typename FirstStage::Iterator, typename SecondStage::Iterator>, ZipIterator<typename FirstStage::Iterator, typename SecondStage::Iterator>>, public Pipe<ZipStage<FirstStage, SecondStage>> {
+
+			// DATA
+
+			/** The first stage being zipped. */
+			FirstStage first;
+
+			/** The second stage being zipped. */
+			SecondStage second;
+
+		public:
+
+			// ITERATOR
+
+			/** The iterator type of this stage. */
+			using Iterator = ZipIterator<typename FirstStage::Iterator, typename SecondStage::Iterator>;
+
+
+			// CONSTRUCTOR
+
+			/** Stages constructor. */
+			ZipStage(const FirstStage& First, const SecondStage& Second) : first(First), second(Second) {
+			}
+
+
+			// ITERATORS
+
+			/** Returns an iterator to the first pair of this stage. */
+			Iterator begin() override {
+				return Iterator(first.begin(), second.begin());
+			}
+
+			/** Returns an iterator to the first pair of this stage. */
+			Iterator begin() const override {
+				return Iterator(first.begin(), second.begin());
+			}
+
+			/** Returns an iterator after the last pair of this stage. */
+			Iterator end() override {
+				return Iterator(first.end(), second.end());
+			}
+
+			/** Returns an iterator after the last pair of this stage. */
+			Iterator end() const override {
+				return Iterator(first.end(), second.end());
+			}
+		};
+
+		/** A stage over the elements of another stage and their indices. */
+		template<typename StageType>
+		class EnumerateStage final : public Iterable<EnumerateIterator<typename StageType::Iterator>, EnumerateIterator<typename StageType::Iterator>>, public Pipe<EnumerateStage<StageType>> {
+
+			// DATA
+
+			/** The stage being enumerated. */
+			StageType stage;
+
+		public:
+
+			// ITERATOR
+
+			/** The iterator type of this stage. */
+			using Iterator = EnumerateIterator<typename StageType::Iterator>;
+
+
+			// CONSTRUCTOR
+
+			/** Stage constructor. */
+			EnumerateStage(const StageType& Stage) : stage(Stage) {
+			}
+
+
+			// ITERATORS
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() override {
+				return Iterator(stage.begin());
+			}
+
+			/** Returns an iterator to the first element of this stage. */
+			Iterator begin() const override {
+				return Iterator(stage.begin());
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() override {
+				return Iterator(stage.end());
+			}
+
+			/** Returns an iterator after the last element of this stage. */
+			Iterator end() const override {
+				return Iterator(stage.end());
+			}
+		};
+
+
+		// FROM
+
+		/** Returns a pipeline over each element of the given collection, which must outlive the pipeline. */
+		template<typename CollectionType>
+		static SourceStage<decltype(std::declval<CollectionType&>().begin())> From(CollectionType& Collection) {
+			return SourceStage<decltype(std::declval<CollectionType&>().begin())>(Collection.begin(), Collection.end());
+		}
+
+		/** Returns a pipeline over each element from the given iterator up to the given end iterator. */
+		template<typename IteratorType>
+		static SourceStage<IteratorType> From(IteratorType Begin, IteratorType End) {
+			return SourceStage<IteratorType>(Begin, End);
+		}
+	}
+}
@@ -0,0 +1,417 @@
+// .h
+// Point Array Type
+// by Kyle Furey
+
+#pragma once
+#include "Vector.h"
+#include "Simd.h"
+#include "Point.h"
+#include "Box.h"
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// POINT ARRAY
+
+	/**
+	 * A collection of points stored as one contiguous array per component (structure of arrays).<br/>
+	 * Each batch kernel processes a whole SIMD pack of points per instruction for floats and doubles, and falls back to scalar loops otherwise.<br/>
+	 * Kernels that produce one value per point write their results into caller-provided buffers of at least Size() elements.
+	 */
+	template<size_t DIMENSIONS = 2, typename PrecisionType = DEFAULT_PRECISION>
+	class PointArray final {
+		static_assert(DIMENSIONS != 0, "ERROR: Cannot initialize a point array with 0 dimensions!");
+
+	public:
+
+		// POINT AND BOX
+
+		/** Represents a point in space with variable dimensions. */
+		using Point = Toolbox::Point<DIMENSIONS, PrecisionType>;
+
+		/** Represents an axis-aligned bounding box with a center point and extensions used for collisions and intersections. */
+		using Box = Toolbox::Box<DIMENSIONS, PrecisionType>;
+
+
+		// PACK
+
+		/** The SIMD register of components each kernel processes at once. */
+		using Pack = FloatPack<PrecisionType>;
+
+	private:
+
+		// DATA
+
+		/** Each component of every point, stored contiguously by component. */
+		Vector<PrecisionType> components[DIMENSIONS];
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		PointArray() : components() {
+		}
+
+		/** Point vector constructor. */
+		PointArray(const Vector<Point>& Points) : components() {
+			Reserve(Points.Size());
+			for (auto& Point : Points) {
+				PushBack(Point);
+			}
+		}
+
+		/** Initializer list constructor. */
+		PointArray(const std::initializer_list<Point>& List) : components() {
+			Reserve(List.size());
+			for (auto& Point : List) {
+				PushBack(Point);
+			}
+		}
+
+		/** Copy constructor. */
+		PointArray(const PointArray& Copied) = default;
+
+		/** Move constructor. */
+		PointArray(PointArray&& Moved) noexcept = default;
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		PointArray& operator=(const PointArray& Copied) = default;
+
+		/** Move assignment operator. */
+		PointArray& operator=(PointArray&& Moved) noexcept = default;
+
+		/** Returns a copy of the point at the given index. */
+		Point operator[](const size_t Index) const {
+			return Get(Index);
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of points in this array. */
+		size_t Size() const {
+			return components[0].Size();
+		}
+
+		/** Returns the number of points this array can hold before reallocating. */
+		size_t Capacity() const {
+			return components[0].Capacity();
+		}
+
+		/** Returns whether this array has no points. */
+		bool IsEmpty() const {
+			return components[0].IsEmpty();
+		}
+
+		/** Returns a copy of the point at the given index. */
+		Point Get(const size_t Index) const {
+			if (Index >= Size()) {
+				throw std::runtime_error(std::string("ERROR: Index ") + std::to_string(Index) + " was out of bounds of the point array's size of " + std::to_string(Size()) + "!");
+			}
+			Point Result;
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Result[Component] = components[Component][Index];
+			}
+			return Result;
+		}
+
+		/** Returns a pointer to the contiguous values of the given component of every point. */
+		PrecisionType* Component(const size_t Component) {
+			if (Component >= DIMENSIONS) {
+				throw std::runtime_error(std::string("ERROR: Cannot access point component ") + std::to_string(Component) + " when points only have " + std::to_string(DIMENSIONS) + " dimensions!");
+			}
+			return components[Component].begin();
+		}
+
+		/** Returns a constant pointer to the contiguous values of the given component of every point. */
+		const PrecisionType* Component(const size_t Component) const {
+			if (Component >= DIMENSIONS) {
+				throw std::runtime_error(std::string("ERROR: Cannot access point component ") + std::to_string(Component) + " when points only have " + std::to_string(DIMENSIONS) + " dimensions!");
+			}
+			return components[Component].begin();
+		}
+
+		/** Returns each point in this array as a vector of points. */
+		Vector<Point> Points() const {
+			Vector<Point> Points;
+			Points.Reserve(Size());
+			for (size_t Index = 0; Index < Size(); ++Index) {
+				Points.PushBack(Get(Index));
+			}
+			return Points;
+		}
+
+
+		// SETTERS
+
+		/** Replaces the point at the given index. */
+		void Set(const size_t Index, const Point& Point) {
+			if (Index >= Size()) {
+				throw std::runtime_error(std::string("ERROR: Index ") + std::to_string(Index) + " was out of bounds of the point array's size of " + std::to_string(Size()) + "!");
+			}
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				components[Component][Index] = Point[Component];
+			}
+		}
+
+
+		// EXPANSION
+
+		/** Ensures this array can hold at least the given number of points without reallocating. */
+		void Reserve(const size_t Capacity) {
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				components[Component].Reserve(Capacity);
+			}
+		}
+
+		/** Appends a copy of the given point to the end of this array. */
+		void PushBack(const Point& Point) {
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				components[Component].PushBack(Point[Component]);
+			}
+		}
+
+		/** Removes the last point of this array. */
+		void PopBack() {
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				components[Component].PopBack();
+			}
+		}
+
+		/** Removes the point at the given index by replacing it with the last point, which does not preserve order. */
+		void SwapRemove(const size_t Index) {
+			if (Index >= Size()) {
+				throw std::runtime_error(std::string("ERROR: Index ") + std::to_string(Index) + " was out of bounds of the point array's size of " + std::to_string(Size()) + "!");
+			}
+			const size_t Last = Size() - 1;
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				components[Component][Index] = components[Component][Last];
+				components[Component].PopBack();
+			}
+		}
+
+		/** Removes every point from this array while keeping its memory. */
+		void Clear() {
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				components[Component].Clear();
+			}
+		}
+
+
+		// DISTANCE KERNELS
+
+		/** Writes the squared distance from each point to the given point into the given results. */
+		void DistancesSquared(const Point& Target, PrecisionType* Results) const {
+			const size_t Count = Size();
+			Pack Targets[DIMENSIONS];
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Targets[Component] = Pack::Splat(Target[Component]);
+			}
+			size_t Index = 0;
+			for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+				Pack Sum = Pack::Splat(0);
+				for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+					const Pack Delta = Pack::Load(components[Component].begin() + Index) - Targets[Component];
+					Sum = Sum + Delta * Delta;
+				}
+				Sum.Store(Results + Index);
+			}
+			for (; Index < Count; ++Index) {
+				PrecisionType Sum = 0;
+				for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+					const PrecisionType Delta = components[Component][Index] - Target[Component];
+					Sum += Delta * Delta;
+				}
+				Results[Index] = Sum;
+			}
+		}
+
+		/** Writes the distance from each point to the given point into the given results. */
+		void Distances(const Point& Target, PrecisionType* Results) const {
+			DistancesSquared(Target, Results);
+			const size_t Count = Size();
+			size_t Index = 0;
+			for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+				Pack::Load(Results + Index).Sqrt().Store(Results + Index);
+			}
+			for (; Index < Count; ++Index) {
+				Results[Index] = std::sqrt(Results[Index]);
+			}
+		}
+
+		/** Writes the dot product of each point and the given point into the given results. */
+		void DotProducts(const Point& Other, PrecisionType* Results) const {
+			const size_t Count = Size();
+			Pack Others[DIMENSIONS];
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Others[Component] = Pack::Splat(Other[Component]);
+			}
+			size_t Index = 0;
+			for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+				Pack Sum = Pack::Splat(0);
+				for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+					Sum = Sum + Pack::Load(components[Component].begin() + Index) * Others[Component];
+				}
+				Sum.Store(Results + Index);
+			}
+			for (; Index < Count; ++Index) {
+				PrecisionType Sum = 0;
+				for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+					Sum += components[Component][Index] * Other[Component];
+				}
+				Results[Index] = Sum;
+			}
+		}
+
+
+		// TRANSFORM KERNELS
+
+		/** Adds the given offset to each point. */
+		void Translate(const Point& Offset) {
+			const size_t Count = Size();
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				PrecisionType* Values = components[Component].begin();
+				const Pack Offsets = Pack::Splat(Offset[Component]);
+				size_t Index = 0;
+				for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+					(Pack::Load(Values + Index) + Offsets).Store(Values + Index);
+				}
+				for (; Index < Count; ++Index) {
+					Values[Index] += Offset[Component];
+				}
+			}
+		}
+
+		/** Multiplies each point by the given factor per component. */
+		void Scale(const Point& Factor) {
+			const size_t Count = Size();
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				PrecisionType* Values = components[Component].begin();
+				const Pack Factors = Pack::Splat(Factor[Component]);
+				size_t Index = 0;
+				for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+					(Pack::Load(Values + Index) * Factors).Store(Values + Index);
+				}
+				for (; Index < Count; ++Index) {
+					Values[Index] *= Factor[Component];
+				}
+			}
+		}
+
+		/** Multiplies each point by the given scalar. */
+		void Scale(const PrecisionType Scalar) {
+			Scale(Point(Scalar));
+		}
+
+		/** Rotates each 2D point around the origin by the given radians. */
+		void Rotate(const PrecisionType Radians) {
+			static_assert(DIMENSIONS == 2, "ERROR: Only 2D points can be rotated by an angle!");
+			const PrecisionType Cos = std::cos(Radians);
+			const PrecisionType Sin = std::sin(Radians);
+			const Pack Coses = Pack::Splat(Cos);
+			const Pack Sines = Pack::Splat(Sin);
+			PrecisionType* X = components[0].begin();
+			PrecisionType* Y = components[1].begin();
+			const size_t Count = Size();
+			size_t Index = 0;
+			for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+				const Pack OldX = Pack::Load(X + Index);
+				const Pack OldY = Pack::Load(Y + Index);
+				(OldX * Coses - OldY * Sines).Store(X + Index);
+				(OldX * Sines + OldY * Coses).Store(Y + Index);
+			}
+			for (; Index < Count; ++Index) {
+				const PrecisionType OldX = X[Index];
+				X[Index] = OldX * Cos - Y[Index] * Sin;
+				Y[Index] = OldX * Sin + Y[Index] * Cos;
+			}
+		}
+
+
+		// COLLISION KERNELS
+
+		/** Writes whether each point is within the given box into the given results and returns how many points are. */
+		size_t Contains(const Box& Area, bool* Results) const {
+			const size_t Count = Size();
+			const Pack HalfSize = Pack::Splat(Area.HalfSize);
+			Pack Origins[DIMENSIONS];
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Origins[Component] = Pack::Splat(Area.Origin[Component]);
+			}
+			size_t Total = 0;
+			size_t Index = 0;
+			for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+				uint64_t Mask = (static_cast<uint64_t>(1) << Pack::WIDTH) - 1;
+				for (size_t Component = 0; Component < DIMENSIONS && Mask != 0; ++Component) {
+					Mask &= (Pack::Load(components[Component].begin() + Index) - Origins[Component]).Abs().LessEqual(HalfSize);
+				}
+				for (size_t Lane = 0; Lane < Pack::WIDTH; ++Lane) {
+					Results[Index + Lane] = ((Mask >> Lane) & 1) != 0;
+				}
+				Total += static_cast<size_t>(std::popcount(Mask));
+			}
+			for (; Index < Count; ++Index) {
+				bool Inside = true;
+				for (size_t Component = 0; Component < DIMENSIONS && Inside; ++Component) {
+					Inside = std::abs(components[Component][Index] - Area.Origin[Component]) <= Area.HalfSize;
+				}
+				Results[Index] = Inside;
+				Total += Inside ? 1 : 0;
+			}
+			return Total;
+		}
+
+		/** Replaces the given indices with the index of each point within the given box and returns how many points are. */
+		size_t Query(const Box& Area, Vector<size_t>& Indices) const {
+			Indices.Clear();
+			const size_t Count = Size();
+			const Pack HalfSize = Pack::Splat(Area.HalfSize);
+			Pack Origins[DIMENSIONS];
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Origins[Component] = Pack::Splat(Area.Origin[Component]);
+			}
+			size_t Index = 0;
+			for (; Index + Pack::WIDTH <= Count; Index += Pack::WIDTH) {
+				uint64_t Mask = (static_cast<uint64_t>(1) << Pack::WIDTH) - 1;
+				for (size_t Component = 0; Component < DIMENSIONS && Mask != 0; ++Component) {
+					Mask &= (Pack::Load(components[Component].begin() + Index) - Origins[Component]).Abs().LessEqual(HalfSize);
+				}
+				while (Mask != 0) {
+					Indices.PushBack(Index + static_cast<size_t>(std::countr_zero(Mask)));
+					Mask &= Mask - 1;
+				}
+			}
+			for (; Index < Count; ++Index) {
+				bool Inside = true;
+				for (size_t Component = 0; Component < DIMENSIONS && Inside; ++Component) {
+					Inside = std::abs(components[Component][Index] - Area.Origin[Component]) <= Area.HalfSize;
+				}
+				if (Inside) {
+					Indices.PushBack(Index);
+				}
+			}
+			return Indices.Size();
+		}
+
+
+		// TO STRING
+
+		/** Returns the point array as a string. */
+		std::string ToString() const {
+			if (IsEmpty()) {
+				return "{ }";
+			}
+			std::string String = "{ ";
+			for (size_t Index = 0; Index < Size(); ++Index) {
+				String += Get(Index).ToString() + ", ";
+			}
+			String.erase(String.length() - 2, 2);
+			String += " }";
+			return String;
+		}
+	};
+}
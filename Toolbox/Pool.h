@@ -0,0 +1,257 @@
+// .h
+// Object Pool Type
+// by Kyle Furey
+
+#pragma once
+#include <new>
+#include <utility>
+#include <stdexcept>
+#include "Allocator.h"
+
+// The number of objects in the first slab allocated by a pool.
+#define POOL_MIN_SLAB 4
+
+// The maximum number of objects in a single slab allocated by a pool.
+#define POOL_MAX_SLAB 1024
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// POOL
+
+	/**
+	 * A free list allocator that hands out memory for individual objects from contiguous slabs.<br/>
+	 * Slabs grow geometrically and are only returned to the system when the pool is reset or destroyed.<br/>
+	 * A pool does not track its live objects, so each object must be deleted before the pool is reset.<br/>
+	 * Slabs are allocated with the given allocator.
+	 */
+	template<typename Type, typename AllocatorType = HeapAllocator>
+	class Pool final {
+
+		// BLOCK
+
+		/** A single object's worth of memory that links to the next free block while unused. */
+		union Block {
+
+			// DATA
+
+			/** The next free block in the pool. */
+			Block* next;
+
+			/** The raw memory of the object stored in this block. */
+			alignas(Type) unsigned char memory[sizeof(Type)];
+		};
+
+
+		// SLAB
+
+		/** A header placed before each contiguous array of blocks allocated by the pool. */
+		struct alignas(Block) Slab final {
+
+			// DATA
+
+			/** The previously allocated slab. */
+			Slab* next;
+
+			/** The number of blocks in this slab. */
+			size_t count;
+
+
+			// BLOCKS
+
+			/** Returns a pointer to the first block in this slab. */
+			Block* Blocks() {
+				return reinterpret_cast<Block*>(this + 1);
+			}
+		};
+
+
+		// DATA
+
+		/** The allocator slabs are allocated with. */
+		TOOLBOX_NO_UNIQUE_ADDRESS AllocatorType allocator;
+
+		/** The next free block in the pool, or nullptr if a new slab must be allocated. */
+		Block* free;
+
+		/** The most recently allocated slab in the pool. */
+		Slab* slabs;
+
+		/** The total number of blocks across every slab. */
+		size_t capacity;
+
+		/** The number of blocks currently handed out by the pool. */
+		size_t size;
+
+
+		// SLABS
+
+		/** Allocates a new slab with the given number of blocks and links each of them into the free list. */
+		void Grow(const size_t Count) {
+			Slab* New = static_cast<Slab*>(allocator.Allocate(sizeof(Slab) + sizeof(Block) * Count, alignof(Slab)));
+			New->next = slabs;
+			New->count = Count;
+			slabs = New;
+			Block* Blocks = New->Blocks();
+			for (size_t Index = 0; Index < Count - 1; ++Index) {
+				Blocks[Index].next = &Blocks[Index + 1];
+			}
+			Blocks[Count - 1].next = free;
+			free = Blocks;
+			capacity += Count;
+		}
+
+		/** Returns the number of blocks in the next slab the pool would allocate. */
+		size_t NextSlab() const {
+			if (capacity < POOL_MIN_SLAB) {
+				return POOL_MIN_SLAB;
+			}
+			return capacity < POOL_MAX_SLAB ? capacity : POOL_MAX_SLAB;
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor. */
+		Pool() : allocator(), free(nullptr), slabs(nullptr), capacity(0), size(0) {
+		}
+
+		/** Allocator constructor. */
+		explicit Pool(const AllocatorType& Allocator) : allocator(Allocator), free(nullptr), slabs(nullptr), capacity(0), size(0) {
+		}
+
+		/** Copy constructor (pools never share memory, so the new pool is empty and only shares the allocator). */
+		Pool(const Pool& Copied) : allocator(Copied.allocator), free(nullptr), slabs(nullptr), capacity(0), size(0) {
+		}
+
+		/** Move constructor. */
+		Pool(Pool&& Moved) noexcept : allocator(Moved.allocator), free(Moved.free), slabs(Moved.slabs), capacity(Moved.capacity), size(Moved.size) {
+			Moved.free = nullptr;
+			Moved.slabs = nullptr;
+			Moved.capacity = 0;
+			Moved.size = 0;
+		}
+
+		/** Destructor. */
+		~Pool() {
+			Reset();
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator (pools never share memory, so this pool is left unchanged). */
+		Pool& operator=(const Pool& Copied) {
+			return *this;
+		}
+
+		/** Move assignment operator, which takes the other pool's allocator along with its slabs. */
+		Pool& operator=(Pool&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			Reset();
+			allocator = Moved.allocator;
+			free = Moved.free;
+			slabs = Moved.slabs;
+			capacity = Moved.capacity;
+			size = Moved.size;
+			Moved.free = nullptr;
+			Moved.slabs = nullptr;
+			Moved.capacity = 0;
+			Moved.size = 0;
+			return *this;
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of objects currently allocated from the pool. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns the total number of objects the pool can hold without allocating another slab. */
+		size_t Capacity() const {
+			return capacity;
+		}
+
+		/** Returns the allocator slabs are allocated with. */
+		const AllocatorType& GetAllocator() const {
+			return allocator;
+		}
+
+		/** Returns whether no objects are currently allocated from the pool. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+
+		// ALLOCATION
+
+		/** Returns uninitialized memory for a single object from the pool. */
+		Type* Allocate() {
+			if (free == nullptr) {
+				Grow(NextSlab());
+			}
+			Block* Allocated = free;
+			free = free->next;
+			++size;
+			return reinterpret_cast<Type*>(Allocated->memory);
+		}
+
+		/** Returns the given object's memory to the pool without destroying it. */
+		void Deallocate(Type* Object) {
+			if (Object == nullptr) {
+				return;
+			}
+			Block* Deallocated = reinterpret_cast<Block*>(Object);
+			Deallocated->next = free;
+			free = Deallocated;
+			--size;
+		}
+
+		/** Constructs a new object in the pool with the given arguments and returns a pointer to it. */
+		template<typename... ArgumentTypes>
+		Type* New(ArgumentTypes&&... Arguments) {
+			Type* Object = Allocate();
+			try {
+				return new(Object) Type(std::forward<ArgumentTypes>(Arguments)...);
+			}
+			catch (...) {
+				Deallocate(Object);
+				throw;
+			}
+		}
+
+		/** Destroys the given object and returns its memory to the pool. */
+		void Delete(Type* Object) {
+			if (Object == nullptr) {
+				return;
+			}
+			Object->~Type();
+			Deallocate(Object);
+		}
+
+		/** Ensures the pool can allocate at least the given number of additional objects without allocating another slab. */
+		void Reserve(const size_t Count) {
+			const size_t Free = capacity - size;
+			if (Count > Free) {
+				Grow(Count - Free);
+			}
+		}
+
+		/** Returns every slab to the system. Each object allocated from the pool must already be deleted. */
+		void Reset() {
+			while (slabs != nullptr) {
+				Slab* Next = slabs->next;
+				allocator.Deallocate(slabs, sizeof(Slab) + sizeof(Block) * slabs->count, alignof(Slab));
+				slabs = Next;
+			}
+			free = nullptr;
+			capacity = 0;
+			size = 0;
+		}
+	};
+}
@@ -107,15 +107,19 @@ namespace Toolbox {
 
 		/** Pushes a copy of the given data to the queue relative to its priority value. */
 		void Push(const Type& Value, const PriorityType Priority) {
-			Node NewNode(Value, Priority);
-			size_t Index = 0;
-			for (auto& Node : queue.AsList()) {
-				if (Priority < Node.Priority()) {
-					break;
+			Ring<Node>& Nodes = queue.AsRing();
+			size_t Low = 0;
+			size_t High = Nodes.Size();
+			while (Low < High) {
+				const size_t Middle = Low + (High - Low) / 2;
+				if (Priority < Nodes.Unchecked(Middle).Priority()) {
+					High = Middle;
+				}
+				else {
+					Low = Middle + 1;
 				}
-				++Index;
 			}
-			queue.AsList().Insert(Index, NewNode);
+			Nodes.Emplace(Low, Value, Priority);
 		}
 
 		/** Removes and returns the element with the lowest priority in the queue. */
@@ -141,7 +145,7 @@ namespace Toolbox {
 		std::string ToString() const {
 			std::string String;
 			for (size_t Index = 0; Index < queue.Size(); ++Index) {
-				String += "{ " + std::to_string(queue.AsList()[Index].Data()) + " : " + std::to_string(queue.AsList()[Index].Priority()) + " } -> ";
+				String += "{ " + std::to_string(queue.AsRing()[Index].Data()) + " : " + std::to_string(queue.AsRing()[Index].Priority()) + " } -> ";
 			}
 			if (!String.empty()) {
 				String.erase(String.length() - 4, 4);
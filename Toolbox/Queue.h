@@ -3,7 +3,7 @@
 // by Kyle Furey
 
 #pragma once
-#include "List.h"
+#include "Ring.h"
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
@@ -16,8 +16,8 @@ namespace Toolbox {
 
 		// DATA
 
-		/** The underlying list managing this queue. */
-		List<Type> data;
+		/** The underlying ring buffer managing this queue. */
+		Ring<Type> data;
 
 	public:
 
@@ -73,6 +73,11 @@ namespace Toolbox {
 			return data.Total(Value);
 		}
 
+		/** Returns the number of elements the queue can hold before reallocating. */
+		size_t Capacity() const {
+			return data.Capacity();
+		}
+
 		/** Returns whether the queue is empty. */
 		bool IsEmpty() const {
 			return data.IsEmpty();
@@ -89,31 +94,56 @@ namespace Toolbox {
 
 		// EXPANSION
 
-		/** Deallocates the queue. */
+		/** Destroys each element in the queue while keeping its memory. */
 		void Clear() {
 			data.Clear();
 		}
 
+		/** Ensures the queue can hold at least the given number of elements without reallocating. */
+		void Reserve(const size_t Capacity) {
+			data.Reserve(Capacity);
+		}
+
 		/** Pushes a copy of the given data to the front of the queue. */
 		void Push(const Type& Value) {
 			data.PushFront(Value);
 		}
 
+		/** Pushes the given data to the front of the queue. */
+		void Push(Type&& Value) {
+			data.PushFront(std::move(Value));
+		}
+
 		/** Pushes a copy of the given data to the end of the queue. */
 		void PushLast(const Type& Value) {
 			data.PushBack(Value);
 		}
 
-		/** Pushes a new element with the given arguments to the front of the quue. */
+		/** Pushes the given data to the end of the queue. */
+		void PushLast(Type&& Value) {
+			data.PushBack(std::move(Value));
+		}
+
+		/** Pushes a copy of each of the given elements to the front of the queue in order. */
+		void PushRange(const size_t Size, const Type* Array) {
+			data.PushRangeFront(Size, Array);
+		}
+
+		/** Pushes a copy of each of the given elements to the end of the queue in order. */
+		void PushRangeLast(const size_t Size, const Type* Array) {
+			data.PushRangeBack(Size, Array);
+		}
+
+		/** Pushes a new element with the given arguments to the front of the queue. */
 		template<typename... ArgumentTypes>
 		void Emplace(ArgumentTypes&&... Arguments) {
-			data.EmplaceFront(Arguments...);
+			data.EmplaceFront(std::forward<ArgumentTypes>(Arguments)...);
 		}
 
 		/** Pushes a new element with the given arguments to the end of the queue. */
 		template<typename... ArgumentTypes>
 		void EmplaceLast(ArgumentTypes&&... Arguments) {
-			data.EmplaceBack(Arguments...);
+			data.EmplaceBack(std::forward<ArgumentTypes>(Arguments)...);
 		}
 
 		/** Removes and returns the next element in the queue. */
@@ -121,7 +151,7 @@ namespace Toolbox {
 			if (data.IsEmpty()) {
 				throw std::runtime_error("ERROR: The queue is empty!");
 			}
-			Type front = data.Front();
+			Type front = std::move(data.Front());
 			data.PopFront();
 			return front;
 		}
@@ -131,11 +161,21 @@ namespace Toolbox {
 			if (data.IsEmpty()) {
 				throw std::runtime_error("ERROR: The queue is empty!");
 			}
-			Type back = data.Back();
+			Type back = std::move(data.Back());
 			data.PopBack();
 			return back;
 		}
 
+		/** Moves up to the given number of the next elements in the queue into the given array in order and returns the number moved. */
+		size_t PopInto(Type* Array, const size_t Count) {
+			return data.PopFrontInto(Array, Count);
+		}
+
+		/** Moves up to the given number of the last elements in the queue into the given array in order and returns the number moved. */
+		size_t PopLastInto(Type* Array, const size_t Count) {
+			return data.PopBackInto(Array, Count);
+		}
+
 
 		// TO STRING
 
@@ -155,15 +195,15 @@ namespace Toolbox {
 		}
 
 
-		// AS LIST
+		// AS RING
 
-		/** Returns a reference to this queue's underlying list. */
-		List<Type>& AsList() {
+		/** Returns a reference to this queue's underlying ring buffer. */
+		Ring<Type>& AsRing() {
 			return data;
 		}
 
-		/** Returns a constant reference to this queue's underlying list. */
-		const List<Type>& AsList() const {
+		/** Returns a constant reference to this queue's underlying ring buffer. */
+		const Ring<Type>& AsRing() const {
 			return data;
 		}
 	};
@@ -0,0 +1,652 @@
+// .h
+// Ring Buffer Type
+// by Kyle Furey
+
+#pragma once
+#include <string>
+#include <new>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+// The number of elements a ring buffer allocates when it first grows.
+#define RING_MIN_CAPACITY 8
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// RING BUFFER
+
+	/**
+	 * Represents a contiguous, double-ended circular array of the given type.<br/>
+	 * Pushing and popping at either end is amortized constant time and never allocates individual elements.<br/>
+	 * The capacity is always a power of two so indices wrap with a mask.
+	 */
+	template<typename Type>
+	class Ring final {
+	public:
+
+		// ITERATOR
+
+		/** A two-way iterator that traverses the elements of a ring buffer in order. */
+		template<typename RingType, typename ElementType>
+		struct RingIterator final {
+		private:
+
+			// DATA
+
+			/** The ring buffer this iterator traverses. */
+			RingType* ring;
+
+			/** The logical index of this iterator's element. */
+			size_t index;
+
+			template<typename, typename>
+			friend struct RingIterator;
+
+		public:
+
+			// CONSTRUCTORS
+
+			/** Default constructor. */
+			RingIterator(RingType* Ring = nullptr, const size_t Index = 0) : ring(Ring), index(Index) {
+			}
+
+			/** Constant conversion constructor. */
+			template<typename OtherRingType, typename OtherElementType>
+			RingIterator(const RingIterator<OtherRingType, OtherElementType>& Iterator) : ring(Iterator.ring), index(Iterator.index) {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the underlying element of this iterator. */
+			ElementType& operator*() const {
+				return ring->Unchecked(index);
+			}
+
+			/** Returns a dereferenced pointer to the underlying element of this iterator. */
+			ElementType* operator->() const {
+				return &ring->Unchecked(index);
+			}
+
+			/** Increments this iterator to the next element. */
+			RingIterator& operator++() {
+				++index;
+				return *this;
+			}
+
+			/** Increments this iterator to the next element and returns a copy of the previous iterator. */
+			RingIterator operator++(int) {
+				RingIterator Copy = *this;
+				++index;
+				return Copy;
+			}
+
+			/** Decrements this iterator to the previous element. */
+			RingIterator& operator--() {
+				--index;
+				return *this;
+			}
+
+			/** Decrements this iterator to the previous element and returns a copy of the next iterator. */
+			RingIterator operator--(int) {
+				RingIterator Copy = *this;
+				--index;
+				return Copy;
+			}
+
+			/** Returns a copy of this iterator after incrementing the given count. */
+			RingIterator operator+(const ptrdiff_t Count) const {
+				return RingIterator(ring, index + Count);
+			}
+
+			/** Returns a reference to this iterator after incrementing the given count. */
+			RingIterator& operator+=(const ptrdiff_t Count) {
+				index += Count;
+				return *this;
+			}
+
+			/** Returns a copy of this iterator after decrementing the given count. */
+			RingIterator operator-(const ptrdiff_t Count) const {
+				return RingIterator(ring, index - Count);
+			}
+
+			/** Returns a reference to this iterator after decrementing the given count. */
+			RingIterator& operator-=(const ptrdiff_t Count) {
+				index -= Count;
+				return *this;
+			}
+
+			/** Returns the number of elements between the given iterators. */
+			ptrdiff_t operator-(const RingIterator& Other) const {
+				return static_cast<ptrdiff_t>(index) - static_cast<ptrdiff_t>(Other.index);
+			}
+
+			/** Returns a reference to this iterator's element after incrementing the given count. */
+			ElementType& operator[](const size_t Index) const {
+				return ring->Unchecked(index + Index);
+			}
+
+			/** Returns whether the given iterators are equal. */
+			bool operator==(const RingIterator& Other) const {
+				return ring == Other.ring && index == Other.index;
+			}
+
+			/** Returns whether the given iterators are not equal. */
+			bool operator!=(const RingIterator& Other) const {
+				return !(*this == Other);
+			}
+
+			/** Returns whether this iterator is valid. */
+			explicit operator bool() const {
+				return ring != nullptr && index < ring->Size();
+			}
+
+			/** Returns whether this iterator is not valid. */
+			bool operator!() const {
+				return !static_cast<bool>(*this);
+			}
+		};
+
+		/** A two-way iterator that traverses the elements of a ring buffer. */
+		using Iterator = RingIterator<Ring<Type>, Type>;
+
+		/** A two-way iterator that traverses the constant elements of a ring buffer. */
+		using ConstantIterator = RingIterator<const Ring<Type>, const Type>;
+
+	private:
+
+		// DATA
+
+		/** The current number of elements in the ring buffer. */
+		size_t size;
+
+		/** The current power of two number of elements the ring buffer can hold. */
+		size_t capacity;
+
+		/** The physical index of the first element in the ring buffer. */
+		size_t head;
+
+		/** The underlying uninitialized array of this type. */
+		Type* data;
+
+
+		// MEMORY
+
+		/** Returns the physical index of the given logical index. */
+		size_t Physical(const size_t Index) const {
+			return (head + Index) & (capacity - 1);
+		}
+
+		/** Relocates each element into a new array of the given power of two capacity. */
+		void Relocate(const size_t NewCapacity) {
+			Type* Array = static_cast<Type*>(::operator new(sizeof(Type) * NewCapacity, std::align_val_t(alignof(Type))));
+			for (size_t Index = 0; Index < size; ++Index) {
+				Type& Element = data[Physical(Index)];
+				new(&Array[Index]) Type(std::move(Element));
+				Element.~Type();
+			}
+			if (data != nullptr) {
+				::operator delete(data, std::align_val_t(alignof(Type)));
+			}
+			data = Array;
+			capacity = NewCapacity;
+			head = 0;
+		}
+
+		/** Grows the ring buffer if it cannot hold one more element (element references are invalidated). */
+		void Grow() {
+			if (size == capacity) {
+				Relocate(capacity > 0 ? capacity * 2 : RING_MIN_CAPACITY);
+			}
+		}
+
+		/** Throws if the given index is not a valid index in the ring buffer. */
+		void Check(const size_t Index) const {
+			if (Index >= size) {
+				throw std::runtime_error(
+					std::string("ERROR: Index ") +
+					std::to_string(Index) +
+					" is out of bounds of the ring buffer of size " +
+					std::to_string(size) + ".");
+			}
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor. */
+		Ring() : size(0), capacity(0), head(0), data(nullptr) {
+		}
+
+		/** Fill constructor. */
+		Ring(const size_t Size, const Type& Value = Type()) : size(0), capacity(0), head(0), data(nullptr) {
+			Reserve(Size);
+			for (size_t Index = 0; Index < Size; ++Index) {
+				PushBack(Value);
+			}
+		}
+
+		/** Array constructor. */
+		Ring(const size_t Size, const Type* Array) : size(0), capacity(0), head(0), data(nullptr) {
+			PushRangeBack(Size, Array);
+		}
+
+		/** Initializer list constructor. */
+		Ring(const std::initializer_list<Type>& List) : size(0), capacity(0), head(0), data(nullptr) {
+			PushRangeBack(List.size(), List.begin());
+		}
+
+		/** Copy constructor. */
+		Ring(const Ring<Type>& Copied) : size(0), capacity(0), head(0), data(nullptr) {
+			Reserve(Copied.size);
+			for (auto& Element : Copied) {
+				PushBack(Element);
+			}
+		}
+
+		/** Move constructor. */
+		Ring(Ring<Type>&& Moved) noexcept : size(Moved.size), capacity(Moved.capacity), head(Moved.head), data(Moved.data) {
+			Moved.size = 0;
+			Moved.capacity = 0;
+			Moved.head = 0;
+			Moved.data = nullptr;
+		}
+
+		/** Destructor. */
+		~Ring() {
+			Reset();
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		Ring<Type>& operator=(const Ring<Type>& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			Clear();
+			Reserve(Copied.size);
+			for (auto& Element : Copied) {
+				PushBack(Element);
+			}
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		Ring<Type>& operator=(Ring<Type>&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			Reset();
+			size = Moved.size;
+			capacity = Moved.capacity;
+			head = Moved.head;
+			data = Moved.data;
+			Moved.size = 0;
+			Moved.capacity = 0;
+			Moved.head = 0;
+			Moved.data = nullptr;
+			return *this;
+		}
+
+		/** Returns a reference to the data at the given index. */
+		Type& operator[](const size_t Index) {
+			Check(Index);
+			return data[Physical(Index)];
+		}
+
+		/** Returns a constant reference to the data at the given index. */
+		const Type& operator[](const size_t Index) const {
+			Check(Index);
+			return data[Physical(Index)];
+		}
+
+
+		// ITERATORS
+
+		/** Returns an iterator to the first element in the ring buffer. */
+		Iterator begin() {
+			return Iterator(this, 0);
+		}
+
+		/** Returns a constant iterator to the first element in the ring buffer. */
+		ConstantIterator begin() const {
+			return ConstantIterator(this, 0);
+		}
+
+		/** Returns an iterator to the element after the last element in the ring buffer. */
+		Iterator end() {
+			return Iterator(this, size);
+		}
+
+		/** Returns a constant iterator to the element after the last element in the ring buffer. */
+		ConstantIterator end() const {
+			return ConstantIterator(this, size);
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of elements in the ring buffer. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns the number of elements the ring buffer can hold before reallocating. */
+		size_t Capacity() const {
+			return capacity;
+		}
+
+		/** Returns whether the given index is a valid index in the ring buffer. */
+		bool IsValidIndex(const size_t Index) const {
+			return Index < size;
+		}
+
+		/** Returns a reference to the data at the given index. */
+		Type& Get(const size_t Index) {
+			return (*this)[Index];
+		}
+
+		/** Returns a constant reference to the data at the given index. */
+		const Type& Get(const size_t Index) const {
+			return (*this)[Index];
+		}
+
+		/** Returns a reference to the data at the given index without checking its bounds. */
+		Type& Unchecked(const size_t Index) {
+			return data[Physical(Index)];
+		}
+
+		/** Returns a constant reference to the data at the given index without checking its bounds. */
+		const Type& Unchecked(const size_t Index) const {
+			return data[Physical(Index)];
+		}
+
+		/** Returns a reference to the data at the front of the ring buffer. */
+		Type& Front() {
+			return (*this)[0];
+		}
+
+		/** Returns a constant reference to the data at the front of the ring buffer. */
+		const Type& Front() const {
+			return (*this)[0];
+		}
+
+		/** Returns a reference to the data at the back of the ring buffer. */
+		Type& Back() {
+			return (*this)[size - 1];
+		}
+
+		/** Returns a constant reference to the data at the back of the ring buffer. */
+		const Type& Back() const {
+			return (*this)[size - 1];
+		}
+
+		/** Returns the index of the first matching value in the ring buffer, or -1 if no match is found. */
+		ptrdiff_t Find(const Type& Value) const {
+			for (size_t Index = 0; Index < size; ++Index) {
+				if (Value == data[Physical(Index)]) {
+					return static_cast<ptrdiff_t>(Index);
+				}
+			}
+			return -1;
+		}
+
+		/** Returns the index of the last matching value in the ring buffer, or -1 if no match is found. */
+		ptrdiff_t FindLast(const Type& Value) const {
+			for (size_t Index = size; Index > 0; --Index) {
+				if (Value == data[Physical(Index - 1)]) {
+					return static_cast<ptrdiff_t>(Index - 1);
+				}
+			}
+			return -1;
+		}
+
+		/** Returns whether the given value is present in the ring buffer. */
+		bool Contains(const Type& Value) const {
+			return Find(Value) != -1;
+		}
+
+		/** Returns the total number of elements that match the given value in the ring buffer. */
+		size_t Total(const Type& Value) const {
+			size_t Total = 0;
+			for (size_t Index = 0; Index < size; ++Index) {
+				if (Value == data[Physical(Index)]) {
+					++Total;
+				}
+			}
+			return Total;
+		}
+
+		/** Returns whether the ring buffer is empty. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+
+		// SETTERS
+
+		/** Swaps the given elements at the given indicies. */
+		void Swap(const size_t Left, const size_t Right) {
+			Check(Left);
+			Check(Right);
+			std::swap(data[Physical(Left)], data[Physical(Right)]);
+		}
+
+		/** Reverses the ring buffer. */
+		void Reverse() {
+			for (size_t Index = 0; Index < size / 2; ++Index) {
+				std::swap(data[Physical(Index)], data[Physical(size - Index - 1)]);
+			}
+		}
+
+
+		// EXPANSION
+
+		/** Ensures the ring buffer can hold at least the given number of elements without reallocating. */
+		void Reserve(const size_t Capacity) {
+			if (Capacity <= capacity) {
+				return;
+			}
+			size_t NewCapacity = capacity > 0 ? capacity : RING_MIN_CAPACITY;
+			while (NewCapacity < Capacity) {
+				NewCapacity *= 2;
+			}
+			Relocate(NewCapacity);
+		}
+
+		/** Destroys each element in the ring buffer while keeping its memory. */
+		void Clear() {
+			for (size_t Index = 0; Index < size; ++Index) {
+				data[Physical(Index)].~Type();
+			}
+			size = 0;
+			head = 0;
+		}
+
+		/** Destroys each element in the ring buffer and deallocates its memory. */
+		void Reset() {
+			Clear();
+			if (data != nullptr) {
+				::operator delete(data, std::align_val_t(alignof(Type)));
+			}
+			capacity = 0;
+			data = nullptr;
+		}
+
+		/** Constructs a new element in place with the given arguments at the front of the ring buffer. */
+		template<typename... ArgumentTypes>
+		Type& EmplaceFront(ArgumentTypes&&... Arguments) {
+			if (size == capacity) {
+				Type Value(std::forward<ArgumentTypes>(Arguments)...);
+				Grow();
+				return EmplaceFront(std::move(Value));
+			}
+			const size_t Index = (head + capacity - 1) & (capacity - 1);
+			new(&data[Index]) Type(std::forward<ArgumentTypes>(Arguments)...);
+			head = Index;
+			++size;
+			return data[Index];
+		}
+
+		/** Constructs a new element in place with the given arguments at the back of the ring buffer. */
+		template<typename... ArgumentTypes>
+		Type& EmplaceBack(ArgumentTypes&&... Arguments) {
+			if (size == capacity) {
+				Type Value(std::forward<ArgumentTypes>(Arguments)...);
+				Grow();
+				return EmplaceBack(std::move(Value));
+			}
+			Type* Element = new(&data[Physical(size)]) Type(std::forward<ArgumentTypes>(Arguments)...);
+			++size;
+			return *Element;
+		}
+
+		/** Pushes a copy of the given data to the front of the ring buffer. */
+		Type& PushFront(const Type& Value) {
+			return EmplaceFront(Value);
+		}
+
+		/** Pushes the given data to the front of the ring buffer. */
+		Type& PushFront(Type&& Value) {
+			return EmplaceFront(std::move(Value));
+		}
+
+		/** Pushes a copy of the given data to the back of the ring buffer. */
+		Type& PushBack(const Type& Value) {
+			return EmplaceBack(Value);
+		}
+
+		/** Pushes the given data to the back of the ring buffer. */
+		Type& PushBack(Type&& Value) {
+			return EmplaceBack(std::move(Value));
+		}
+
+		/** Pushes a copy of each of the given elements to the front of the ring buffer in order, so the last element ends at the front. */
+		void PushRangeFront(const size_t Size, const Type* Array) {
+			Reserve(size + Size);
+			for (size_t Index = 0; Index < Size; ++Index) {
+				EmplaceFront(Array[Index]);
+			}
+		}
+
+		/** Pushes a copy of each of the given elements to the back of the ring buffer in order. */
+		void PushRangeBack(const size_t Size, const Type* Array) {
+			Reserve(size + Size);
+			for (size_t Index = 0; Index < Size; ++Index) {
+				EmplaceBack(Array[Index]);
+			}
+		}
+
+		/** Inserts a copy of the given data at the given index, shifting whichever side of the ring buffer is shorter. */
+		Type& Insert(const size_t Index, const Type& Value) {
+			return Emplace(Index, Value);
+		}
+
+		/** Constructs a new element in place at the given index, shifting whichever side of the ring buffer is shorter. */
+		template<typename... ArgumentTypes>
+		Type& Emplace(const size_t Index, ArgumentTypes&&... Arguments) {
+			if (Index > size) {
+				throw std::runtime_error(
+					std::string("ERROR: Index ") +
+					std::to_string(Index) +
+					" is out of bounds of the ring buffer of size " +
+					std::to_string(size) + ".");
+			}
+			if (Index == 0) {
+				return EmplaceFront(std::forward<ArgumentTypes>(Arguments)...);
+			}
+			if (Index == size) {
+				return EmplaceBack(std::forward<ArgumentTypes>(Arguments)...);
+			}
+			Type Value(std::forward<ArgumentTypes>(Arguments)...);
+			Grow();
+			if (Index < size / 2) {
+				EmplaceFront(std::move(data[head]));
+				for (size_t Current = 1; Current < Index; ++Current) {
+					data[Physical(Current)] = std::move(data[Physical(Current + 1)]);
+				}
+			}
+			else {
+				EmplaceBack(std::move(data[Physical(size - 1)]));
+				for (size_t Current = size - 2; Current > Index; --Current) {
+					data[Physical(Current)] = std::move(data[Physical(Current - 1)]);
+				}
+			}
+			return data[Physical(Index)] = std::move(Value);
+		}
+
+		/** Removes the element at the given index, shifting whichever side of the ring buffer is shorter. */
+		void Erase(const size_t Index) {
+			Check(Index);
+			if (Index < size / 2) {
+				for (size_t Current = Index; Current > 0; --Current) {
+					data[Physical(Current)] = std::move(data[Physical(Current - 1)]);
+				}
+				PopFront();
+			}
+			else {
+				for (size_t Current = Index; Current < size - 1; ++Current) {
+					data[Physical(Current)] = std::move(data[Physical(Current + 1)]);
+				}
+				PopBack();
+			}
+		}
+
+		/** Removes the element at the front of the ring buffer. */
+		void PopFront() {
+			Check(0);
+			data[head].~Type();
+			head = (head + 1) & (capacity - 1);
+			--size;
+		}
+
+		/** Removes the element at the back of the ring buffer. */
+		void PopBack() {
+			Check(0);
+			data[Physical(size - 1)].~Type();
+			--size;
+		}
+
+		/** Moves up to the given number of elements from the front of the ring buffer into the given array and returns the number moved. */
+		size_t PopFrontInto(Type* Array, const size_t Count) {
+			const size_t Moved = Count < size ? Count : size;
+			for (size_t Index = 0; Index < Moved; ++Index) {
+				Array[Index] = std::move(data[head]);
+				data[head].~Type();
+				head = (head + 1) & (capacity - 1);
+			}
+			size -= Moved;
+			return Moved;
+		}
+
+		/** Moves up to the given number of elements from the back of the ring buffer into the given array and returns the number moved. */
+		size_t PopBackInto(Type* Array, const size_t Count) {
+			const size_t Moved = Count < size ? Count : size;
+			for (size_t Index = 0; Index < Moved; ++Index) {
+				Type& Element = data[Physical(size - Index - 1)];
+				Array[Index] = std::move(Element);
+				Element.~Type();
+			}
+			size -= Moved;
+			return Moved;
+		}
+
+
+		// TO STRING
+
+		/** Returns the ring buffer as a string. */
+		std::string ToString() const {
+			std::string String = "{ ";
+			for (size_t Index = 0; Index < size; ++Index) {
+				String += std::to_string(data[Physical(Index)]);
+				String += (Index != size - 1) ? ", " : " ";
+			}
+			return String += "}";
+		}
+	};
+}
@@ -0,0 +1,797 @@
+// .h
+// Binary Serialization Types
+// by Kyle Furey
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "Vector.h"
+#include "Set.h"
+#include "Map.h"
+#include "Graph.h"
+#include "Tree.h"
+#include "String.h"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The four bytes that begin every serialized snapshot ("TBOX" when read in little endian).
+#define SERIALIZATION_MAGIC 0x584F4254u
+
+// The current version of the binary format, which snapshots must match to be read.
+#define SERIALIZATION_VERSION 1u
+
+// The byte alignment of each bulk array in a snapshot, so arrays in a mapped file can be read in place.
+#define SERIALIZATION_ALIGNMENT 16
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// SECTION
+
+	/** The kind of collection a section of a snapshot stores, written before each collection so mismatched reads are caught. */
+	enum class Section : uint32_t {
+		VECTOR = 1,
+		SET = 2,
+		MAP = 3,
+		GRAPH = 4,
+		TREE = 5,
+		STRING = 6
+	};
+
+
+	// IS BITWISE
+
+	/** Whether the given type is copied to and from snapshots as its raw bytes (trivially copyable types that are not pointers). */
+	template<typename Type>
+	static constexpr bool IsBitwise = std::is_trivially_copyable_v<Type> && !std::is_pointer_v<Type> && !std::is_member_pointer_v<Type>;
+
+
+	// MAPPED FILE
+
+	/** A read-only view of a file's bytes mapped into memory, which stays valid until the mapped file is destroyed. */
+	class MappedFile final {
+
+		// DATA
+
+		/** The first byte of the mapped file, or nullptr if the file is empty. */
+		const unsigned char* data;
+
+		/** The number of bytes in the mapped file. */
+		size_t size;
+
+
+		// UNMAP
+
+		/** Unmaps the file. */
+		void Unmap() {
+			if (data != nullptr) {
+#if defined(_WIN32)
+				UnmapViewOfFile(data);
+#else
+				munmap(const_cast<unsigned char*>(data), size);
+#endif
+			}
+			data = nullptr;
+			size = 0;
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Path constructor, which maps the entire file at the given path or throws if it cannot be opened. */
+		explicit MappedFile(const char* Path) : data(nullptr), size(0) {
+#if defined(_WIN32)
+			HANDLE File = CreateFileA(Path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (File == INVALID_HANDLE_VALUE) {
+				throw std::runtime_error("ERROR: Could not open a file to map!");
+			}
+			LARGE_INTEGER Size;
+			if (!GetFileSizeEx(File, &Size)) {
+				CloseHandle(File);
+				throw std::runtime_error("ERROR: Could not read the size of a file to map!");
+			}
+			size = static_cast<size_t>(Size.QuadPart);
+			if (size > 0) {
+				HANDLE Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (Mapping != nullptr) {
+					data = static_cast<const unsigned char*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+					CloseHandle(Mapping);
+				}
+			}
+			CloseHandle(File);
+#else
+			const int File = open(Path, O_RDONLY);
+			if (File < 0) {
+				throw std::runtime_error("ERROR: Could not open a file to map!");
+			}
+			struct stat Status;
+			if (fstat(File, &Status) != 0) {
+				close(File);
+				throw std::runtime_error("ERROR: Could not read the size of a file to map!");
+			}
+			size = static_cast<size_t>(Status.st_size);
+			if (size > 0) {
+				void* Memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, File, 0);
+				data = Memory != MAP_FAILED ? static_cast<const unsigned char*>(Memory) : nullptr;
+			}
+			close(File);
+#endif
+			if (size > 0 && data == nullptr) {
+				size = 0;
+				throw std::runtime_error("ERROR: Could not map a file into memory!");
+			}
+		}
+
+		/** Delete copy constructor. */
+		MappedFile(const MappedFile& Copied) = delete;
+
+		/** Move constructor. */
+		MappedFile(MappedFile&& Moved) noexcept : data(Moved.data), size(Moved.size) {
+			Moved.data = nullptr;
+			Moved.size = 0;
+		}
+
+		/** Destructor. */
+		~MappedFile() {
+			Unmap();
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		MappedFile& operator=(const MappedFile& Copied) = delete;
+
+		/** Move assignment operator. */
+		MappedFile& operator=(MappedFile&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			Unmap();
+			data = Moved.data;
+			size = Moved.size;
+			Moved.data = nullptr;
+			Moved.size = 0;
+			return *this;
+		}
+
+
+		// GETTERS
+
+		/** Returns the first byte of the mapped file, or nullptr if the file is empty. */
+		const unsigned char* Data() const {
+			return data;
+		}
+
+		/** Returns the number of bytes in the mapped file. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns whether the mapped file is empty. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+	};
+
+
+	// ARRAY VIEW
+
+	/** A read-only view of a contiguous array that is owned elsewhere, such as a vector stored in a mapped file. */
+	template<typename Type>
+	class ArrayView final {
+
+		// DATA
+
+		/** The first element of the array. */
+		const Type* data;
+
+		/** The number of elements in the array. */
+		size_t size;
+
+	public:
+
+		// CONSTRUCTOR
+
+		/** Default constructor. */
+		ArrayView(const Type* Data = nullptr, const size_t Size = 0) : data(Data), size(Size) {
+		}
+
+
+		// OPERATORS
+
+		/** Returns a constant reference to the element at the given index. */
+		const Type& operator[](const size_t Index) const {
+			if (Index >= size) {
+				throw std::runtime_error("ERROR: Index " + std::to_string(Index) + " is out of bounds of the array view of size " + std::to_string(size) + ".");
+			}
+			return data[Index];
+		}
+
+
+		// ITERATORS
+
+		/** Returns a constant iterator to the first element in the view. */
+		const Type* begin() const {
+			return data;
+		}
+
+		/** Returns a constant iterator to the element after the last element in the view. */
+		const Type* end() const {
+			return data + size;
+		}
+
+
+		// GETTERS
+
+		/** Returns the first element of the view. */
+		const Type* Data() const {
+			return data;
+		}
+
+		/** Returns the number of elements in the view. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns whether the view is empty. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+		/** Returns a vector containing a copy of each element in the view. */
+		Vector<Type> ToVector() const {
+			return Vector<Type>(size, data);
+		}
+	};
+
+
+	// WRITER
+
+	/**
+	 * Streams a versioned binary snapshot of values to an output stream in the machine's native byte order.<br/>
+	 * Values are written with Serialize(), which can be overloaded for other types in their own namespace.
+	 */
+	class Writer final {
+
+		// DATA
+
+		/** The stream this writer writes to. */
+		std::ostream& stream;
+
+		/** The number of bytes written since the start of the snapshot. */
+		size_t offset;
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Stream constructor, which writes the snapshot's header. */
+		explicit Writer(std::ostream& Stream) : stream(Stream), offset(0) {
+			const uint32_t Header[2] = { SERIALIZATION_MAGIC, SERIALIZATION_VERSION };
+			Write(Header, sizeof(Header));
+		}
+
+		/** Delete copy constructor. */
+		Writer(const Writer& Copied) = delete;
+
+		/** Delete move constructor. */
+		Writer(Writer&& Moved) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		Writer& operator=(const Writer& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		Writer& operator=(Writer&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of bytes written since the start of the snapshot. */
+		size_t Offset() const {
+			return offset;
+		}
+
+
+		// WRITING
+
+		/** Writes the given number of bytes. */
+		void Write(const void* Data, const size_t Size) {
+			if (Size == 0) {
+				return;
+			}
+			stream.write(static_cast<const char*>(Data), static_cast<std::streamsize>(Size));
+			if (!stream) {
+				throw std::runtime_error("ERROR: Could not write to a snapshot's stream!");
+			}
+			offset += Size;
+		}
+
+		/** Writes the raw bytes of the given value. */
+		template<typename Type>
+		void Write(const Type& Value) {
+			static_assert(IsBitwise<Type>, "ERROR: Only trivially copyable values can be written as raw bytes!");
+			Write(&Value, sizeof(Type));
+		}
+
+		/** Writes zeroes until the snapshot's offset is a multiple of the given alignment. */
+		void Align(const size_t Alignment) {
+			static constexpr unsigned char Padding[SERIALIZATION_ALIGNMENT] = {};
+			size_t Remainder = offset % Alignment;
+			while (Remainder != 0) {
+				const size_t Count = Alignment - Remainder < sizeof(Padding) ? Alignment - Remainder : sizeof(Padding);
+				Write(Padding, Count);
+				Remainder = offset % Alignment;
+			}
+		}
+
+		/** Writes a section header with the given kind, element size, and number of elements. */
+		void Begin(const Section Kind, const uint32_t ElementSize, const uint64_t Count) {
+			Write(Kind);
+			Write(ElementSize);
+			Write(Count);
+		}
+	};
+
+
+	// READER
+
+	/**
+	 * Reads values from a binary snapshot stored in memory, such as a mapped file, without copying it.<br/>
+	 * Values are read with Deserialize(), which can be overloaded for other types in their own namespace.
+	 */
+	class Reader final {
+
+		// DATA
+
+		/** The first byte of the snapshot. */
+		const unsigned char* data;
+
+		/** The number of bytes in the snapshot. */
+		size_t size;
+
+		/** The number of bytes read since the start of the snapshot. */
+		size_t offset;
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Memory constructor, which reads and checks the snapshot's header. */
+		Reader(const void* Data, const size_t Size) : data(static_cast<const unsigned char*>(Data)), size(Size), offset(0) {
+			const uint32_t Magic = Read<uint32_t>();
+			if (Magic != SERIALIZATION_MAGIC) {
+				throw std::runtime_error("ERROR: A snapshot's header is invalid or was written in a different byte order!");
+			}
+			if (Read<uint32_t>() != SERIALIZATION_VERSION) {
+				throw std::runtime_error("ERROR: A snapshot was written with a different version of the format!");
+			}
+		}
+
+		/** Mapped file constructor, which reads and checks the snapshot's header. */
+		explicit Reader(const MappedFile& File) : Reader(File.Data(), File.Size()) {
+		}
+
+		/** Delete copy constructor. */
+		Reader(const Reader& Copied) = delete;
+
+		/** Delete move constructor. */
+		Reader(Reader&& Moved) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		Reader& operator=(const Reader& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		Reader& operator=(Reader&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of bytes read since the start of the snapshot. */
+		size_t Offset() const {
+			return offset;
+		}
+
+		/** Returns the number of bytes left to read. */
+		size_t Remaining() const {
+			return size - offset;
+		}
+
+
+		// READING
+
+		/** Returns a pointer to the given number of bytes in the snapshot and skips past them, or throws if the snapshot is too short. */
+		const unsigned char* Read(const size_t Size) {
+			if (Size > size - offset) {
+				throw std::runtime_error("ERROR: Reading past the end of a snapshot!");
+			}
+			const unsigned char* Bytes = data + offset;
+			offset += Size;
+			return Bytes;
+		}
+
+		/** Reads and returns a value from its raw bytes. */
+		template<typename Type>
+		Type Read() {
+			static_assert(IsBitwise<Type>, "ERROR: Only trivially copyable values can be read from raw bytes!");
+			Type Value;
+			std::memcpy(&Value, Read(sizeof(Type)), sizeof(Type));
+			return Value;
+		}
+
+		/** Skips bytes until the snapshot's offset is a multiple of the given alignment. */
+		void Align(const size_t Alignment) {
+			const size_t Remainder = offset % Alignment;
+			if (Remainder != 0) {
+				Read(Alignment - Remainder);
+			}
+		}
+
+		/** Reads a section header, throws if it is not the given kind or element size, and returns its number of elements. */
+		size_t Begin(const Section Kind, const uint32_t ElementSize) {
+			if (Read<Section>() != Kind) {
+				throw std::runtime_error("ERROR: A snapshot's section does not match the type being read!");
+			}
+			if (Read<uint32_t>() != ElementSize) {
+				throw std::runtime_error("ERROR: A snapshot's elements do not match the size of the type being read!");
+			}
+			const uint64_t Count = Read<uint64_t>();
+			if (Count > SIZE_MAX) {
+				throw std::runtime_error("ERROR: A snapshot's section is too large to read!");
+			}
+			return static_cast<size_t>(Count);
+		}
+
+		/** Throws if the given number of elements of at least the given number of bytes each cannot fit in the bytes left to read, so a corrupt count cannot reserve memory the snapshot could never fill. */
+		void Expect(const size_t Count, const size_t ElementSize) const {
+			if (Count > (size - offset) / ElementSize) {
+				throw std::runtime_error("ERROR: Reading past the end of a snapshot!");
+			}
+		}
+
+		/** Reads and returns a pointer to an aligned array of the given type in place, or throws if it is not aligned in memory. */
+		template<typename Type>
+		const Type* ReadArray(const size_t Count) {
+			Align(SERIALIZATION_ALIGNMENT);
+			if (Count > (size - offset) / sizeof(Type)) {
+				throw std::runtime_error("ERROR: Reading past the end of a snapshot!");
+			}
+			const unsigned char* Bytes = Read(Count * sizeof(Type));
+			if (reinterpret_cast<uintptr_t>(Bytes) % alignof(Type) != 0) {
+				throw std::runtime_error("ERROR: A snapshot's array is not aligned in memory for its type!");
+			}
+			return reinterpret_cast<const Type*>(Bytes);
+		}
+	};
+
+
+	// VALUES
+
+	/** Writes the raw bytes of the given trivially copyable value. */
+	template<typename Type>
+	static std::enable_if_t<IsBitwise<Type>> Serialize(Writer& Writer, const Type& Value) {
+		Writer.Write(Value);
+	}
+
+	/** Reads the raw bytes of the given trivially copyable value. */
+	template<typename Type>
+	static std::enable_if_t<IsBitwise<Type>> Deserialize(Reader& Reader, Type& Value) {
+		Value = Reader.Read<Type>();
+	}
+
+
+	// STRINGS
+
+	/** Writes the given string's characters. */
+	template<typename CharacterType>
+	static void Serialize(Writer& Writer, const BasicStringView<CharacterType>& Value) {
+		Writer.Begin(Section::STRING, sizeof(CharacterType), Value.Length());
+		Writer.Write(Value.Data(), Value.Length() * sizeof(CharacterType));
+	}
+
+	/** Writes the given string's characters. */
+	template<typename CharacterType>
+	static void Serialize(Writer& Writer, const BasicString<CharacterType>& Value) {
+		Serialize(Writer, Value.AsView());
+	}
+
+	/** Writes the given string's characters. */
+	template<typename CharacterType, typename TraitsType, typename AllocatorType>
+	static void Serialize(Writer& Writer, const std::basic_string<CharacterType, TraitsType, AllocatorType>& Value) {
+		Serialize(Writer, BasicStringView<CharacterType>(Value.data(), Value.size()));
+	}
+
+	/** Reads a view of a string's characters in place, which is only valid while the snapshot's memory is. */
+	template<typename CharacterType>
+	static void Deserialize(Reader& Reader, BasicStringView<CharacterType>& Value) {
+		const size_t Length = Reader.Begin(Section::STRING, sizeof(CharacterType));
+		if (Length > Reader.Remaining() / sizeof(CharacterType)) {
+			throw std::runtime_error("ERROR: Reading past the end of a snapshot!");
+		}
+		const unsigned char* Bytes = Reader.Read(Length * sizeof(CharacterType));
+		if (reinterpret_cast<uintptr_t>(Bytes) % alignof(CharacterType) != 0) {
+			throw std::runtime_error("ERROR: A snapshot's string is not aligned in memory for its characters!");
+		}
+		Value = BasicStringView<CharacterType>(reinterpret_cast<const CharacterType*>(Bytes), Length);
+	}
+
+	/** Reads a copy of a string's characters. */
+	template<typename CharacterType>
+	static void Deserialize(Reader& Reader, BasicString<CharacterType>& Value) {
+		BasicStringView<CharacterType> View;
+		Deserialize(Reader, View);
+		Value = BasicString<CharacterType>(View.Length(), View.Data());
+	}
+
+	/** Reads a copy of a string's characters. */
+	template<typename CharacterType, typename TraitsType, typename AllocatorType>
+	static void Deserialize(Reader& Reader, std::basic_string<CharacterType, TraitsType, AllocatorType>& Value) {
+		BasicStringView<CharacterType> View;
+		Deserialize(Reader, View);
+		Value.assign(View.Data(), View.Length());
+	}
+
+
+	// VECTOR
+
+	/** Writes each element of the given vector, as one aligned array if its elements are trivially copyable. */
+	template<typename Type, size_t INLINE_CAPACITY, typename AllocatorType>
+	static void Serialize(Writer& Writer, const Vector<Type, INLINE_CAPACITY, AllocatorType>& Value) {
+		if constexpr (IsBitwise<Type>) {
+			Writer.Begin(Section::VECTOR, sizeof(Type), Value.Size());
+			Writer.Align(SERIALIZATION_ALIGNMENT);
+			Writer.Write(Value.begin(), Value.Size() * sizeof(Type));
+		}
+		else {
+			Writer.Begin(Section::VECTOR, 0, Value.Size());
+			for (auto& Element : Value) {
+				Serialize(Writer, Element);
+			}
+		}
+	}
+
+	/** Reads a vector's elements into the given vector, replacing its elements. */
+	template<typename Type, size_t INLINE_CAPACITY, typename AllocatorType>
+	static void Deserialize(Reader& Reader, Vector<Type, INLINE_CAPACITY, AllocatorType>& Value) {
+		if constexpr (IsBitwise<Type>) {
+			const size_t Count = Reader.Begin(Section::VECTOR, sizeof(Type));
+			Value = Vector<Type, INLINE_CAPACITY, AllocatorType>(Count, Reader.ReadArray<Type>(Count), Value.GetAllocator());
+		}
+		else {
+			const size_t Count = Reader.Begin(Section::VECTOR, 0);
+			Reader.Expect(Count, 1);
+			Value.Clear();
+			Value.Reserve(Count);
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Deserialize(Reader, Value.EmplaceBack());
+			}
+		}
+	}
+
+	/** Reads a view of a vector of trivially copyable elements in place, which is only valid while the snapshot's memory is. */
+	template<typename Type>
+	static void Deserialize(Reader& Reader, ArrayView<Type>& Value) {
+		static_assert(IsBitwise<Type>, "ERROR: Only vectors of trivially copyable elements can be viewed in place!");
+		const size_t Count = Reader.Begin(Section::VECTOR, sizeof(Type));
+		Value = ArrayView<Type>(Reader.ReadArray<Type>(Count), Count);
+	}
+
+
+	// SET
+
+	/** Writes the bucket count and each element of the given set. */
+	template<typename Type, Hash(*HASH_FUNC)(const Type&), typename AllocatorType>
+	static void Serialize(Writer& Writer, const Set<Type, HASH_FUNC, AllocatorType>& Value) {
+		Writer.Begin(Section::SET, IsBitwise<Type> ? sizeof(Type) : 0, Value.Size());
+		Writer.Write(static_cast<uint64_t>(Value.AsVector().Size()));
+		for (auto& Bucket : Value.AsVector()) {
+			for (auto& Element : Bucket) {
+				Serialize(Writer, Element);
+			}
+		}
+	}
+
+	/** Reads a set's elements into the given set, replacing its elements. */
+	template<typename Type, Hash(*HASH_FUNC)(const Type&), typename AllocatorType>
+	static void Deserialize(Reader& Reader, Set<Type, HASH_FUNC, AllocatorType>& Value) {
+		const size_t Count = Reader.Begin(Section::SET, IsBitwise<Type> ? sizeof(Type) : 0);
+		const uint64_t BucketCount = Reader.Read<uint64_t>();
+		Reader.Expect(Count, 1);
+		Value.Clear();
+		Value.Rehash(BucketCount < Count + 8 ? static_cast<size_t>(BucketCount) : Count + 8);
+		for (size_t Index = 0; Index < Count; ++Index) {
+			Type Element = Type();
+			Deserialize(Reader, Element);
+			Value.Insert(Element);
+		}
+	}
+
+
+	// MAP
+
+	/** Writes the bucket count and each key and value of the given map. */
+	template<typename KeyType, typename ValueType, Hash(*HASH_FUNC)(const KeyType&), typename AllocatorType>
+	static void Serialize(Writer& Writer, const Map<KeyType, ValueType, HASH_FUNC, AllocatorType>& Value) {
+		Writer.Begin(Section::MAP, IsBitwise<KeyType> && IsBitwise<ValueType> ? sizeof(KeyType) + sizeof(ValueType) : 0, Value.Size());
+		Writer.Write(static_cast<uint64_t>(Value.AsVector().Size()));
+		for (auto& Bucket : Value.AsVector()) {
+			for (auto& Pair : Bucket) {
+				Serialize(Writer, Pair.key);
+				Serialize(Writer, Pair.value);
+			}
+		}
+	}
+
+	/** Reads a map's keys and values into the given map, replacing its pairs. */
+	template<typename KeyType, typename ValueType, Hash(*HASH_FUNC)(const KeyType&), typename AllocatorType>
+	static void Deserialize(Reader& Reader, Map<KeyType, ValueType, HASH_FUNC, AllocatorType>& Value) {
+		const size_t Count = Reader.Begin(Section::MAP, IsBitwise<KeyType> && IsBitwise<ValueType> ? sizeof(KeyType) + sizeof(ValueType) : 0);
+		const uint64_t BucketCount = Reader.Read<uint64_t>();
+		Reader.Expect(Count, 2);
+		Value.Clear();
+		Value.Rehash(BucketCount < Count + 8 ? static_cast<size_t>(BucketCount) : Count + 8);
+		for (size_t Index = 0; Index < Count; ++Index) {
+			KeyType Key = KeyType();
+			Deserialize(Reader, Key);
+			Deserialize(Reader, Value.Insert(Key, ValueType()));
+		}
+	}
+
+
+	// GRAPH
+
+	/** Writes each node of the given graph with its data, weight, and connections. */
+	template<typename Type, Heuristic(*HEURISTIC_FUNC)(const GraphNode<Type>&, const GraphNode<Type>&), typename AllocatorType>
+	static void Serialize(Writer& Writer, const Graph<Type, HEURISTIC_FUNC, AllocatorType>& Value) {
+		Writer.Begin(Section::GRAPH, IsBitwise<Type> ? sizeof(Type) : 0, Value.Size());
+		for (auto& Bucket : Value.AsMap().AsVector()) {
+			for (auto& Pair : Bucket) {
+				const GraphNode<Type>& Node = Pair.value;
+				Writer.Write(static_cast<uint64_t>(Node.Code()));
+				Writer.Write(static_cast<uint64_t>(Node.Weight));
+				Writer.Write(static_cast<uint8_t>(Node.Active));
+				Serialize(Writer, Node.Data);
+				Writer.Write(static_cast<uint64_t>(Node.TotalConnections()));
+				for (auto& Connections : Node.Connections().AsVector()) {
+					for (auto& Connection : Connections) {
+						Writer.Write(static_cast<uint64_t>(Connection.value.To()));
+						Writer.Write(static_cast<uint64_t>(Connection.value.Weight));
+						Writer.Write(static_cast<uint8_t>(Connection.value.Active));
+					}
+				}
+			}
+		}
+	}
+
+	/** Reads a graph's nodes and connections into the given graph, replacing its nodes but keeping each node's code. */
+	template<typename Type, Heuristic(*HEURISTIC_FUNC)(const GraphNode<Type>&, const GraphNode<Type>&), typename AllocatorType>
+	static void Deserialize(Reader& Reader, Graph<Type, HEURISTIC_FUNC, AllocatorType>& Value) {
+		const size_t Count = Reader.Begin(Section::GRAPH, IsBitwise<Type> ? sizeof(Type) : 0);
+		Reader.Expect(Count, sizeof(uint64_t) * 3 + sizeof(uint8_t));
+		Value.Clear();
+		Value.AsMap().Rehash(Count > 16 ? Count : 16);
+		for (size_t Index = 0; Index < Count; ++Index) {
+			const NodeCode Code = static_cast<NodeCode>(Reader.Read<uint64_t>());
+			const NodeWeight Weight = static_cast<NodeWeight>(Reader.Read<uint64_t>());
+			const bool Active = Reader.Read<uint8_t>() != 0;
+			GraphNode<Type>* Node = Value.Restore(Code, Type(), Weight, Active);
+			if (Node == nullptr) {
+				throw std::runtime_error("ERROR: A snapshot's graph has an invalid or repeated node code!");
+			}
+			Deserialize(Reader, Node->Data);
+			const uint64_t Connections = Reader.Read<uint64_t>();
+			Reader.Expect(Connections > SIZE_MAX ? SIZE_MAX : static_cast<size_t>(Connections), sizeof(uint64_t) * 2 + sizeof(uint8_t));
+			for (uint64_t Connection = 0; Connection < Connections; ++Connection) {
+				const NodeCode To = static_cast<NodeCode>(Reader.Read<uint64_t>());
+				const NodeWeight ConnectionWeight = static_cast<NodeWeight>(Reader.Read<uint64_t>());
+				const bool ConnectionActive = Reader.Read<uint8_t>() != 0;
+				Node->Connect(To, ConnectionWeight, ConnectionActive);
+			}
+		}
+	}
+
+
+	// TREE
+
+	/** Writes the bounds, looseness, and each pair's position and data of the given tree. */
+	template<typename Type, size_t DIMENSIONS, typename PrecisionType, typename AllocatorType>
+	static void Serialize(Writer& Writer, const Tree<Type, DIMENSIONS, PrecisionType, AllocatorType>& Value) {
+		const Vector<const typename Tree<Type, DIMENSIONS, PrecisionType, AllocatorType>::Pair*> Pairs = Value.Pairs();
+		Writer.Begin(Section::TREE, IsBitwise<Type> ? sizeof(Type) : 0, Pairs.Size());
+		Writer.Write(static_cast<uint32_t>(DIMENSIONS));
+		Writer.Write(static_cast<uint32_t>(sizeof(PrecisionType)));
+		for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+			Writer.Write(Value.Bounds().Origin[Component]);
+		}
+		Writer.Write(Value.Bounds().HalfSize);
+		Writer.Write(Value.Looseness());
+		for (auto& Pair : Pairs) {
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Writer.Write(Pair->Position()[Component]);
+			}
+			Serialize(Writer, Pair->Data);
+		}
+	}
+
+	/** Reads a tree's bounds and pairs into the given tree, replacing its pairs and bulk loading the new ones. */
+	template<typename Type, size_t DIMENSIONS, typename PrecisionType, typename AllocatorType>
+	static void Deserialize(Reader& Reader, Tree<Type, DIMENSIONS, PrecisionType, AllocatorType>& Value) {
+		using Tree = Toolbox::Tree<Type, DIMENSIONS, PrecisionType, AllocatorType>;
+		const size_t Count = Reader.Begin(Section::TREE, IsBitwise<Type> ? sizeof(Type) : 0);
+		if (Reader.Read<uint32_t>() != DIMENSIONS || Reader.Read<uint32_t>() != sizeof(PrecisionType)) {
+			throw std::runtime_error("ERROR: A snapshot's tree does not match the dimensions or precision of the tree being read!");
+		}
+		typename Tree::Box Bounds;
+		for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+			Bounds.Origin[Component] = Reader.Read<PrecisionType>();
+		}
+		Bounds.HalfSize = Reader.Read<PrecisionType>();
+		const PrecisionType Looseness = Reader.Read<PrecisionType>();
+		Reader.Expect(Count, sizeof(PrecisionType) * DIMENSIONS);
+		Vector<typename Tree::Pair> Pairs;
+		Pairs.Reserve(Count);
+		for (size_t Index = 0; Index < Count; ++Index) {
+			typename Tree::Point Position;
+			for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+				Position[Component] = Reader.Read<PrecisionType>();
+			}
+			Deserialize(Reader, Pairs.EmplaceBack(Type(), Position).Data);
+		}
+		Value = Tree(Bounds, Pairs, Looseness, Value.GetAllocator());
+	}
+
+
+	// FILES
+
+	/** Writes a snapshot of the given value to the file at the given path, replacing the file. */
+	template<typename Type>
+	static void Save(const char* Path, const Type& Value) {
+		std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+		if (!File) {
+			throw std::runtime_error("ERROR: Could not open a file to write a snapshot to!");
+		}
+		Writer Writer(File);
+		Serialize(Writer, Value);
+		File.flush();
+		if (!File) {
+			throw std::runtime_error("ERROR: Could not write a snapshot to a file!");
+		}
+	}
+
+	/**
+	 * Maps the file at the given path and reads a snapshot of the given value from it.<br/>
+	 * The file is unmapped when this returns, so views must instead be read from a mapped file that outlives them.
+	 */
+	template<typename Type>
+	static void Load(const char* Path, Type& Value) {
+		MappedFile File(Path);
+		Reader Reader(File);
+		Deserialize(Reader, Value);
+	}
+}
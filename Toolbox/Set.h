@@ -5,50 +5,287 @@
 #pragma once
 #include <functional>
 #include <cstdint>
+#include "Hash.h"
 #include "Vector.h"
-#include "List.h"
+#include "Pool.h"
+#include "Stats.h"
 
-// The maximum number of elements allowed in a bucket before rehashing.
-#define REHASH_MAX 3
+// The maximum average number of elements per bucket before a hash table doubles its buckets.
+#define REHASH_MAX_LOAD 1
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
 
-	// HASH FUNCTION
+	// HASH BUCKET
 
-	/** A unique value that represents the current state of an instance. */
-	using Hash = size_t;
-
-	/** Returns a unique unsigned number representing the state of the given value's binary. */
+	/**
+	 * A singly linked chain of elements with the same hash index.<br/>
+	 * A bucket does not own its nodes, which are allocated from the pool shared by every bucket of the table that owns it.
+	 */
 	template<typename Type>
-	static Hash Hashify(const Type& Value) {
-		return std::hash<Type>{}(Value);
-		/*
-		void* Memory = (void*)&Value;
-		switch (sizeof(Type)) {
-		case 1:
-			return (Hash)(*(uint8_t*)Memory);
-		case 2:
-		case 3:
-			return (Hash)(*(uint16_t*)Memory);
-		case 4:
-		case 5:
-		case 6:
-		case 7:
-			return (Hash)(*(uint32_t*)Memory);
-		default:
-			return (Hash)(*(uint64_t*)Memory);
-		}
-		*/
-	}
+	class HashBucket final {
+	public:
+
+		// NODE
+
+		/** An individual singly linked node in a bucket that stores its element inline. */
+		struct Node final {
+
+			// DATA
+
+			/** A pointer to the next node. */
+			Node* next;
+
+			/** The underlying data of this node. */
+			Type data;
+
+
+			// CONSTRUCTOR
+
+			/** Constructs this node's element in place with the given arguments. */
+			template<typename... ArgumentTypes>
+			Node(Node* Next, ArgumentTypes&&... Arguments) : next(Next), data(std::forward<ArgumentTypes>(Arguments)...) {
+			}
+		};
+
+
+		// ITERATOR
+
+		/** A forward iterator that traverses the nodes of a bucket. */
+		template<typename NodeType, typename ElementType>
+		struct NodeIterator final {
+		private:
+
+			// DATA
+
+			/** A pointer to the current node, or nullptr if this iterator is past the end of its bucket. */
+			NodeType* node;
+
+		public:
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			NodeIterator(NodeType* Current = nullptr) : node(Current) {
+			}
+
+
+			// OPERATORS
+
+			/** Returns a reference to the underlying element of this iterator. */
+			ElementType& operator*() const {
+				return node->data;
+			}
+
+			/** Returns a dereferenced pointer to the underlying element of this iterator. */
+			ElementType* operator->() const {
+				return node != nullptr ? &node->data : nullptr;
+			}
+
+			/** Increments this iterator to the next element. */
+			NodeIterator& operator++() {
+				node = node->next;
+				return *this;
+			}
+
+			/** Increments this iterator to the next element and returns a copy of the previous iterator. */
+			NodeIterator operator++(int) {
+				NodeIterator Copy = *this;
+				node = node->next;
+				return Copy;
+			}
+
+			/** Returns whether the given iterators are equal. */
+			bool operator==(const NodeIterator& Other) const {
+				return node == Other.node;
+			}
+
+			/** Returns whether the given iterators are not equal. */
+			bool operator!=(const NodeIterator& Other) const {
+				return node != Other.node;
+			}
+		};
+
+		/** A forward iterator that traverses the elements of a bucket. */
+		using Iterator = NodeIterator<Node, Type>;
+
+		/** A forward iterator that traverses the constant elements of a bucket. */
+		using ConstantIterator = NodeIterator<const Node, const Type>;
+
+	private:
+
+		// DATA
+
+		/** A pointer to the first node of the bucket. */
+		Node* head;
+
+		/** The current number of nodes in the bucket. */
+		size_t size;
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		HashBucket() : head(nullptr), size(0) {
+		}
+
+		/** Delete copy constructor (a bucket's nodes are copied through its container's pool with Assign()). */
+		HashBucket(const HashBucket&) = delete;
+
+		/** Move constructor. */
+		HashBucket(HashBucket&& Moved) noexcept : head(Moved.head), size(Moved.size) {
+			Moved.head = nullptr;
+			Moved.size = 0;
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator (a bucket's nodes are copied through its container's pool with Assign()). */
+		HashBucket& operator=(const HashBucket&) = delete;
+
+		/** Move assignment operator, which takes the other bucket's nodes. This bucket's nodes must already be returned to their pool. */
+		HashBucket& operator=(HashBucket&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			head = Moved.head;
+			size = Moved.size;
+			Moved.head = nullptr;
+			Moved.size = 0;
+			return *this;
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of elements in the bucket. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns whether the bucket is empty. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+		/** Returns a reference to the most recently linked element of the bucket. */
+		Type& Front() {
+			return head->data;
+		}
+
+		/** Returns a constant reference to the most recently linked element of the bucket. */
+		const Type& Front() const {
+			return head->data;
+		}
+
+
+		// NODES
+
+		/** Links the given node to the front of the bucket. */
+		void Link(Node* Linked) {
+			Linked->next = head;
+			head = Linked;
+			++size;
+		}
+
+		/** Unlinks and returns the front node of the bucket without returning it to its pool, or nullptr if the bucket is empty. */
+		Node* Unlink() {
+			Node* Unlinked = head;
+			if (Unlinked != nullptr) {
+				head = Unlinked->next;
+				--size;
+			}
+			return Unlinked;
+		}
+
+		/** Constructs a new element at the front of the bucket in a node from the given pool and returns a reference to it. */
+		template<typename PoolType, typename... ArgumentTypes>
+		Type& Emplace(PoolType& Pool, ArgumentTypes&&... Arguments) {
+			Link(Pool.New(head, std::forward<ArgumentTypes>(Arguments)...));
+			return head->data;
+		}
+
+		/** Copies each element of the given bucket into new nodes from the given pool, keeping their order. This bucket must be empty. */
+		template<typename PoolType>
+		void Assign(PoolType& Pool, const HashBucket& Copied) {
+			Node** Next = &head;
+			for (Node* Current = Copied.head; Current != nullptr; Current = Current->next) {
+				*Next = Pool.New(nullptr, Current->data);
+				Next = &(*Next)->next;
+				++size;
+			}
+		}
+
+		/** Erases the first element the given predicate accepts, returning its node to the given pool, and returns whether an element was erased. */
+		template<typename PoolType, typename PredicateType>
+		bool EraseFirst(PoolType& Pool, PredicateType&& Predicate) {
+			for (Node** Current = &head; *Current != nullptr; Current = &(*Current)->next) {
+				if (Predicate((*Current)->data)) {
+					Node* Erased = *Current;
+					*Current = Erased->next;
+					Pool.Delete(Erased);
+					--size;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Returns each of the bucket's nodes to the given pool. */
+		template<typename PoolType>
+		void Clear(PoolType& Pool) {
+			while (head != nullptr) {
+				Node* Next = head->next;
+				Pool.Delete(head);
+				head = Next;
+			}
+			size = 0;
+		}
+
+
+		// ITERATORS
+
+		/** Returns an iterator at the beginning of the bucket. */
+		Iterator begin() {
+			return Iterator(head);
+		}
+
+		/** Returns a constant iterator at the beginning of the bucket. */
+		ConstantIterator begin() const {
+			return ConstantIterator(head);
+		}
+
+		/** Returns an iterator past the end of the bucket. */
+		Iterator end() {
+			return Iterator();
+		}
+
+		/** Returns a constant iterator past the end of the bucket. */
+		ConstantIterator end() const {
+			return ConstantIterator();
+		}
+	};
 
 
 	// HASH SET
 
-	/** A collection of values that allow fast lookups via hashing. */
-	template<typename Type, Hash(*HASH_FUNC)(const Type&) = Hashify>
+	/** A collection of values that allow fast lookups via hashing, whose buckets and values are allocated with the given allocator. Every bucket's values are pooled in shared slabs. */
+	template<typename Type, Hash(*HASH_FUNC)(const Type&) = Hashify, typename AllocatorType = HeapAllocator>
 	class Set final {
 		static_assert(HASH_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
+	public:
+
+		// STORAGE
+
+		/** A bucket of values with the same hash index. */
+		using Bucket = HashBucket<Type>;
+
+		/** The array of buckets a set stores its values in. */
+		using Storage = Vector<Bucket, 0, AllocatorType>;
+
+	private:
 
 		// DATA
 
@@ -56,45 +293,82 @@ namespace Toolbox {
 		size_t size;
 
 		/** The underlying array of buckets containing each of the set's values. */
-		Vector<List<Type>> buckets;
+		Storage buckets;
+
+		/** The pool each of the set's values are allocated from. */
+		Pool<typename Bucket::Node, AllocatorType> pool;
+
+
+		// COPYING
+
+		/** Copies each of the given set's values into this set's buckets, which must be empty and match the given set's bucket count. */
+		void CopyFrom(const Set& Copied) {
+			for (size_t Index = 0; Index < buckets.Size(); ++Index) {
+				buckets[Index].Assign(pool, Copied.buckets[Index]);
+			}
+			size = Copied.size;
+		}
+
+		/** Returns the given number of empty buckets in memory from the given allocator. */
+		static Storage EmptyBuckets(const size_t Count, const AllocatorType& Allocator) {
+			Storage Buckets(Allocator);
+			Buckets.Reserve(Count);
+			for (size_t Index = 0; Index < Count; ++Index) {
+				Buckets.EmplaceBack();
+			}
+			return Buckets;
+		}
 
 	public:
 
-		// CONSTRUCTORS
+		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		Set(const size_t BucketCount = 8) : size(0), buckets(BucketCount == 0 ? 1 : BucketCount) {
+		Set(const size_t BucketCount = 8, const AllocatorType& Allocator = AllocatorType()) : size(0), buckets(EmptyBuckets(BucketCount == 0 ? 1 : BucketCount, Allocator)), pool(Allocator) {
+		}
+
+		/** Allocator constructor. */
+		explicit Set(const AllocatorType& Allocator) : size(0), buckets(EmptyBuckets(8, Allocator)), pool(Allocator) {
 		}
 
 		/** Copy constructor. */
-		Set(const Set<Type, HASH_FUNC>& Copied) : size(Copied.size), buckets(Copied.buckets) {
+		Set(const Set& Copied) : size(0), buckets(EmptyBuckets(Copied.buckets.Size(), Copied.GetAllocator())), pool(Copied.GetAllocator()) {
+			CopyFrom(Copied);
 		}
 
 		/** Move constructor. */
-		Set(Set<Type, HASH_FUNC>&& Moved) noexcept : size(Moved.size), buckets(std::move(Moved.buckets)) {
+		Set(Set&& Moved) noexcept : size(Moved.size), buckets(std::move(Moved.buckets)), pool(std::move(Moved.pool)) {
 			Moved.size = 0;
 		}
 
+		/** Destructor. */
+		~Set() {
+			Clear();
+		}
+
 
 		// OPERATORS
 
 		/** Copy assignment operator. */
-		Set<Type, HASH_FUNC>& operator=(const Set<Type, HASH_FUNC>& Copied) {
+		Set& operator=(const Set& Copied) {
 			if (this == &Copied) {
 				return *this;
 			}
-			size = Copied.size;
-			buckets = Copied.buckets;
+			Clear();
+			buckets = EmptyBuckets(Copied.buckets.Size(), buckets.GetAllocator());
+			CopyFrom(Copied);
 			return *this;
 		}
 
-		/** Move assignment operator. */
-		Set<Type, HASH_FUNC>& operator=(Set<Type, HASH_FUNC>&& Moved) noexcept {
+		/** Move assignment operator, which takes the other set's allocator along with its values. */
+		Set& operator=(Set&& Moved) noexcept {
 			if (this == &Moved) {
 				return *this;
 			}
+			Clear();
 			size = Moved.size;
 			buckets = std::move(Moved.buckets);
+			pool = std::move(Moved.pool);
 			Moved.size = 0;
 			return *this;
 		}
@@ -117,6 +391,15 @@ namespace Toolbox {
 			return buckets.Size();
 		}
 
+		/** Returns a snapshot of how the set's values are spread across its buckets, such as its bucket length histogram and average probe length. */
+		TableStats Statistics() const {
+			TableStats Statistics;
+			for (auto& Bucket : buckets) {
+				Statistics.Add(Bucket.Size());
+			}
+			return Statistics;
+		}
+
 		/** Returns this set's hash function. */
 		Hash(*HashFunction() const)(const Type&) {
 			return HASH_FUNC;
@@ -124,12 +407,21 @@ namespace Toolbox {
 
 		/** Returns whether the given value is present in the set. */
 		bool Contains(const Type& Value) const {
-			size_t Index = HASH_FUNC(Value) % buckets.Size();
+			return Contains(Value, HASH_FUNC(Value));
+		}
+
+		/** Returns whether the given value is present in the set, using the given precomputed hash of the value. */
+		bool Contains(const Type& Value, const Hash Hash) const {
+			size_t Index = Hash % buckets.Size();
+			size_t Probes = 0;
 			for (auto& Element : buckets[Index]) {
+				++Probes;
 				if (Element == Value) {
+					TOOLBOX_COUNT_LOOKUP(Set, Probes);
 					return true;
 				}
 			}
+			TOOLBOX_COUNT_LOOKUP(Set, Probes);
 			return false;
 		}
 
@@ -138,6 +430,11 @@ namespace Toolbox {
 			return size == 0;
 		}
 
+		/** Returns the allocator the set's buckets and values are allocated with. */
+		const AllocatorType& GetAllocator() const {
+			return buckets.GetAllocator();
+		}
+
 		/** Returns a copy of each of the values in the set in a vector. */
 		Vector<Type> Values() const {
 			Vector<Type> Values(size);
@@ -157,25 +454,33 @@ namespace Toolbox {
 		/** Deallocates the set. */
 		void Clear() {
 			for (auto& Bucket : buckets) {
-				Bucket.Clear();
+				Bucket.Clear(pool);
 			}
+			pool.Reset();
 			size = 0;
 		}
 
 		/** Inserts a copy of the given value into the set and returns whether a new element was successfully inserted. */
 		bool Insert(const Type& Value) {
-			size_t Index = HASH_FUNC(Value) % buckets.Size();
-			size_t ElementIndex = 0;
+			return Insert(Value, HASH_FUNC(Value));
+		}
+
+		/** Inserts a copy of the given value into the set using the given precomputed hash of the value, and returns whether a new element was successfully inserted. */
+		bool Insert(const Type& Value, const Hash Hash) {
+			size_t Index = Hash % buckets.Size();
+			size_t Probes = 0;
 			for (auto& Element : buckets[Index]) {
+				++Probes;
 				if (Element == Value) {
-					buckets[Index][ElementIndex] = Value;
+					TOOLBOX_COUNT_LOOKUP(Set, Probes);
+					Element = Value;
 					return false;
 				}
-				++ElementIndex;
 			}
-			buckets[Index].PushBack(Value);
+			TOOLBOX_COUNT_LOOKUP(Set, Probes);
+			buckets[Index].Emplace(pool, Value);
 			++size;
-			if (buckets[Index].Size() > REHASH_MAX) {
+			if (size > buckets.Size() * REHASH_MAX_LOAD) {
 				Rehash(buckets.Size() * 2);
 			}
 			return true;
@@ -183,34 +488,35 @@ namespace Toolbox {
 
 		/** Erases any matching value found in the set and returns whether the value was found and successfully erased. */
 		bool Erase(const Type& Value) {
-			size_t Index = HASH_FUNC(Value) % buckets.Size();
-			size_t ElementIndex = 0;
-			for (auto& Element : buckets[Index]) {
-				if (Element == Value) {
-					buckets[Index].Erase(ElementIndex);
-					--size;
-					return true;
-				}
-				++ElementIndex;
+			return Erase(Value, HASH_FUNC(Value));
+		}
+
+		/** Erases any matching value found in the set using the given precomputed hash of the value, and returns whether a value was found and successfully erased. */
+		bool Erase(const Type& Value, const Hash Hash) {
+			if (buckets[Hash % buckets.Size()].EraseFirst(pool, [&Value](const Type& Element) { return Element == Value; })) {
+				--size;
+				return true;
 			}
 			return false;
 		}
 
 		/**
 		 * Resizes the set's number of buckets to the given number.<br/>
-		 * All values are copied into the new buckets based on their hash value.
+		 * All values are relinked into the new buckets based on their hash value, so no value is copied or reallocated.
 		 */
 		void Rehash(const size_t BucketCount) {
 			if (BucketCount == 0 || BucketCount == buckets.Size()) {
 				return;
 			}
-			Vector<List<Type>> Buckets(BucketCount);
+			TOOLBOX_COUNT(Set, Rehashes, 1);
+			Storage Buckets = EmptyBuckets(BucketCount, buckets.GetAllocator());
 			for (auto& Bucket : buckets) {
-				for (auto& Element : Bucket) {
-					Buckets[HASH_FUNC(Element) % Buckets.Size()].PushBack(Element);
+				while (!Bucket.IsEmpty()) {
+					auto* Node = Bucket.Unlink();
+					Buckets[HASH_FUNC(Node->data) % Buckets.Size()].Link(Node);
 				}
 			}
-			buckets = Buckets;
+			buckets = std::move(Buckets);
 		}
 
 
@@ -260,12 +566,12 @@ namespace Toolbox {
 		// AS VECTOR
 
 		/** Returns a reference to this set's underlying vector. */
-		Vector<List<Type>>& AsVector() {
+		Storage& AsVector() {
 			return buckets;
 		}
 
 		/** Returns a constant reference to this set's underlying vector. */
-		const Vector<List<Type>>& AsVector() const {
+		const Storage& AsVector() const {
 			return buckets;
 		}
 	};
@@ -3,6 +3,10 @@
 // by Kyle Furey
 
 #pragma once
+#include <new>
+#include <atomic>
+#include <utility>
+#include <type_traits>
 #include "Unique.h"
 
 /** A collection of useful template types in C++. */
@@ -11,52 +15,259 @@ namespace Toolbox {
 	// WEAK POINTER
 
 	/** A wrapper for a pointer that can read from other smart pointers' memory without owning it. */
-	template<typename Type, void(*DELETE_FUNC)(Type*)>
+	template<typename Type, void(*DELETE_FUNC)(Type*), bool THREAD_SAFE>
 	class Weak;
 
 
+	// SHARED BLOCK
+
+	/**
+	 * The reference counts shared by every shared and weak pointer to the same memory, regardless of the memory's type.<br/>
+	 * Thread safe blocks use atomic counts so their pointers may be copied and destroyed on different threads.
+	 */
+	template<bool THREAD_SAFE>
+	class SharedBlock {
+
+		// COUNT
+
+		/** The type used to store each reference count. */
+		using Count = std::conditional_t<THREAD_SAFE, std::atomic<size_t>, size_t>;
+
+
+		// DATA
+
+		/** The current total number of shared pointers pointing to this block. */
+		Count shared;
+
+		/** The current total number of weak pointers pointing to this block, plus one while any shared pointers remain. */
+		Count weak;
+
+	protected:
+
+		// CONSTRUCTOR AND DESTRUCTOR
+
+		/** Default constructor. */
+		SharedBlock() : shared(0), weak(0) {
+		}
+
+		/** Destructor. */
+		virtual ~SharedBlock() = default;
+
+
+		// MEMORY MANAGEMENT
+
+		/** Frees the memory this block manages once no shared pointers remain. */
+		virtual void Dispose() = 0;
+
+	public:
+
+		// MEMORY
+
+		/** Returns whether the memory this block manages has not been deleted or released, so pointers aliasing into it are still valid. */
+		virtual bool IsAlive() const = 0;
+
+
+		// CONSTRUCTORS
+
+		/** Delete copy constructor. */
+		SharedBlock(const SharedBlock&) = delete;
+
+		/** Delete move constructor. */
+		SharedBlock(SharedBlock&&) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		SharedBlock& operator=(const SharedBlock&) = delete;
+
+		/** Delete move assignment operator. */
+		SharedBlock& operator=(SharedBlock&&) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the total number of shared pointers pointing to this block. */
+		size_t SharedCount() const {
+			if constexpr (THREAD_SAFE) {
+				return shared.load(std::memory_order_acquire);
+			}
+			else {
+				return shared;
+			}
+		}
+
+		/** Returns the total number of weak pointers pointing to this block. */
+		size_t WeakCount() const {
+			const size_t Strong = SharedCount();
+			size_t Weak = 0;
+			if constexpr (THREAD_SAFE) {
+				Weak = weak.load(std::memory_order_acquire);
+			}
+			else {
+				Weak = weak;
+			}
+			return Strong > 0 && Weak > 0 ? Weak - 1 : Weak;
+		}
+
+
+		// MEMORY MANAGEMENT
+
+		/** Increments the total number of shared pointers. */
+		void IncrementShared() {
+			if constexpr (THREAD_SAFE) {
+				if (shared.fetch_add(1, std::memory_order_relaxed) == 0) {
+					weak.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			else {
+				if (shared++ == 0) {
+					++weak;
+				}
+			}
+		}
+
+		/** Increments the total number of shared pointers only if any remain, and returns whether it did. */
+		bool TryIncrementShared() {
+			if constexpr (THREAD_SAFE) {
+				size_t Strong = shared.load(std::memory_order_relaxed);
+				while (Strong != 0) {
+					if (shared.compare_exchange_weak(Strong, Strong + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+						return true;
+					}
+				}
+				return false;
+			}
+			else {
+				if (shared == 0) {
+					return false;
+				}
+				++shared;
+				return true;
+			}
+		}
+
+		/** Decrements the total number of shared pointers, freeing the memory if 0 remain. */
+		void DecrementShared() {
+			if constexpr (THREAD_SAFE) {
+				if (shared.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					Dispose();
+					DecrementWeak();
+				}
+			}
+			else {
+				if (shared > 0) {
+					--shared;
+					if (shared == 0) {
+						Dispose();
+						DecrementWeak();
+					}
+				}
+			}
+		}
+
+		/** Increments the total number of weak pointers. */
+		void IncrementWeak() {
+			if constexpr (THREAD_SAFE) {
+				weak.fetch_add(1, std::memory_order_relaxed);
+			}
+			else {
+				++weak;
+			}
+		}
+
+		/** Decrements the total number of weak pointers, freeing this block if no shared or weak pointers remain. */
+		void DecrementWeak() {
+			if constexpr (THREAD_SAFE) {
+				if (weak.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					delete this;
+				}
+			}
+			else {
+				if (weak > 0) {
+					--weak;
+					if (weak == 0) {
+						delete this;
+					}
+				}
+			}
+		}
+	};
+
+
 	// SHARED POINTER
 
-	/** A wrapper for a pointer that automatically manages its memory and tracks new references to it. */
-	template<typename Type, void(*DELETE_FUNC)(Type*) = Delete>
+	/**
+	 * A wrapper for a pointer that automatically manages its memory and tracks new references to it.<br/>
+	 * Thread safe shared pointers count references atomically, but the memory itself is not synchronized.
+	 */
+	template<typename Type, void(*DELETE_FUNC)(Type*) = Delete, bool THREAD_SAFE = false>
 	class Shared final {
 		static_assert(DELETE_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
 
 		// FRIENDS
 
-		friend class Weak<Type, DELETE_FUNC>;
+		friend class Weak<Type, DELETE_FUNC, THREAD_SAFE>;
+
+		template<typename OtherType, void(*OTHER_DELETE_FUNC)(OtherType*), bool OTHER_THREAD_SAFE>
+		friend class Shared;
 
 	public:
 
 		// WEAK POINTER
 
 		/** A wrapper for a pointer that can read from other smart pointers' memory without owning it. */
-		using Weak = Weak<Type, DELETE_FUNC>;
+		using Weak = Toolbox::Weak<Type, DELETE_FUNC, THREAD_SAFE>;
+
+
+		// BLOCK
+
+		/** The reference counts shared by every shared and weak pointer to the same memory. */
+		using Block = SharedBlock<THREAD_SAFE>;
 
 
 		// NODE
 
 		/** A shared region of memory that tracks references to it. */
-		struct Node final {
-		private:
+		struct Node : public Block {
+		protected:
 
 			// DATA
 
 			/** The underlying pointer this node manages. */
 			Type* data;
 
-			/** The current total number of shared pointers pointing to this node. */
-			size_t shared;
+			/** The memory this node constructed its data in, or null if its data was allocated separately. */
+			Type* storage;
+
+
+			// MEMORY MANAGEMENT
+
+			/** Frees the given pointer, destroying it in place if it was constructed in this node. */
+			void Free(Type* Data) {
+				if (Data == nullptr) {
+					return;
+				}
+				if (Data == storage) {
+					Data->~Type();
+				}
+				else {
+					DELETE_FUNC(Data);
+				}
+			}
 
-			/** The current total number of weak pointers pointing to this node. */
-			size_t weak;
+			/** Frees this node's memory once no shared pointers remain. */
+			void Dispose() override {
+				Free(data);
+				data = nullptr;
+			}
 
 		public:
 
 			// CONSTRUCTOR
 
 			/** Default constructor. */
-			Node(Type* Data = nullptr) : data(Data), shared(0), weak(0) {
+			Node(Type* Data = nullptr) : Block(), data(Data), storage(nullptr) {
 			}
 
 
@@ -72,18 +283,18 @@ namespace Toolbox {
 				return data;
 			}
 
-			/** Returns the total number of shared pointers pointing to this node. */
-			size_t SharedCount() const {
-				return shared;
+			/** Returns whether this node's memory is still valid has not been freed yet. */
+			bool IsValid() const {
+				return data != nullptr;
 			}
 
-			/** Returns the total number of weak pointers pointing to this node. */
-			size_t WeakCount() const {
-				return weak;
+			/** Returns whether this node's memory was constructed in the same allocation as this node. */
+			bool IsInline() const {
+				return data != nullptr && data == storage;
 			}
 
-			/** Returns whether this node's memory is still valid has not been freed yet. */
-			bool IsValid() const {
+			/** Returns whether this node's memory has not been deleted or released. */
+			bool IsAlive() const override {
 				return data != nullptr;
 			}
 
@@ -93,7 +304,7 @@ namespace Toolbox {
 			/** Deletes this node's memory. */
 			bool Delete() {
 				if (data != nullptr) {
-					DELETE_FUNC(data);
+					Free(data);
 					data = nullptr;
 					return true;
 				}
@@ -103,7 +314,7 @@ namespace Toolbox {
 			/** Safely replaces this node's memory with the given pointer. */
 			void Replace(Type* Data) {
 				if (data != Data) {
-					DELETE_FUNC(data);
+					Free(data);
 					data = Data;
 				}
 			}
@@ -113,46 +324,36 @@ namespace Toolbox {
 			 * NOTE: The pointer must still be deleted!
 			 */
 			Type* Release() {
+				if (IsInline()) {
+					throw std::runtime_error("ERROR: Cannot release memory that was constructed with its shared pointer!");
+				}
 				Type* Data = data;
 				data = nullptr;
 				return Data;
 			}
+		};
 
 
-			// MEMORY MANAGEMENT
+		// INLINE NODE
 
-			/** Increments the total number of shared pointers. */
-			void IncrementShared() {
-				++shared;
-			}
+		/** A shared region of memory that constructs its data in the same allocation as its reference counts. */
+		struct InlineNode final : public Node {
+		private:
 
-			/** Decrements the total number of shared pointers, freeing the memory if 0 remain. */
-			void DecrementShared() {
-				if (shared > 0) {
-					--shared;
-					if (shared == 0) {
-						DELETE_FUNC(data);
-						data = nullptr;
-						if (weak == 0) {
-							delete this;
-						}
-					}
-				}
-			}
+			// DATA
 
-			/** Increments the total number of weak pointers. */
-			void IncrementWeak() {
-				++weak;
-			}
+			/** The uninitialized memory of this node's data. */
+			alignas(Type) unsigned char memory[sizeof(Type)];
 
-			/** Decrements the total number of weak pointers, freeing the memory if 0 remain. */
-			void DecrementWeak() {
-				if (weak > 0) {
-					--weak;
-					if (shared == 0 && weak == 0) {
-						delete this;
-					}
-				}
+		public:
+
+			// CONSTRUCTOR
+
+			/** Constructs this node's data in place with the given arguments. */
+			template<typename... ArgumentTypes>
+			explicit InlineNode(ArgumentTypes&&... Arguments) : Node() {
+				this->storage = new(memory) Type(std::forward<ArgumentTypes>(Arguments)...);
+				this->data = this->storage;
 			}
 		};
 
@@ -160,55 +361,135 @@ namespace Toolbox {
 
 		// DATA
 
-		/** The underlying pointer to the memory node this shared pointer manages. */
-		Node* node;
+		/** The underlying pointer to the reference counts this shared pointer shares. */
+		Block* block;
+
+		/** The pointer this shared pointer reads instead of its node's memory, or null if this shared pointer is not aliased. */
+		Type* alias;
+
+
+		// HELPERS
+
+		/** Returns the node this shared pointer manages (only valid if this shared pointer is not aliased). */
+		Node* Owner() const {
+			return static_cast<Node*>(block);
+		}
+
+		/** Returns the pointer this shared pointer points to, or null if it is aliased and its owner's memory was deleted or released. */
+		Type* Pointer() const {
+			if (block == nullptr) {
+				return nullptr;
+			}
+			if (alias != nullptr) {
+				return block->IsAlive() ? alias : nullptr;
+			}
+			return Owner()->Data();
+		}
+
+		/** Shares the given reference counts and pointer, releasing this shared pointer's previous reference. */
+		void Share(Block* Block, Type* Alias) {
+			if (block == Block && alias == Alias) {
+				return;
+			}
+			if (Block != nullptr) {
+				Block->IncrementShared();
+			}
+			if (block != nullptr) {
+				block->DecrementShared();
+			}
+			block = Block;
+			alias = Alias;
+		}
+
+		/** Returns a new weak pointer to this shared pointer's memory. */
+		Weak Observe() const {
+			Weak Result;
+			Result.Share(block, alias);
+			return Result;
+		}
+
+		/** Throws if this shared pointer is aliased and therefore cannot manage its node's memory. */
+		void CheckOwner() const {
+			if (alias != nullptr) {
+				throw std::runtime_error("ERROR: Cannot manage the memory of an aliased shared pointer!");
+			}
+		}
 
 	public:
 
 		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		Shared() : node(nullptr) {
+		Shared() : block(nullptr), alias(nullptr) {
 		}
 
 		/** Pointer constructor. */
-		Shared(Type* Data) : node() {
+		Shared(Type* Data) : block(nullptr), alias(nullptr) {
 			if (Data != nullptr) {
-				node = new Node(Data);
-				node->IncrementShared();
+				block = new Node(Data);
+				block->IncrementShared();
 			}
 		}
 
-		/** Weak pointer constructor. */
-		Shared(Weak& Data) : node(Data.node) {
-			if (node != nullptr) {
-				node->IncrementShared();
+		/** Weak pointer constructor, which is null if the weak pointer's memory has already been freed. */
+		Shared(const Weak& Data) : block(nullptr), alias(nullptr) {
+			if (Data.block != nullptr && Data.block->TryIncrementShared()) {
+				block = Data.block;
+				alias = Data.alias;
 			}
 		}
 
 		/** Node constructor. */
-		Shared(Node* Node) : node(Node) {
-			if (node != nullptr) {
-				node->IncrementShared();
+		Shared(Node* Node) : block(Node), alias(nullptr) {
+			if (block != nullptr) {
+				block->IncrementShared();
 			}
 		}
 
 		/** Copy constructor. */
-		Shared(const Shared& Copied) : node(Copied.node) {
-			if (node != nullptr) {
-				node->IncrementShared();
+		Shared(const Shared& Copied) : block(Copied.block), alias(Copied.alias) {
+			if (block != nullptr) {
+				block->IncrementShared();
 			}
 		}
 
 		/** Move constructor. */
-		Shared(Shared&& Moved) noexcept : node(Moved.node) {
-			Moved.node = nullptr;
+		Shared(Shared&& Moved) noexcept : block(Moved.block), alias(Moved.alias) {
+			Moved.block = nullptr;
+			Moved.alias = nullptr;
+		}
+
+		/**
+		 * Aliasing constructor, which shares ownership of the given shared pointer's memory while pointing to the given pointer (usually a member of that memory).<br/>
+		 * The new shared pointer is null if either the given shared pointer or the given pointer is null.
+		 */
+		template<typename OwnerType, void(*OWNER_DELETE_FUNC)(OwnerType*)>
+		Shared(const Shared<OwnerType, OWNER_DELETE_FUNC, THREAD_SAFE>& Owner, Type* Alias) : block(nullptr), alias(nullptr) {
+			if (Owner.block != nullptr && Alias != nullptr) {
+				block = Owner.block;
+				alias = Alias;
+				block->IncrementShared();
+			}
+		}
+
+		/**
+		 * Aliasing move constructor, which takes the given shared pointer's ownership without changing any reference counts.<br/>
+		 * The new shared pointer is null and the given shared pointer is unchanged if either the given shared pointer or the given pointer is null.
+		 */
+		template<typename OwnerType, void(*OWNER_DELETE_FUNC)(OwnerType*)>
+		Shared(Shared<OwnerType, OWNER_DELETE_FUNC, THREAD_SAFE>&& Owner, Type* Alias) noexcept : block(nullptr), alias(nullptr) {
+			if (Owner.block != nullptr && Alias != nullptr) {
+				block = Owner.block;
+				alias = Alias;
+				Owner.block = nullptr;
+				Owner.alias = nullptr;
+			}
 		}
 
 		/** Destructor. */
 		~Shared() {
-			if (node != nullptr) {
-				node->DecrementShared();
+			if (block != nullptr) {
+				block->DecrementShared();
 			}
 		}
 
@@ -217,87 +498,63 @@ namespace Toolbox {
 
 		/** Pointer assignment operator. */
 		Shared& operator=(Type* Data) {
-			if (node != nullptr) {
-				if (node->Data() == Data) {
+			if (block != nullptr) {
+				if (alias == nullptr && Owner()->Data() == Data) {
 					return *this;
 				}
-				node->DecrementShared();
+				block->DecrementShared();
+				block = nullptr;
+				alias = nullptr;
+			}
+			if (Data != nullptr) {
+				block = new Node(Data);
+				block->IncrementShared();
 			}
-			node = new Node(Data);
-			node->IncrementShared();
 			return *this;
 		}
 
 		/** Weak pointer assignment operator. */
-		Shared& operator=(Weak& Data) {
-			if (node != nullptr) {
-				if (node == Data.node) {
-					return *this;
-				}
-				node->DecrementShared();
-			}
-			node = Data.node;
-			if (node != nullptr) {
-				node->IncrementShared();
-			}
-			return *this;
+		Shared& operator=(const Weak& Data) {
+			return *this = Shared(Data);
 		}
 
 		/** Node assignment operator. */
 		Shared& operator=(Node* Node) {
-			if (node == Node) {
-				return *this;
-			}
-			if (node != nullptr) {
-				node->DecrementShared();
-			}
-			node = Node;
-			if (node != nullptr) {
-				node->IncrementShared();
-			}
+			Share(Node, nullptr);
 			return *this;
 		}
 
 		/** Copy assignment operator. */
 		Shared& operator=(const Shared& Copied) {
-			if (node == Copied.node) {
-				return *this;
-			}
-			if (node != nullptr) {
-				node->DecrementShared();
-			}
-			node = Copied.node;
-			if (node != nullptr) {
-				node->IncrementShared();
-			}
+			Share(Copied.block, Copied.alias);
 			return *this;
 		}
 
 		/** Move assignment operator. */
 		Shared& operator=(Shared&& Moved) noexcept {
-			if (node == Moved.node) {
+			if (this == &Moved) {
 				return *this;
 			}
-			if (node != nullptr) {
-				node->DecrementShared();
+			Block* Previous = block;
+			block = Moved.block;
+			alias = Moved.alias;
+			Moved.block = nullptr;
+			Moved.alias = nullptr;
+			if (Previous != nullptr) {
+				Previous->DecrementShared();
 			}
-			node = Moved.node;
-			Moved.node = nullptr;
 			return *this;
 		}
 
 		/** Null assignment operator. */
 		Shared& operator=(std::nullptr_t) {
-			if (node != nullptr) {
-				node->DecrementShared();
-			}
-			node = nullptr;
+			Clear();
 			return *this;
 		}
 
 		/** Equality operator. */
 		bool operator==(const Shared& Other) const {
-			return node == Other.node;
+			return block == Other.block && alias == Other.alias;
 		}
 
 		/** Inequality operator. */
@@ -307,7 +564,7 @@ namespace Toolbox {
 
 		/** Weak pointer equality operator. */
 		bool operator==(const Weak& Other) const {
-			return node == Other.node;
+			return block == Other.block && alias == Other.alias;
 		}
 
 		/** Weak pointer inequality operator. */
@@ -320,7 +577,7 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return *node->Data();
+			return *Pointer();
 		}
 
 		/** Constant dereference operator. */
@@ -328,7 +585,7 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return *node->Data();
+			return *Pointer();
 		}
 
 		/** Arrow operator. */
@@ -336,7 +593,7 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return node->Data();
+			return Pointer();
 		}
 
 		/** Constant arrow operator. */
@@ -344,25 +601,25 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return node->Data();
+			return Pointer();
 		}
 
 		/** Array operator. */
 		Type& operator[](const size_t Index) {
-			static_assert(DELETE_FUNC == DeleteArray, "ERROR: Cannot use array operator on non-array pointers!");
+			static_assert(DELETE_FUNC == DeleteArray<Type>, "ERROR: Cannot use array operator on non-array pointers!");
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return node->Data()[Index];
+			return Pointer()[Index];
 		}
 
 		/** Constant array operator. */
 		const Type& operator[](const size_t Index) const {
-			static_assert(DELETE_FUNC == DeleteArray, "ERROR: Cannot use array operator on non-array pointers!");
+			static_assert(DELETE_FUNC == DeleteArray<Type>, "ERROR: Cannot use array operator on non-array pointers!");
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return node->Data()[Index];
+			return Pointer()[Index];
 		}
 
 		/** Not null check operator. */
@@ -377,70 +634,78 @@ namespace Toolbox {
 
 		/** Pointer operator. */
 		explicit operator Type* () {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Constant pointer operator. */
 		explicit operator const Type* () const {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Weak pointer operator. */
 		explicit operator Weak() {
-			return Weak(node);
+			return Observe();
 		}
 
 		/** Constant weak pointer operator. */
 		explicit operator const Weak() const {
-			return Weak(node);
+			return Observe();
 		}
 
 
 		// GETTERS
 
+		/** The type of the function used to delete memory. */
+		using DeleteFunctionType = void(*)(Type*);
+
 		/** Returns the function used to delete memory. */
-		void(*DeleteFunction() const)(Type*) {
+		DeleteFunctionType DeleteFunction() const {
 			return DELETE_FUNC;
 		}
 
 		/** Returns a copy of the raw pointer of this shared pointer. */
 		Type* Raw() {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Returns a constant copy of the raw pointer of this shared pointer. */
 		const Type* Raw() const {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Returns a weak pointer to this shared pointer's shared memory. */
 		Weak MakeWeak() {
-			return Weak(node);
+			return Observe();
 		}
 
 		/** Returns a constant weak pointer to this shared pointer's shared memory. */
 		const Weak MakeWeak() const {
-			return Weak(node);
+			return Observe();
 		}
 
 		/** Returns the total number of shared pointers referencing this shared pointer's shared memory. */
 		size_t SharedCount() const {
-			return node != nullptr ? node->SharedCount() : 0;
+			return block != nullptr ? block->SharedCount() : 0;
 		}
 
 		/** Returns the total number of weak pointers referencing this shared pointer's shared memory. */
 		size_t WeakCount() const {
-			return node != nullptr ? node->WeakCount() : 0;
+			return block != nullptr ? block->WeakCount() : 0;
 		}
 
 		/** Returns the total number of pointers referencing this shared pointer's shared memory. */
 		size_t Total() const {
-			return node != nullptr ? node->SharedCount() + node->WeakCount() : 0;
+			return block != nullptr ? block->SharedCount() + block->WeakCount() : 0;
 		}
 
 		/** Returns whether this shared pointer is not null. */
 		bool IsValid() const {
-			return node != nullptr && node->IsValid();
+			return Pointer() != nullptr;
+		}
+
+		/** Returns whether this shared pointer points into memory owned by another shared pointer. */
+		bool IsAliased() const {
+			return alias != nullptr;
 		}
 
 
@@ -448,30 +713,37 @@ namespace Toolbox {
 
 		/** Swaps this shared pointer's memory with the given shared pointer's memory. */
 		void Swap(Shared& Other) {
-			Node* Node = node;
-			node = Other.node;
-			Other.node = Node;
+			Block* Block = block;
+			Type* Alias = alias;
+			block = Other.block;
+			alias = Other.alias;
+			Other.block = Block;
+			Other.alias = Alias;
 		}
 
 		/** Swaps this shared pointer's memory with the given weak pointer's memory. */
 		void Swap(Weak& Other) {
-			Node* Node = node;
-			node = Other.node;
-			Other.node = Node;
+			Block* Block = block;
+			Type* Alias = alias;
+			block = Other.block;
+			alias = Other.alias;
+			Other.block = Block;
+			Other.alias = Alias;
 		}
 
-		/** Deletes this shared pointer's shared memory. */
+		/** Deletes this shared pointer's shared memory (aliased shared pointers cannot delete their owner's memory). */
 		bool Delete() {
-			if (node == nullptr) {
+			if (block == nullptr || alias != nullptr) {
 				return false;
 			}
-			return node->Delete();
+			return Owner()->Delete();
 		}
 
 		/** Safely replaces this shared pointer's shared memory with the given pointer. */
 		void Replace(Type* Data) {
-			if (node != nullptr) {
-				node->Replace(Data);
+			if (block != nullptr) {
+				CheckOwner();
+				Owner()->Replace(Data);
 			}
 		}
 
@@ -480,32 +752,41 @@ namespace Toolbox {
 		 * NOTE: The pointer must still be deleted!
 		 */
 		Type* Release() {
-			if (node == nullptr) {
+			if (block == nullptr) {
 				return nullptr;
 			}
-			return node->Release();
+			CheckOwner();
+			return Owner()->Release();
 		}
 
 		/** Clears this shared pointer's reference its shared memory. */
 		bool Clear() {
-			if (node == nullptr) {
+			if (block == nullptr) {
 				return false;
 			}
-			node->DecrementShared();
-			node = nullptr;
+			Block* Previous = block;
+			block = nullptr;
+			alias = nullptr;
+			Previous->DecrementShared();
 			return true;
 		}
 
 		/** Resets this shared pointer to a new pointer. */
 		void Reset(Type* Data) {
-			if (node != nullptr) {
-				if (node->Data() == Data) {
-					return;
-				}
-				node->DecrementShared();
-			}
-			node = new Node(Data);
-			node->IncrementShared();
+			*this = Data;
+		}
+
+
+		// FACTORY
+
+		/** Constructs a new shared object in the same allocation as its reference counts. */
+		template<typename... ArgumentTypes>
+		static Shared Make(ArgumentTypes&&... Arguments) {
+			static_assert(DELETE_FUNC != DeleteArray<Type>, "ERROR: Cannot make shared arrays in place!");
+			Shared Result;
+			Result.block = new InlineNode(std::forward<ArgumentTypes>(Arguments)...);
+			Result.block->IncrementShared();
+			return Result;
 		}
 	};
 
@@ -515,4 +796,33 @@ namespace Toolbox {
 	/** A wrapper for an array pointer that automatically manages its memory and tracks new references to it. */
 	template <typename Type>
 	using SharedArray = Shared<Type, DeleteArray>;
+
+
+	// ATOMIC SHARED POINTER
+
+	/** A wrapper for a pointer that automatically manages its memory and tracks new references to it with thread-safe counts. */
+	template <typename Type>
+	using AtomicShared = Shared<Type, Delete, true>;
+
+
+	// ATOMIC SHARED ARRAY POINTER
+
+	/** A wrapper for an array pointer that automatically manages its memory and tracks new references to it with thread-safe counts. */
+	template <typename Type>
+	using AtomicSharedArray = Shared<Type, DeleteArray, true>;
+
+
+	// MAKE SHARED
+
+	/** Constructs a new shared object in the same allocation as its reference counts. */
+	template<typename Type, typename... ArgumentTypes>
+	static Shared<Type> MakeShared(ArgumentTypes&&... Arguments) {
+		return Shared<Type>::Make(std::forward<ArgumentTypes>(Arguments)...);
+	}
+
+	/** Constructs a new shared object in the same allocation as its thread-safe reference counts. */
+	template<typename Type, typename... ArgumentTypes>
+	static AtomicShared<Type> MakeAtomicShared(ArgumentTypes&&... Arguments) {
+		return AtomicShared<Type>::Make(std::forward<ArgumentTypes>(Arguments)...);
+	}
 }
@@ -0,0 +1,822 @@
+// .h
+// SIMD Functions
+// by Kyle Furey
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+// Whether to disable every vectorized kernel and only use the scalar fallbacks.
+#ifndef TOOLBOX_NO_SIMD
+#define TOOLBOX_NO_SIMD 0
+#endif
+
+// The instruction set the byte kernels are compiled for (0 is scalar, 1 is SSE2, 2 is AVX2, and 3 is NEON).
+#if TOOLBOX_NO_SIMD
+#define TOOLBOX_SIMD 0
+#elif defined(__AVX2__)
+#define TOOLBOX_SIMD 2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TOOLBOX_SIMD 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define TOOLBOX_SIMD 3
+#include <arm_neon.h>
+#else
+#define TOOLBOX_SIMD 0
+#endif
+
+// Disables address sanitizing for kernels that intentionally read whole aligned blocks past the end of a C string.
+#if defined(__clang__) || defined(__GNUC__)
+#define TOOLBOX_NO_SANITIZE __attribute__((no_sanitize_address))
+#else
+#define TOOLBOX_NO_SANITIZE
+#endif
+
+// Whether the floating point kernels are vectorized, which requires 64-bit ARM when using NEON.
+#if TOOLBOX_SIMD && (TOOLBOX_SIMD != 3 || defined(__aarch64__) || defined(_M_ARM64))
+#define TOOLBOX_SIMD_FLOAT 1
+#else
+#define TOOLBOX_SIMD_FLOAT 0
+#endif
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+#if TOOLBOX_SIMD
+
+	// BYTE PACK
+
+	/**
+	 * A thin wrapper around a single SIMD register of bytes used by the byte kernels.<br/>
+	 * Comparisons produce lanes of all ones or all zeros, and Mask() packs them into an integer with BITS bits per lane.
+	 */
+	struct BytePack final {
+
+		// REGISTER
+
+#if TOOLBOX_SIMD == 2
+		/** The underlying register type. */
+		using Register = __m256i;
+
+		/** The number of bytes in a pack. */
+		static constexpr size_t WIDTH = 32;
+
+		/** The number of bits each lane occupies in a mask. */
+		static constexpr size_t BITS = 1;
+#elif TOOLBOX_SIMD == 1
+		/** The underlying register type. */
+		using Register = __m128i;
+
+		/** The number of bytes in a pack. */
+		static constexpr size_t WIDTH = 16;
+
+		/** The number of bits each lane occupies in a mask. */
+		static constexpr size_t BITS = 1;
+#else
+		/** The underlying register type. */
+		using Register = uint8x16_t;
+
+		/** The number of bytes in a pack. */
+		static constexpr size_t WIDTH = 16;
+
+		/** The number of bits each lane occupies in a mask. */
+		static constexpr size_t BITS = 4;
+#endif
+
+
+		// DATA
+
+		/** The bytes in this pack. */
+		Register bytes;
+
+
+		// LOADING
+
+		/** Loads a pack from the given unaligned memory, which must hold at least WIDTH bytes. */
+		static BytePack Load(const char* Data) {
+			BytePack Pack;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+			std::memcpy(&Pack.bytes, Data, WIDTH);
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+			return Pack;
+		}
+
+		/** Loads a pack from the given memory aligned to WIDTH bytes, which never crosses a page boundary. */
+		TOOLBOX_NO_SANITIZE static BytePack LoadAligned(const char* Data) {
+			return { *reinterpret_cast<const Register*>(Data) };
+		}
+
+		/** Stores this pack to the given unaligned memory, which must hold at least WIDTH bytes. */
+		void Store(char* Data) const {
+			std::memcpy(Data, &bytes, WIDTH);
+		}
+
+		/** Returns a pack with each lane set to the given byte. */
+		static BytePack Splat(const char Byte) {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_set1_epi8(Byte) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_set1_epi8(Byte) };
+#else
+			return { vdupq_n_u8(static_cast<uint8_t>(Byte)) };
+#endif
+		}
+
+
+		// OPERATIONS
+
+		/** Returns a pack of lanes that are set where both packs are equal. */
+		BytePack operator==(const BytePack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_cmpeq_epi8(bytes, Other.bytes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_cmpeq_epi8(bytes, Other.bytes) };
+#else
+			return { vceqq_u8(bytes, Other.bytes) };
+#endif
+		}
+
+		/** Returns the bitwise and of both packs. */
+		BytePack operator&(const BytePack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_and_si256(bytes, Other.bytes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_and_si128(bytes, Other.bytes) };
+#else
+			return { vandq_u8(bytes, Other.bytes) };
+#endif
+		}
+
+		/** Returns the bitwise or of both packs. */
+		BytePack operator|(const BytePack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_or_si256(bytes, Other.bytes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_or_si128(bytes, Other.bytes) };
+#else
+			return { vorrq_u8(bytes, Other.bytes) };
+#endif
+		}
+
+		/** Returns the wrapping sum of each lane. */
+		BytePack operator+(const BytePack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_add_epi8(bytes, Other.bytes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_add_epi8(bytes, Other.bytes) };
+#else
+			return { vaddq_u8(bytes, Other.bytes) };
+#endif
+		}
+
+		/** Returns a pack of lanes that are set where this pack's lane is within the given inclusive range of unsigned bytes. */
+		BytePack InRange(const unsigned char Low, const unsigned char High) const {
+#if TOOLBOX_SIMD == 2
+			const __m256i Shifted = _mm256_add_epi8(bytes, _mm256_set1_epi8(static_cast<char>(0x80 - Low)));
+			return { _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-0x80 + (High - Low) + 1)), Shifted) };
+#elif TOOLBOX_SIMD == 1
+			const __m128i Shifted = _mm_add_epi8(bytes, _mm_set1_epi8(static_cast<char>(0x80 - Low)));
+			return { _mm_cmplt_epi8(Shifted, _mm_set1_epi8(static_cast<char>(-0x80 + (High - Low) + 1))) };
+#else
+			return { vcleq_u8(vsubq_u8(bytes, vdupq_n_u8(Low)), vdupq_n_u8(static_cast<uint8_t>(High - Low))) };
+#endif
+		}
+
+		/** Returns this pack with the given lanes bitwise and'ed with the given byte and added to its own lanes. */
+		BytePack AddWhere(const BytePack Lanes, const char Byte) const {
+			return *this + (Lanes & Splat(Byte));
+		}
+
+		/** Packs each lane into an integer with BITS bits per lane, where only the highest bit of each lane may be set. */
+		uint64_t Mask() const {
+#if TOOLBOX_SIMD == 2
+			return static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+#elif TOOLBOX_SIMD == 1
+			return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+#else
+			const uint8x8_t Narrowed = vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4);
+			return vget_lane_u64(vreinterpret_u64_u8(Narrowed), 0) & 0x8888888888888888ull;
+#endif
+		}
+
+		/** Returns the inverted mask of this pack. */
+		uint64_t InvertedMask() const {
+#if TOOLBOX_SIMD == 3
+			return ~Mask() & 0x8888888888888888ull;
+#else
+			return ~Mask() & ((1ull << WIDTH) - 1);
+#endif
+		}
+
+
+		// LANES
+
+		/** Returns the lowest lane set in the given non-zero mask. */
+		static size_t FirstLane(const uint64_t Mask) {
+			return static_cast<size_t>(std::countr_zero(Mask)) / BITS;
+		}
+
+		/** Returns the highest lane set in the given non-zero mask. */
+		static size_t LastLane(const uint64_t Mask) {
+			return static_cast<size_t>(63 - std::countl_zero(Mask)) / BITS;
+		}
+
+		/** Returns the number of lanes set in the given mask. */
+		static size_t CountLanes(const uint64_t Mask) {
+			return static_cast<size_t>(std::popcount(Mask));
+		}
+	};
+
+#endif
+
+
+	// FLOAT PACK
+
+	/**
+	 * A thin wrapper around a single SIMD register of floating point lanes used by the point kernels.<br/>
+	 * This is the scalar fallback with one lane, which is used for types and platforms without vectorized lanes.
+	 */
+	template<typename PrecisionType>
+	struct FloatPack final {
+
+		// REGISTER
+
+		/** The underlying register type. */
+		using Register = PrecisionType;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 1;
+
+
+		// DATA
+
+		/** The lanes in this pack. */
+		Register lanes;
+
+
+		// LOADING
+
+		/** Loads a pack from the given unaligned memory. */
+		static FloatPack Load(const PrecisionType* Data) {
+			return { *Data };
+		}
+
+		/** Stores this pack to the given unaligned memory. */
+		void Store(PrecisionType* Data) const {
+			*Data = lanes;
+		}
+
+		/** Returns a pack with each lane set to the given value. */
+		static FloatPack Splat(const PrecisionType Value) {
+			return { Value };
+		}
+
+
+		// OPERATIONS
+
+		/** Returns the sum of each lane. */
+		FloatPack operator+(const FloatPack Other) const {
+			return { lanes + Other.lanes };
+		}
+
+		/** Returns the difference of each lane. */
+		FloatPack operator-(const FloatPack Other) const {
+			return { lanes - Other.lanes };
+		}
+
+		/** Returns the product of each lane. */
+		FloatPack operator*(const FloatPack Other) const {
+			return { lanes * Other.lanes };
+		}
+
+		/** Returns the absolute value of each lane. */
+		FloatPack Abs() const {
+			return { lanes < 0 ? -lanes : lanes };
+		}
+
+		/** Returns the square root of each lane. */
+		FloatPack Sqrt() const {
+			return { static_cast<PrecisionType>(std::sqrt(lanes)) };
+		}
+
+		/** Returns a mask with one bit set for each lane that is less than or equal to the given pack's lane. */
+		uint64_t LessEqual(const FloatPack Other) const {
+			return lanes <= Other.lanes ? 1 : 0;
+		}
+	};
+
+#if TOOLBOX_SIMD_FLOAT
+
+	/** A thin wrapper around a single SIMD register of float lanes used by the point kernels. */
+	template<>
+	struct FloatPack<float> final {
+
+		// REGISTER
+
+#if TOOLBOX_SIMD == 2
+		/** The underlying register type. */
+		using Register = __m256;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 8;
+#elif TOOLBOX_SIMD == 1
+		/** The underlying register type. */
+		using Register = __m128;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 4;
+#else
+		/** The underlying register type. */
+		using Register = float32x4_t;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 4;
+#endif
+
+
+		// DATA
+
+		/** The lanes in this pack. */
+		Register lanes;
+
+
+		// LOADING
+
+		/** Loads a pack from the given unaligned memory. */
+		static FloatPack Load(const float* Data) {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_loadu_ps(Data) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_loadu_ps(Data) };
+#else
+			return { vld1q_f32(Data) };
+#endif
+		}
+
+		/** Stores this pack to the given unaligned memory. */
+		void Store(float* Data) const {
+#if TOOLBOX_SIMD == 2
+			_mm256_storeu_ps(Data, lanes);
+#elif TOOLBOX_SIMD == 1
+			_mm_storeu_ps(Data, lanes);
+#else
+			vst1q_f32(Data, lanes);
+#endif
+		}
+
+		/** Returns a pack with each lane set to the given value. */
+		static FloatPack Splat(const float Value) {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_set1_ps(Value) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_set1_ps(Value) };
+#else
+			return { vdupq_n_f32(Value) };
+#endif
+		}
+
+
+		// OPERATIONS
+
+		/** Returns the sum of each lane. */
+		FloatPack operator+(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_add_ps(lanes, Other.lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_add_ps(lanes, Other.lanes) };
+#else
+			return { vaddq_f32(lanes, Other.lanes) };
+#endif
+		}
+
+		/** Returns the difference of each lane. */
+		FloatPack operator-(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_sub_ps(lanes, Other.lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_sub_ps(lanes, Other.lanes) };
+#else
+			return { vsubq_f32(lanes, Other.lanes) };
+#endif
+		}
+
+		/** Returns the product of each lane. */
+		FloatPack operator*(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_mul_ps(lanes, Other.lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_mul_ps(lanes, Other.lanes) };
+#else
+			return { vmulq_f32(lanes, Other.lanes) };
+#endif
+		}
+
+		/** Returns the absolute value of each lane. */
+		FloatPack Abs() const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_andnot_ps(_mm_set1_ps(-0.0f), lanes) };
+#else
+			return { vabsq_f32(lanes) };
+#endif
+		}
+
+		/** Returns the square root of each lane. */
+		FloatPack Sqrt() const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_sqrt_ps(lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_sqrt_ps(lanes) };
+#else
+			return { vsqrtq_f32(lanes) };
+#endif
+		}
+
+		/** Returns a mask with one bit set for each lane that is less than or equal to the given pack's lane. */
+		uint64_t LessEqual(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(lanes, Other.lanes, _CMP_LE_OQ)));
+#elif TOOLBOX_SIMD == 1
+			return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(lanes, Other.lanes)));
+#else
+			const uint32x4_t Lanes = vshrq_n_u32(vcleq_f32(lanes, Other.lanes), 31);
+			return vgetq_lane_u32(Lanes, 0) | (vgetq_lane_u32(Lanes, 1) << 1) | (vgetq_lane_u32(Lanes, 2) << 2) | (vgetq_lane_u32(Lanes, 3) << 3);
+#endif
+		}
+	};
+
+	/** A thin wrapper around a single SIMD register of double lanes used by the point kernels. */
+	template<>
+	struct FloatPack<double> final {
+
+		// REGISTER
+
+#if TOOLBOX_SIMD == 2
+		/** The underlying register type. */
+		using Register = __m256d;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 4;
+#elif TOOLBOX_SIMD == 1
+		/** The underlying register type. */
+		using Register = __m128d;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 2;
+#else
+		/** The underlying register type. */
+		using Register = float64x2_t;
+
+		/** The number of lanes in a pack. */
+		static constexpr size_t WIDTH = 2;
+#endif
+
+
+		// DATA
+
+		/** The lanes in this pack. */
+		Register lanes;
+
+
+		// LOADING
+
+		/** Loads a pack from the given unaligned memory. */
+		static FloatPack Load(const double* Data) {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_loadu_pd(Data) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_loadu_pd(Data) };
+#else
+			return { vld1q_f64(Data) };
+#endif
+		}
+
+		/** Stores this pack to the given unaligned memory. */
+		void Store(double* Data) const {
+#if TOOLBOX_SIMD == 2
+			_mm256_storeu_pd(Data, lanes);
+#elif TOOLBOX_SIMD == 1
+			_mm_storeu_pd(Data, lanes);
+#else
+			vst1q_f64(Data, lanes);
+#endif
+		}
+
+		/** Returns a pack with each lane set to the given value. */
+		static FloatPack Splat(const double Value) {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_set1_pd(Value) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_set1_pd(Value) };
+#else
+			return { vdupq_n_f64(Value) };
+#endif
+		}
+
+
+		// OPERATIONS
+
+		/** Returns the sum of each lane. */
+		FloatPack operator+(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_add_pd(lanes, Other.lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_add_pd(lanes, Other.lanes) };
+#else
+			return { vaddq_f64(lanes, Other.lanes) };
+#endif
+		}
+
+		/** Returns the difference of each lane. */
+		FloatPack operator-(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_sub_pd(lanes, Other.lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_sub_pd(lanes, Other.lanes) };
+#else
+			return { vsubq_f64(lanes, Other.lanes) };
+#endif
+		}
+
+		/** Returns the product of each lane. */
+		FloatPack operator*(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_mul_pd(lanes, Other.lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_mul_pd(lanes, Other.lanes) };
+#else
+			return { vmulq_f64(lanes, Other.lanes) };
+#endif
+		}
+
+		/** Returns the absolute value of each lane. */
+		FloatPack Abs() const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_andnot_pd(_mm256_set1_pd(-0.0), lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_andnot_pd(_mm_set1_pd(-0.0), lanes) };
+#else
+			return { vabsq_f64(lanes) };
+#endif
+		}
+
+		/** Returns the square root of each lane. */
+		FloatPack Sqrt() const {
+#if TOOLBOX_SIMD == 2
+			return { _mm256_sqrt_pd(lanes) };
+#elif TOOLBOX_SIMD == 1
+			return { _mm_sqrt_pd(lanes) };
+#else
+			return { vsqrtq_f64(lanes) };
+#endif
+		}
+
+		/** Returns a mask with one bit set for each lane that is less than or equal to the given pack's lane. */
+		uint64_t LessEqual(const FloatPack Other) const {
+#if TOOLBOX_SIMD == 2
+			return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(lanes, Other.lanes, _CMP_LE_OQ)));
+#elif TOOLBOX_SIMD == 1
+			return static_cast<uint32_t>(_mm_movemask_pd(_mm_cmple_pd(lanes, Other.lanes)));
+#else
+			const uint64x2_t Lanes = vshrq_n_u64(vcleq_f64(lanes, Other.lanes), 63);
+			return vgetq_lane_u64(Lanes, 0) | (vgetq_lane_u64(Lanes, 1) << 1);
+#endif
+		}
+	};
+
+#endif
+
+
+	// BYTE KERNELS
+
+	/** Returns the number of bytes before the first null byte in the given C string. */
+	TOOLBOX_NO_SANITIZE inline size_t SimdLength(const char* String) {
+#if TOOLBOX_SIMD
+		const char* Start = String;
+		const size_t Offset = reinterpret_cast<uintptr_t>(String) & (BytePack::WIDTH - 1);
+		String -= Offset;
+		uint64_t Mask = (BytePack::LoadAligned(String) == BytePack::Splat(0)).Mask() >> (Offset * BytePack::BITS);
+		if (Mask != 0) {
+			return BytePack::FirstLane(Mask);
+		}
+		for (String += BytePack::WIDTH;; String += BytePack::WIDTH) {
+			Mask = (BytePack::LoadAligned(String) == BytePack::Splat(0)).Mask();
+			if (Mask != 0) {
+				return static_cast<size_t>(String - Start) + BytePack::FirstLane(Mask);
+			}
+		}
+#else
+		size_t Index = 0;
+		while (String[Index] != 0) {
+			++Index;
+		}
+		return Index;
+#endif
+	}
+
+	/** Returns the index of the first matching byte at or after the given index, or -1 if no match is found. */
+	inline ptrdiff_t SimdFind(const char* Data, const size_t Length, const char Byte, size_t Index = 0) {
+#if TOOLBOX_SIMD
+		const BytePack Match = BytePack::Splat(Byte);
+		for (; Index + BytePack::WIDTH <= Length; Index += BytePack::WIDTH) {
+			const uint64_t Mask = (BytePack::Load(Data + Index) == Match).Mask();
+			if (Mask != 0) {
+				return static_cast<ptrdiff_t>(Index + BytePack::FirstLane(Mask));
+			}
+		}
+#endif
+		for (; Index < Length; ++Index) {
+			if (Data[Index] == Byte) {
+				return static_cast<ptrdiff_t>(Index);
+			}
+		}
+		return -1;
+	}
+
+	/** Returns the index of the last matching byte, or -1 if no match is found. */
+	inline ptrdiff_t SimdFindLast(const char* Data, size_t Length, const char Byte) {
+#if TOOLBOX_SIMD
+		const BytePack Match = BytePack::Splat(Byte);
+		for (; Length >= BytePack::WIDTH; Length -= BytePack::WIDTH) {
+			const uint64_t Mask = (BytePack::Load(Data + Length - BytePack::WIDTH) == Match).Mask();
+			if (Mask != 0) {
+				return static_cast<ptrdiff_t>(Length - BytePack::WIDTH + BytePack::LastLane(Mask));
+			}
+		}
+#endif
+		for (; Length > 0; --Length) {
+			if (Data[Length - 1] == Byte) {
+				return static_cast<ptrdiff_t>(Length - 1);
+			}
+		}
+		return -1;
+	}
+
+	/** Returns the number of matching bytes. */
+	inline size_t SimdCount(const char* Data, const size_t Length, const char Byte) {
+		size_t Count = 0;
+		size_t Index = 0;
+#if TOOLBOX_SIMD
+		const BytePack Match = BytePack::Splat(Byte);
+		for (; Index + BytePack::WIDTH <= Length; Index += BytePack::WIDTH) {
+			Count += BytePack::CountLanes((BytePack::Load(Data + Index) == Match).Mask());
+		}
+#endif
+		for (; Index < Length; ++Index) {
+			if (Data[Index] == Byte) {
+				++Count;
+			}
+		}
+		return Count;
+	}
+
+	/** Returns the index of the first byte that differs between the given arrays, or the given length if they are equal. */
+	inline size_t SimdMismatch(const char* Left, const char* Right, const size_t Length) {
+		size_t Index = 0;
+#if TOOLBOX_SIMD
+		for (; Index + BytePack::WIDTH <= Length; Index += BytePack::WIDTH) {
+			const uint64_t Mask = (BytePack::Load(Left + Index) == BytePack::Load(Right + Index)).InvertedMask();
+			if (Mask != 0) {
+				return Index + BytePack::FirstLane(Mask);
+			}
+		}
+#endif
+		for (; Index < Length; ++Index) {
+			if (Left[Index] != Right[Index]) {
+				return Index;
+			}
+		}
+		return Length;
+	}
+
+	/** Returns whether the given arrays contain the same bytes. */
+	inline bool SimdEquals(const char* Left, const char* Right, const size_t Length) {
+		return SimdMismatch(Left, Right, Length) == Length;
+	}
+
+	/**
+	 * Returns the index of the first occurrence of the given needle at or after the given index, or -1 if no match is found.<br/>
+	 * Candidates are filtered by comparing the needle's first and last bytes a whole pack at a time before comparing the rest.
+	 */
+	inline ptrdiff_t SimdFindString(const char* Data, const size_t Length, const char* Needle, const size_t NeedleLength, size_t Index = 0) {
+		if (NeedleLength == 0) {
+			return Index <= Length ? static_cast<ptrdiff_t>(Index) : -1;
+		}
+		if (NeedleLength > Length) {
+			return -1;
+		}
+		if (NeedleLength == 1) {
+			return SimdFind(Data, Length, Needle[0], Index);
+		}
+		const size_t Last = Length - NeedleLength;
+#if TOOLBOX_SIMD
+		const BytePack First = BytePack::Splat(Needle[0]);
+		const BytePack Final = BytePack::Splat(Needle[NeedleLength - 1]);
+		for (; Index + BytePack::WIDTH <= Last + 1; Index += BytePack::WIDTH) {
+			const BytePack Front = BytePack::Load(Data + Index) == First;
+			const BytePack Back = BytePack::Load(Data + Index + NeedleLength - 1) == Final;
+			uint64_t Mask = (Front & Back).Mask();
+			while (Mask != 0) {
+				const size_t Candidate = Index + BytePack::FirstLane(Mask);
+				if (SimdEquals(Data + Candidate + 1, Needle + 1, NeedleLength - 2)) {
+					return static_cast<ptrdiff_t>(Candidate);
+				}
+				Mask &= Mask - 1;
+			}
+		}
+#endif
+		for (; Index <= Last; ++Index) {
+			if (Data[Index] == Needle[0] && SimdEquals(Data + Index + 1, Needle + 1, NeedleLength - 1)) {
+				return static_cast<ptrdiff_t>(Index);
+			}
+		}
+		return -1;
+	}
+
+	/** Returns the number of whitespace bytes at the front of the given array. */
+	inline size_t SimdSkipWhitespace(const char* Data, const size_t Length) {
+		size_t Index = 0;
+#if TOOLBOX_SIMD
+		const BytePack Space = BytePack::Splat(' ');
+		for (; Index + BytePack::WIDTH <= Length; Index += BytePack::WIDTH) {
+			const BytePack Bytes = BytePack::Load(Data + Index);
+			const uint64_t Mask = ((Bytes == Space) | Bytes.InRange('\t', '\r')).InvertedMask();
+			if (Mask != 0) {
+				return Index + BytePack::FirstLane(Mask);
+			}
+		}
+#endif
+		for (; Index < Length; ++Index) {
+			if (Data[Index] != ' ' && (Data[Index] < '\t' || Data[Index] > '\r')) {
+				return Index;
+			}
+		}
+		return Length;
+	}
+
+	/** Returns the number of whitespace bytes at the back of the given array. */
+	inline size_t SimdSkipWhitespaceBack(const char* Data, const size_t Length) {
+		size_t Remaining = Length;
+#if TOOLBOX_SIMD
+		const BytePack Space = BytePack::Splat(' ');
+		for (; Remaining >= BytePack::WIDTH; Remaining -= BytePack::WIDTH) {
+			const BytePack Bytes = BytePack::Load(Data + Remaining - BytePack::WIDTH);
+			const uint64_t Mask = ((Bytes == Space) | Bytes.InRange('\t', '\r')).InvertedMask();
+			if (Mask != 0) {
+				return BytePack::WIDTH - 1 - BytePack::LastLane(Mask) + (Length - Remaining);
+			}
+		}
+#endif
+		for (; Remaining > 0; --Remaining) {
+			const char Byte = Data[Remaining - 1];
+			if (Byte != ' ' && (Byte < '\t' || Byte > '\r')) {
+				break;
+			}
+		}
+		return Length - Remaining;
+	}
+
+	/** Turns all uppercase ASCII letters in the given array lowercase. */
+	inline void SimdToLowercase(char* Data, const size_t Length) {
+		size_t Index = 0;
+#if TOOLBOX_SIMD
+		for (; Index + BytePack::WIDTH <= Length; Index += BytePack::WIDTH) {
+			const BytePack Bytes = BytePack::Load(Data + Index);
+			Bytes.AddWhere(Bytes.InRange('A', 'Z'), 'a' - 'A').Store(Data + Index);
+		}
+#endif
+		for (; Index < Length; ++Index) {
+			if (Data[Index] >= 'A' && Data[Index] <= 'Z') {
+				Data[Index] += 'a' - 'A';
+			}
+		}
+	}
+
+	/** Turns all lowercase ASCII letters in the given array uppercase. */
+	inline void SimdToUppercase(char* Data, const size_t Length) {
+		size_t Index = 0;
+#if TOOLBOX_SIMD
+		for (; Index + BytePack::WIDTH <= Length; Index += BytePack::WIDTH) {
+			const BytePack Bytes = BytePack::Load(Data + Index);
+			Bytes.AddWhere(Bytes.InRange('a', 'z'), 'A' - 'a').Store(Data + Index);
+		}
+#endif
+		for (; Index < Length; ++Index) {
+			if (Data[Index] >= 'a' && Data[Index] <= 'z') {
+				Data[Index] += 'A' - 'a';
+			}
+		}
+	}
+}
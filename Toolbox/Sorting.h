@@ -3,6 +3,18 @@
 // by Kyle Furey
 
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// The number of elements at or below which hybrid sorts switch to insertion sort.
+#define SORT_INSERTION_THRESHOLD 24
+
+// The number of elements above which hybrid sorts choose their pivot from nine elements instead of three.
+#define SORT_NINTHER_THRESHOLD 128
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
@@ -20,59 +32,47 @@ namespace Toolbox {
 
 		// SORTING
 
-		/** Recursively splits and merges the collection until it is sorted. */
+		/** Recursively splits and merges the collection until it is sorted, using the given buffer of at least half the collection's size. */
 		template <typename CollectionType, typename Type>
-		static void RecursiveMergeSort(CollectionType& Collection, const size_t Begin, const size_t End, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
+		static void RecursiveMergeSort(CollectionType& Collection, const size_t Begin, const size_t End, Type* Buffer, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
 			if (Begin >= End) {
 				return;
 			}
 			const size_t Middle = (Begin + End) / 2;
-			RecursiveMergeSort<CollectionType, Type>(Collection, Begin, Middle, Comparer);
-			RecursiveMergeSort<CollectionType, Type>(Collection, Middle + 1, End, Comparer);
-			Merge<CollectionType, Type>(Collection, Begin, Middle, End, Comparer);
+			RecursiveMergeSort<CollectionType, Type>(Collection, Begin, Middle, Buffer, Comparer);
+			RecursiveMergeSort<CollectionType, Type>(Collection, Middle + 1, End, Buffer, Comparer);
+			Merge<CollectionType, Type>(Collection, Begin, Middle, End, Buffer, Comparer);
 		}
 
-		/** Merges the collection at the given indicies for merge sort. */
+		/** Merges the collection at the given indicies for merge sort by moving its left half into the given buffer. */
 		template <typename CollectionType, typename Type>
-		static void Merge(CollectionType& Collection, size_t Begin, size_t Middle, size_t End, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
+		static void Merge(CollectionType& Collection, size_t Begin, size_t Middle, size_t End, Type* Buffer, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
+			if (!Comparer(Collection[Middle], Collection[Middle + 1])) {
+				return;
+			}
 			const size_t LeftSize = Middle - Begin + 1;
-			Type* Left = new Type[LeftSize];
 			for (size_t Index = 0; Index < LeftSize; ++Index) {
-				Left[Index] = Collection[Begin + Index];
+				Buffer[Index] = std::move(Collection[Begin + Index]);
 			}
-			const size_t RightSize = End - Middle;
-			Type* Right = new Type[RightSize];
-			for (size_t Index = 0; Index < RightSize; ++Index) {
-				Right[Index] = Collection[Middle + Index + 1];
-			}
-			Middle = Begin;
-			Begin = 0;
-			End = 0;
-			while (Begin < LeftSize && End < RightSize) {
-				if (!Comparer(Left[Begin], Right[End])) {
-					Collection[Middle] = Left[Begin];
-					++Begin;
+			size_t Left = 0;
+			size_t Right = Middle + 1;
+			size_t Current = Begin;
+			while (Left < LeftSize && Right <= End) {
+				if (!Comparer(Buffer[Left], Collection[Right])) {
+					Collection[Current] = std::move(Buffer[Left]);
+					++Left;
 				}
 				else {
-					Collection[Middle] = Right[End];
-					++End;
+					Collection[Current] = std::move(Collection[Right]);
+					++Right;
 				}
-				++Middle;
-			}
-			while (Begin < LeftSize) {
-				Collection[Middle] = Left[Begin];
-				++Begin;
-				++Middle;
+				++Current;
 			}
-			while (End < RightSize) {
-				Collection[Middle] = Right[End];
-				++End;
-				++Middle;
+			while (Left < LeftSize) {
+				Collection[Current] = std::move(Buffer[Left]);
+				++Left;
+				++Current;
 			}
-			delete[] Left;
-			Left = nullptr;
-			delete[] Right;
-			Right = nullptr;
 		}
 
 		/** Recursively partitions and separates the collection until it is sorted. */
@@ -81,7 +81,18 @@ namespace Toolbox {
 			if (Low >= High) {
 				return;
 			}
-			const size_t PivotIndex = Partition<CollectionType, Type>(Collection, Low, High, Collection[High]);
+			const size_t Middle = Low + (High - Low) / 2;
+			if (Comparer(Collection[Low], Collection[Middle])) {
+				std::swap(Collection[Low], Collection[Middle]);
+			}
+			if (Comparer(Collection[Middle], Collection[High])) {
+				std::swap(Collection[Middle], Collection[High]);
+				if (Comparer(Collection[Low], Collection[Middle])) {
+					std::swap(Collection[Low], Collection[Middle]);
+				}
+			}
+			std::swap(Collection[Middle], Collection[High]);
+			const size_t PivotIndex = Partition<CollectionType, Type>(Collection, Low, High, Collection[High], Comparer);
 			if (PivotIndex > 0) {
 				RecursiveQuickSort<CollectionType, Type>(Collection, Low, PivotIndex - 1, Comparer);
 			}
@@ -94,18 +105,197 @@ namespace Toolbox {
 			size_t PivotIndex = Low;
 			for (size_t Index = Low; Index < High; ++Index) {
 				if (!Comparer(Collection[Index], Pivot)) {
-					const Type Swapped = Collection[PivotIndex];
-					Collection[PivotIndex] = Collection[Index];
-					Collection[Index] = Swapped;
+					std::swap(Collection[PivotIndex], Collection[Index]);
 					++PivotIndex;
 				}
 			}
-			const Type Swapped = Collection[PivotIndex];
-			Collection[PivotIndex] = Collection[High];
-			Collection[High] = Swapped;
+			std::swap(Collection[PivotIndex], Collection[High]);
 			return PivotIndex;
 		}
 
+		// HYBRID SORTING
+
+		/** Insertion sorts the given range, which is fastest for small or nearly sorted ranges. */
+		template<typename Type, typename ComparerType>
+		static void InsertionSort(Type* Begin, Type* End, ComparerType& Comparer) {
+			if (End - Begin < 2) {
+				return;
+			}
+			for (Type* Current = Begin + 1; Current < End; ++Current) {
+				if (!Comparer(*(Current - 1), *Current)) {
+					continue;
+				}
+				Type Inserted = std::move(*Current);
+				Type* Hole = Current;
+				do {
+					*Hole = std::move(*(Hole - 1));
+					--Hole;
+				} while (Hole > Begin && Comparer(*(Hole - 1), Inserted));
+				*Hole = std::move(Inserted);
+			}
+		}
+
+		/** Orders the three given elements so that the median is in the middle. */
+		template<typename Type, typename ComparerType>
+		static void SortThree(Type* Low, Type* Middle, Type* High, ComparerType& Comparer) {
+			if (Comparer(*Low, *Middle)) {
+				std::swap(*Low, *Middle);
+			}
+			if (Comparer(*Middle, *High)) {
+				std::swap(*Middle, *High);
+				if (Comparer(*Low, *Middle)) {
+					std::swap(*Low, *Middle);
+				}
+			}
+		}
+
+		/** Sifts the element at the given index down the max heap stored in the given range. */
+		template<typename Type, typename ComparerType>
+		static void SiftDown(Type* Begin, size_t Index, const size_t Count, ComparerType& Comparer) {
+			Type Sifted = std::move(Begin[Index]);
+			while (true) {
+				size_t Child = Index * 2 + 1;
+				if (Child >= Count) {
+					break;
+				}
+				if (Child + 1 < Count && Comparer(Begin[Child + 1], Begin[Child])) {
+					++Child;
+				}
+				if (!Comparer(Begin[Child], Sifted)) {
+					break;
+				}
+				Begin[Index] = std::move(Begin[Child]);
+				Index = Child;
+			}
+			Begin[Index] = std::move(Sifted);
+		}
+
+		/** Heap sorts the given range, which guarantees O(n log n) when quick sorting degrades. */
+		template<typename Type, typename ComparerType>
+		static void HeapSort(Type* Begin, Type* End, ComparerType& Comparer) {
+			const size_t Count = static_cast<size_t>(End - Begin);
+			for (size_t Index = Count / 2; Index > 0; --Index) {
+				SiftDown(Begin, Index - 1, Count, Comparer);
+			}
+			for (size_t Last = Count; Last > 1; --Last) {
+				std::swap(Begin[0], Begin[Last - 1]);
+				SiftDown(Begin, 0, Last - 1, Comparer);
+			}
+		}
+
+		/**
+		 * Partitions the given range around its first element and returns the pivot's final position.<br/>
+		 * Elements equal to the pivot may end up on either side, which keeps runs of duplicates balanced.
+		 */
+		template<typename Type, typename ComparerType>
+		static Type* HoarePartition(Type* Begin, Type* End, ComparerType& Comparer) {
+			Type* Left = Begin;
+			Type* Right = End;
+			while (true) {
+				do {
+					++Left;
+				} while (Left < End && Comparer(*Begin, *Left));
+				do {
+					--Right;
+				} while (Comparer(*Right, *Begin));
+				if (Left >= Right) {
+					break;
+				}
+				std::swap(*Left, *Right);
+			}
+			std::swap(*Begin, *Right);
+			return Right;
+		}
+
+		/** Quick sorts the given range with a median pivot, falling back to heap sort after too many unbalanced partitions. */
+		template<typename Type, typename ComparerType>
+		static void RecursiveIntroSort(Type* Begin, Type* End, size_t Depth, ComparerType& Comparer) {
+			while (End - Begin > SORT_INSERTION_THRESHOLD) {
+				if (Depth == 0) {
+					HeapSort(Begin, End, Comparer);
+					return;
+				}
+				--Depth;
+				const size_t Count = static_cast<size_t>(End - Begin);
+				Type* Middle = Begin + Count / 2;
+				if (Count > SORT_NINTHER_THRESHOLD) {
+					const size_t Step = Count / 8;
+					SortThree(Begin, Begin + Step, Begin + Step * 2, Comparer);
+					SortThree(Middle - Step, Middle, Middle + Step, Comparer);
+					SortThree(End - 1 - Step * 2, End - 1 - Step, End - 1, Comparer);
+					SortThree(Begin + Step, Middle, End - 1 - Step, Comparer);
+				}
+				else {
+					SortThree(Begin, Middle, End - 1, Comparer);
+				}
+				std::swap(*Begin, *Middle);
+				Type* Pivot = HoarePartition(Begin, End, Comparer);
+				if (Pivot - Begin < End - Pivot) {
+					RecursiveIntroSort(Begin, Pivot, Depth, Comparer);
+					Begin = Pivot + 1;
+				}
+				else {
+					RecursiveIntroSort(Pivot + 1, End, Depth, Comparer);
+					End = Pivot;
+				}
+			}
+			InsertionSort(Begin, End, Comparer);
+		}
+
+		/** Stably merges the two adjacent sorted ranges of the source into the destination. */
+		template<typename Type, typename ComparerType>
+		static void MergeInto(Type* Source, const size_t Begin, const size_t Middle, const size_t End, Type* Destination, ComparerType& Comparer) {
+			size_t Left = Begin;
+			size_t Right = Middle;
+			size_t Current = Begin;
+			while (Left < Middle && Right < End) {
+				if (Comparer(Source[Left], Source[Right])) {
+					Destination[Current] = std::move(Source[Right]);
+					++Right;
+				}
+				else {
+					Destination[Current] = std::move(Source[Left]);
+					++Left;
+				}
+				++Current;
+			}
+			for (; Left < Middle; ++Left, ++Current) {
+				Destination[Current] = std::move(Source[Left]);
+			}
+			for (; Right < End; ++Right, ++Current) {
+				Destination[Current] = std::move(Source[Right]);
+			}
+		}
+
+
+		// RADIX SORTING
+
+		/** Returns the given arithmetic key as an unsigned integer with the same ordering. */
+		template<typename KeyType>
+		static auto RadixKey(const KeyType Key) {
+			static_assert(std::is_arithmetic_v<KeyType>, "ERROR: Radix sort keys must be integers or floating point numbers!");
+			if constexpr (std::is_same_v<KeyType, bool>) {
+				return static_cast<uint8_t>(Key);
+			}
+			else if constexpr (std::is_floating_point_v<KeyType>) {
+				using Unsigned = std::conditional_t<sizeof(KeyType) == 4, uint32_t, uint64_t>;
+				static_assert(sizeof(KeyType) == sizeof(Unsigned), "ERROR: Radix sort only supports 32 and 64 bit floating point keys!");
+				Unsigned Bits;
+				std::memcpy(&Bits, &Key, sizeof(Bits));
+				const Unsigned Sign = Unsigned(1) << (sizeof(Unsigned) * 8 - 1);
+				return (Bits & Sign) != 0 ? static_cast<Unsigned>(~Bits) : static_cast<Unsigned>(Bits | Sign);
+			}
+			else {
+				using Unsigned = std::make_unsigned_t<KeyType>;
+				if constexpr (std::is_signed_v<KeyType>) {
+					return static_cast<Unsigned>(static_cast<Unsigned>(Key) ^ (Unsigned(1) << (sizeof(Unsigned) * 8 - 1)));
+				}
+				else {
+					return static_cast<Unsigned>(Key);
+				}
+			}
+		}
+
 	public:
 
 		// COMPARER
@@ -116,12 +306,35 @@ namespace Toolbox {
 			return Left > Right;
 		}
 
+		/** A comparer that sorts in ascending order using the > operator, which can be inlined unlike a function pointer. */
+		struct Greater final {
+
+			/** Returns whether the left element is greater than the right element. */
+			template<typename Type>
+			bool operator()(const Type& Left, const Type& Right) const {
+				return Left > Right;
+			}
+		};
+
+		/** A comparer that sorts in descending order using the < operator, which can be inlined unlike a function pointer. */
+		struct Less final {
+
+			/** Returns whether the left element is less than the right element. */
+			template<typename Type>
+			bool operator()(const Type& Left, const Type& Right) const {
+				return Left < Right;
+			}
+		};
+
 
 		// SORTING
 
 		/** Returns whether the collection is sorted using the collection Type's > operator. */
 		template <typename CollectionType, typename Type>
 		static bool IsSorted(const size_t Size, const CollectionType& Collection, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
+			if (Size < 2) {
+				return true;
+			}
 			for (size_t Index = 0; Index < Size - 1; ++Index) {
 				if (Comparer(Collection[Index], Collection[Index + 1])) {
 					return false;
@@ -133,6 +346,9 @@ namespace Toolbox {
 		/** Bubble sorts the collection using the collection Type's > operator. */
 		template <typename CollectionType, typename Type>
 		static void BubbleSort(const size_t Size, CollectionType& Collection, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
+			if (Size < 2) {
+				return;
+			}
 			for (size_t Left = 0; Left < Size - 1; ++Left) {
 				bool HasSwapped = false;
 				for (size_t Right = 0; Right < Size - Left - 1; ++Right) {
@@ -152,13 +368,132 @@ namespace Toolbox {
 		/** Merge sorts the collection using the collection Type's > operator. */
 		template <typename CollectionType, typename Type>
 		static void MergeSort(const size_t Size, CollectionType& Collection, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
-			RecursiveMergeSort<CollectionType, Type>(Collection, 0, Size - 1, Comparer);
+			if (Size < 2) {
+				return;
+			}
+			Type* Buffer = new Type[(Size + 1) / 2];
+			RecursiveMergeSort<CollectionType, Type>(Collection, 0, Size - 1, Buffer, Comparer);
+			delete[] Buffer;
 		}
 
 		/** Quick sorts the collection using the collection Type's > operator. */
 		template <typename CollectionType, typename Type>
 		static void QuickSort(const size_t Size, CollectionType& Collection, bool(*Comparer)(const Type&, const Type&) = GreaterThan) {
+			if (Size < 2) {
+				return;
+			}
 			RecursiveQuickSort<CollectionType, Type>(Collection, 0, Size - 1, Comparer);
 		}
+
+
+		// HYBRID SORTING
+
+		/**
+		 * Sorts the given contiguous range in O(n log n) with an introspective quick sort that is not stable.<br/>
+		 * Pivots are chosen from three or nine elements, small ranges are insertion sorted, and heap sort prevents quadratic worst cases.<br/>
+		 * The comparer returns whether the left element belongs after the right element and may be any callable, so it can be inlined.
+		 */
+		template<typename Type, typename ComparerType = Greater>
+		static void IntroSort(Type* Begin, Type* End, ComparerType Comparer = ComparerType()) {
+			if (End - Begin < 2) {
+				return;
+			}
+			size_t Depth = 0;
+			for (size_t Count = static_cast<size_t>(End - Begin); Count > 1; Count >>= 1) {
+				Depth += 2;
+			}
+			RecursiveIntroSort(Begin, End, Depth, Comparer);
+		}
+
+		/**
+		 * Stably sorts the given contiguous range in O(n log n) with a bottom up merge sort.<br/>
+		 * Insertion sorted runs are merged back and forth between the range and a single buffer allocated once for the whole sort.<br/>
+		 * The comparer returns whether the left element belongs after the right element and may be any callable, so it can be inlined.
+		 */
+		template<typename Type, typename ComparerType = Greater>
+		static void StableSort(Type* Begin, Type* End, ComparerType Comparer = ComparerType()) {
+			const size_t Count = static_cast<size_t>(End - Begin);
+			if (Count <= SORT_INSERTION_THRESHOLD) {
+				InsertionSort(Begin, End, Comparer);
+				return;
+			}
+			for (size_t Run = 0; Run < Count; Run += SORT_INSERTION_THRESHOLD) {
+				InsertionSort(Begin + Run, Begin + (Count - Run < SORT_INSERTION_THRESHOLD ? Count : Run + SORT_INSERTION_THRESHOLD), Comparer);
+			}
+			Type* Buffer = static_cast<Type*>(::operator new(sizeof(Type) * Count, std::align_val_t(alignof(Type))));
+			std::uninitialized_move(Begin, End, Buffer);
+			Type* Source = Buffer;
+			Type* Destination = Begin;
+			for (size_t Width = SORT_INSERTION_THRESHOLD; Width < Count; Width *= 2) {
+				for (size_t Left = 0; Left < Count; Left += Width * 2) {
+					const size_t Middle = Left + Width < Count ? Left + Width : Count;
+					const size_t Right = Middle + Width < Count ? Middle + Width : Count;
+					if (Middle == Right || !Comparer(Source[Middle - 1], Source[Middle])) {
+						std::move(Source + Left, Source + Right, Destination + Left);
+					}
+					else {
+						MergeInto(Source, Left, Middle, Right, Destination, Comparer);
+					}
+				}
+				std::swap(Source, Destination);
+			}
+			if (Source != Begin) {
+				std::move(Buffer, Buffer + Count, Begin);
+			}
+			std::destroy(Buffer, Buffer + Count);
+			::operator delete(Buffer, std::align_val_t(alignof(Type)));
+		}
+
+		/**
+		 * Stably sorts the given contiguous range in ascending order of the integer or floating point key returned for each element.<br/>
+		 * This is a least significant digit radix sort that runs in O(n) per key byte and skips bytes every key shares.
+		 */
+		template<typename Type, typename KeyFunctionType>
+		static void RadixSort(Type* Begin, Type* End, KeyFunctionType Key) {
+			const size_t Count = static_cast<size_t>(End - Begin);
+			if (Count < 2) {
+				return;
+			}
+			using Unsigned = decltype(RadixKey(Key(*Begin)));
+			constexpr size_t BYTES = sizeof(Unsigned);
+			size_t Histograms[BYTES][256] = {};
+			for (Type* Current = Begin; Current < End; ++Current) {
+				const Unsigned Bits = RadixKey(Key(*Current));
+				for (size_t Byte = 0; Byte < BYTES; ++Byte) {
+					++Histograms[Byte][(Bits >> (Byte * 8)) & 0xFF];
+				}
+			}
+			Type* Buffer = static_cast<Type*>(::operator new(sizeof(Type) * Count, std::align_val_t(alignof(Type))));
+			std::uninitialized_move(Begin, End, Buffer);
+			Type* Source = Buffer;
+			Type* Destination = Begin;
+			for (size_t Byte = 0; Byte < BYTES; ++Byte) {
+				size_t* Histogram = Histograms[Byte];
+				if (Histogram[(RadixKey(Key(*Source)) >> (Byte * 8)) & 0xFF] == Count) {
+					continue;
+				}
+				size_t Offset = 0;
+				for (size_t Digit = 0; Digit < 256; ++Digit) {
+					const size_t Total = Histogram[Digit];
+					Histogram[Digit] = Offset;
+					Offset += Total;
+				}
+				for (size_t Index = 0; Index < Count; ++Index) {
+					Destination[Histogram[(RadixKey(Key(Source[Index])) >> (Byte * 8)) & 0xFF]++] = std::move(Source[Index]);
+				}
+				std::swap(Source, Destination);
+			}
+			if (Source != Begin) {
+				std::move(Buffer, Buffer + Count, Begin);
+			}
+			std::destroy(Buffer, Buffer + Count);
+			::operator delete(Buffer, std::align_val_t(alignof(Type)));
+		}
+
+		/** Stably sorts the given contiguous range of integers or floating point numbers in ascending order with a radix sort. */
+		template<typename Type>
+		static void RadixSort(Type* Begin, Type* End) {
+			RadixSort(Begin, End, [](const Type& Value) { return Value; });
+		}
 	};
 }
@@ -3,7 +3,7 @@
 // by Kyle Furey
 
 #pragma once
-#include "List.h"
+#include "Vector.h"
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
@@ -16,8 +16,8 @@ namespace Toolbox {
 
 		// DATA
 
-		/** The underlying list managing this stack. */
-		List<Type> data;
+		/** The underlying vector managing this stack. */
+		Vector<Type> data;
 
 	public:
 
@@ -73,6 +73,11 @@ namespace Toolbox {
 			return data.Total(Value);
 		}
 
+		/** Returns the number of elements the stack can hold before reallocating. */
+		size_t Capacity() const {
+			return data.Capacity();
+		}
+
 		/** Returns whether the stack is empty. */
 		bool IsEmpty() const {
 			return data.IsEmpty();
@@ -89,31 +94,46 @@ namespace Toolbox {
 
 		// EXPANSION
 
-		/** Deallocates the stack. */
+		/** Destroys each element in the stack while keeping its memory. */
 		void Clear() {
 			data.Clear();
 		}
 
+		/** Ensures the stack can hold at least the given number of elements without reallocating. */
+		void Reserve(const size_t Capacity) {
+			if (Capacity > data.Capacity()) {
+				data.Resize(Capacity);
+			}
+		}
+
 		/** Pushes a copy of the given data to the front of the stack. */
 		void Push(const Type& Value) {
 			data.PushBack(Value);
 		}
 
-		/** Pushes a copy of the given data to the end of the stack. */
+		/** Pushes a copy of the given data to the end of the stack (this shifts every element). */
 		void PushLast(const Type& Value) {
 			data.PushFront(Value);
 		}
 
-		/** Pushes a new element with the given arguments to the front of the quue. */
+		/** Pushes a copy of each of the given elements to the front of the stack in order, so the last element is next. */
+		void PushRange(const size_t Size, const Type* Array) {
+			Reserve(data.Size() + Size);
+			for (size_t Index = 0; Index < Size; ++Index) {
+				data.PushBack(Array[Index]);
+			}
+		}
+
+		/** Pushes a new element with the given arguments to the front of the stack. */
 		template<typename... ArgumentTypes>
 		void Emplace(ArgumentTypes&&... Arguments) {
-			data.EmplaceBack(Arguments...);
+			data.EmplaceBack(std::forward<ArgumentTypes>(Arguments)...);
 		}
 
-		/** Pushes a new element with the given arguments to the end of the stack. */
+		/** Pushes a new element with the given arguments to the end of the stack (this shifts every element). */
 		template<typename... ArgumentTypes>
 		void EmplaceLast(ArgumentTypes&&... Arguments) {
-			data.EmplaceFront(Arguments...);
+			data.EmplaceFront(std::forward<ArgumentTypes>(Arguments)...);
 		}
 
 		/** Removes and returns the next element in the stack. */
@@ -121,21 +141,31 @@ namespace Toolbox {
 			if (data.IsEmpty()) {
 				throw std::runtime_error("ERROR: The stack is empty!");
 			}
-			Type back = data.Back();
+			Type back = std::move(data.Back());
 			data.PopBack();
 			return back;
 		}
 
-		/** Removes and returns the last element in the stack. */
+		/** Removes and returns the last element in the stack (this shifts every element). */
 		Type PopLast() {
 			if (data.IsEmpty()) {
 				throw std::runtime_error("ERROR: The stack is empty!");
 			}
-			Type front = data.Front();
+			Type front = std::move(data.Front());
 			data.PopFront();
 			return front;
 		}
 
+		/** Moves up to the given number of the next elements in the stack into the given array in order and returns the number moved. */
+		size_t PopInto(Type* Array, const size_t Count) {
+			const size_t Moved = Count < data.Size() ? Count : data.Size();
+			for (size_t Index = 0; Index < Moved; ++Index) {
+				Array[Index] = std::move(data.Back());
+				data.PopBack();
+			}
+			return Moved;
+		}
+
 
 		// TO STRING
 
@@ -155,15 +185,15 @@ namespace Toolbox {
 		}
 
 
-		// AS LIST
+		// AS VECTOR
 
-		/** Returns a reference to this stack's underlying list. */
-		List<Type>& AsList() {
+		/** Returns a reference to this stack's underlying vector. */
+		Vector<Type>& AsVector() {
 			return data;
 		}
 
-		/** Returns a constant reference to this stack's underlying list. */
-		const List<Type>& AsList() const {
+		/** Returns a constant reference to this stack's underlying vector. */
+		const Vector<Type>& AsVector() const {
 			return data;
 		}
 	};
@@ -0,0 +1,446 @@
+// .h
+// Batched State Machine Group Type
+// by Kyle Furey
+
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include "StateMachine.h"
+#include "Vector.h"
+#include "ThreadPool.h"
+
+// Declares a new batched state with the given type and name.
+// The state's batch of state machines is stored as "Batch".
+#define DECLARE_BATCH_STATE(Type, Name) static void Name(Toolbox::StateBatch<Type>& Batch)
+
+// Represents an invalid state machine handle in a group.
+#define INVALID_STATE_HANDLE SIZE_MAX
+
+// The default number of state machines in each chunk of a parallel tick.
+#define STATE_GROUP_GRAIN 256
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// STATE BATCH
+
+	/** A contiguous run of state machines in a group that are all in the same state. */
+	template<typename Type>
+	class StateBatch final {
+	public:
+
+		// STATE AND HANDLE
+
+		/**
+		 * Represents a single function that executes every state machine of a batch in its state at once.<br/>
+		 * This function takes a reference to the batch as its only parameter.<br/>
+		 * Machines stay in this state unless the function transitions them with Transition().
+		 */
+		using STATE = void (*)(StateBatch&);
+
+		/** A stable number used to represent an individual state machine in a group. */
+		using Handle = size_t;
+
+	private:
+
+		// DATA
+
+		/** The state every machine in this batch is in. */
+		STATE state;
+
+		/** The managed data of each machine in this batch. */
+		Type* data;
+
+		/** The handle of each machine in this batch. */
+		const Handle* handles;
+
+		/** The state each machine in this batch transitions into after the tick. */
+		STATE* next;
+
+		/** The number of machines in this batch. */
+		size_t size;
+
+	public:
+
+		// CONSTRUCTOR
+
+		/** Default constructor. */
+		StateBatch(const STATE State, Type* Data, const Handle* Handles, STATE* Next, const size_t Size) : state(State), data(Data), handles(Handles), next(Next), size(Size) {
+		}
+
+
+		// OPERATORS
+
+		/** Returns a reference to the managed data of the machine at the given index. */
+		Type& operator[](const size_t Index) {
+			return data[Index];
+		}
+
+		/** Returns a constant reference to the managed data of the machine at the given index. */
+		const Type& operator[](const size_t Index) const {
+			return data[Index];
+		}
+
+
+		// ITERATORS
+
+		/** Returns an iterator to the managed data of the first machine in this batch. */
+		Type* begin() {
+			return data;
+		}
+
+		/** Returns a constant iterator to the managed data of the first machine in this batch. */
+		const Type* begin() const {
+			return data;
+		}
+
+		/** Returns an iterator after the managed data of the last machine in this batch. */
+		Type* end() {
+			return data + size;
+		}
+
+		/** Returns a constant iterator after the managed data of the last machine in this batch. */
+		const Type* end() const {
+			return data + size;
+		}
+
+
+		// GETTERS
+
+		/** Returns the state every machine in this batch is in. */
+		STATE State() const {
+			return state;
+		}
+
+		/** Returns the number of machines in this batch. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns the managed data of each machine in this batch as one contiguous array. */
+		Type* Data() {
+			return data;
+		}
+
+		/** Returns the handle of the machine at the given index. */
+		Handle HandleOf(const size_t Index) const {
+			return handles[Index];
+		}
+
+		/** Returns the state the machine at the given index will be in after the tick. */
+		STATE Next(const size_t Index) const {
+			return next[Index];
+		}
+
+
+		// TRANSITIONS
+
+		/** Moves the machine at the given index into the given state once every state of the tick has executed. */
+		void Transition(const size_t Index, const STATE NewState) {
+			next[Index] = NewState;
+		}
+	};
+
+
+	// STATE MACHINE GROUP
+
+	/**
+	 * A collection of many state machines whose data is stored contiguously by their current state.<br/>
+	 * Each tick executes each state's function once over every machine in that state, then moves machines that transitioned in bulk.<br/>
+	 * Machines in NULL_STATE are kept but never executed. Handles stay valid until their machine is erased, after which they may be reused.
+	 */
+	template<typename Type>
+	class StateMachineGroup final {
+	public:
+
+		// STATE AND HANDLE
+
+		/** Represents a single function that executes every state machine of a batch in its state at once. */
+		using STATE = typename StateBatch<Type>::STATE;
+
+		/** A stable number used to represent an individual state machine in this group. */
+		using Handle = typename StateBatch<Type>::Handle;
+
+	private:
+
+		// BUCKET
+
+		/** The machines in one state, with each machine's data, handle, and next state in their own arrays. */
+		struct Bucket final {
+
+			// DATA
+
+			/** The state of each machine in this bucket. */
+			STATE State;
+
+			/** The managed data of each machine in this bucket. */
+			Vector<Type> Data;
+
+			/** The handle of each machine in this bucket. */
+			Vector<Handle> Handles;
+
+			/** The state each machine in this bucket transitions into after the current tick. */
+			Vector<STATE> Next;
+
+
+			// CONSTRUCTOR
+
+			/** Default constructor. */
+			Bucket(const STATE State = NULL_STATE) : State(State), Data(), Handles(), Next() {
+			}
+		};
+
+
+		// LOCATION
+
+		/** Where a handle's machine is currently stored. */
+		struct Location final {
+
+			// DATA
+
+			/** The index of the bucket the machine is stored in, or INVALID_STATE_HANDLE if the handle is unused. */
+			size_t BucketIndex;
+
+			/** The index of the machine within its bucket. */
+			size_t Index;
+		};
+
+
+		// DATA
+
+		/** Each state's bucket of machines. */
+		Vector<Bucket> buckets;
+
+		/** Where each handle's machine is stored. */
+		Vector<Location> locations;
+
+		/** Each handle that was erased and can be reused. */
+		Vector<Handle> free;
+
+		/** The number of machines in this group. */
+		size_t size;
+
+
+		// BUCKETS
+
+		/** Returns the index of the given state's bucket, adding the bucket if it does not exist. */
+		size_t BucketOf(const STATE State) {
+			for (size_t Index = 0; Index < buckets.Size(); ++Index) {
+				if (buckets[Index].State == State) {
+					return Index;
+				}
+			}
+			buckets.EmplaceBack(State);
+			return buckets.Size() - 1;
+		}
+
+		/** Moves the machine at the given index of the given bucket to the end of the given destination bucket, filling its place with the bucket's last machine. */
+		void Move(const size_t From, const size_t Index, const size_t To) {
+			Bucket& Source = buckets[From];
+			Bucket& Destination = buckets[To];
+			const Handle Moved = Source.Handles[Index];
+			Destination.Data.PushBack(std::move(Source.Data[Index]));
+			Destination.Handles.PushBack(Moved);
+			Destination.Next.PushBack(Destination.State);
+			locations[Moved] = Location{ To, Destination.Handles.Size() - 1 };
+			Remove(From, Index);
+		}
+
+		/** Removes the machine at the given index of the given bucket, filling its place with the bucket's last machine. */
+		void Remove(const size_t From, const size_t Index) {
+			Bucket& Source = buckets[From];
+			const size_t Last = Source.Handles.Size() - 1;
+			if (Index != Last) {
+				Source.Data[Index] = std::move(Source.Data[Last]);
+				Source.Handles[Index] = Source.Handles[Last];
+				Source.Next[Index] = Source.Next[Last];
+				locations[Source.Handles[Index]].Index = Index;
+			}
+			Source.Data.PopBack();
+			Source.Handles.PopBack();
+			Source.Next.PopBack();
+		}
+
+		/** Moves every machine that transitioned during the tick into its new state's bucket. */
+		void Apply() {
+			for (size_t From = 0; From < buckets.Size(); ++From) {
+				size_t Index = 0;
+				while (Index < buckets[From].Handles.Size()) {
+					const STATE Next = buckets[From].Next[Index];
+					if (Next == buckets[From].State) {
+						++Index;
+						continue;
+					}
+					Move(From, Index, BucketOf(Next));
+				}
+			}
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		StateMachineGroup() : buckets(), locations(), free(), size(0) {
+		}
+
+		/** Copy constructor. */
+		StateMachineGroup(const StateMachineGroup& Copied) = default;
+
+		/** Move constructor. */
+		StateMachineGroup(StateMachineGroup&& Moved) noexcept = default;
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		StateMachineGroup& operator=(const StateMachineGroup& Copied) = default;
+
+		/** Move assignment operator. */
+		StateMachineGroup& operator=(StateMachineGroup&& Moved) noexcept = default;
+
+
+		// GETTERS
+
+		/** Returns the number of machines in this group. */
+		size_t Size() const {
+			return size;
+		}
+
+		/** Returns whether this group has no machines. */
+		bool IsEmpty() const {
+			return size == 0;
+		}
+
+		/** Returns whether the given handle represents a machine in this group. */
+		bool Contains(const Handle Machine) const {
+			return Machine < locations.Size() && locations[Machine].BucketIndex != INVALID_STATE_HANDLE;
+		}
+
+		/** Returns the number of machines in the given state. */
+		size_t Total(const STATE State) const {
+			for (auto& Bucket : buckets) {
+				if (Bucket.State == State) {
+					return Bucket.Handles.Size();
+				}
+			}
+			return 0;
+		}
+
+		/** Returns the current state of the given machine, or NULL_STATE if it is not in this group. */
+		STATE State(const Handle Machine) const {
+			return Contains(Machine) ? buckets[locations[Machine].BucketIndex].State : NULL_STATE;
+		}
+
+		/** Returns a pointer to the managed data of the given machine, or nullptr if it is not in this group (invalidated by adding, erasing, switching, or ticking). */
+		Type* Find(const Handle Machine) {
+			return Contains(Machine) ? &buckets[locations[Machine].BucketIndex].Data[locations[Machine].Index] : nullptr;
+		}
+
+		/** Returns a constant pointer to the managed data of the given machine, or nullptr if it is not in this group (invalidated by adding, erasing, switching, or ticking). */
+		const Type* Find(const Handle Machine) const {
+			return Contains(Machine) ? &buckets[locations[Machine].BucketIndex].Data[locations[Machine].Index] : nullptr;
+		}
+
+
+		// MACHINES
+
+		/** Adds a new machine with a copy of the given data in the given state and returns its handle. */
+		Handle Add(const Type& Data = Type(), const STATE StartingState = NULL_STATE) {
+			Handle Machine;
+			if (!free.IsEmpty()) {
+				Machine = free.Back();
+				free.PopBack();
+			}
+			else {
+				Machine = locations.Size();
+				locations.PushBack(Location{ INVALID_STATE_HANDLE, 0 });
+			}
+			const size_t Index = BucketOf(StartingState);
+			Bucket& Bucket = buckets[Index];
+			Bucket.Data.PushBack(Data);
+			Bucket.Handles.PushBack(Machine);
+			Bucket.Next.PushBack(StartingState);
+			locations[Machine] = Location{ Index, Bucket.Handles.Size() - 1 };
+			++size;
+			return Machine;
+		}
+
+		/** Adds a new machine with a copy of the given data in the given state and returns its handle. */
+		Handle Add(const STATE StartingState, const Type& Data = Type()) {
+			return Add(Data, StartingState);
+		}
+
+		/** Removes the given machine from this group and returns whether it was found. */
+		bool Erase(const Handle Machine) {
+			if (!Contains(Machine)) {
+				return false;
+			}
+			const Location Found = locations[Machine];
+			Remove(Found.BucketIndex, Found.Index);
+			locations[Machine].BucketIndex = INVALID_STATE_HANDLE;
+			free.PushBack(Machine);
+			--size;
+			return true;
+		}
+
+		/**
+		 * Forcefully switches the given machine's current state to the given state and returns whether it was found.<br/>
+		 * NOTE: This does not execute the new state.
+		 */
+		bool Switch(const Handle Machine, const STATE NewState) {
+			if (!Contains(Machine)) {
+				return false;
+			}
+			const Location Found = locations[Machine];
+			if (buckets[Found.BucketIndex].State != NewState) {
+				Move(Found.BucketIndex, Found.Index, BucketOf(NewState));
+			}
+			return true;
+		}
+
+		/** Removes every machine from this group. */
+		void Clear() {
+			buckets.Clear();
+			locations.Clear();
+			free.Clear();
+			size = 0;
+		}
+
+
+		// EXECUTION
+
+		/**
+		 * Executes each state once over every machine in that state, then moves each machine that transitioned into its new state.<br/>
+		 * Machines that transition are not executed again until the next tick.
+		 */
+		void Tick() {
+			for (auto& Bucket : buckets) {
+				if (Bucket.State == NULL_STATE || Bucket.Handles.IsEmpty()) {
+					continue;
+				}
+				StateBatch<Type> Batch(Bucket.State, Bucket.Data.begin(), Bucket.Handles.begin(), Bucket.Next.begin(), Bucket.Handles.Size());
+				Bucket.State(Batch);
+			}
+			Apply();
+		}
+
+		/**
+		 * Executes each state over chunks of its machines across the given pool's threads, then moves each machine that transitioned into its new state.<br/>
+		 * Each call to a state receives one chunk, so states must only write to the machines in their own batch.
+		 */
+		void Tick(ThreadPool& Pool, const size_t Grain = STATE_GROUP_GRAIN) {
+			for (auto& Bucket : buckets) {
+				if (Bucket.State == NULL_STATE || Bucket.Handles.IsEmpty()) {
+					continue;
+				}
+				Pool.ParallelFor(0, Bucket.Handles.Size(), Grain, [&Bucket](const size_t First, const size_t Last) {
+					StateBatch<Type> Batch(Bucket.State, Bucket.Data.begin() + First, Bucket.Handles.begin() + First, Bucket.Next.begin() + First, Last - First);
+					Bucket.State(Batch);
+				});
+			}
+			Apply();
+		}
+	};
+}
@@ -0,0 +1,364 @@
+// .h
+// Statistics Types
+// by Kyle Furey
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+// Whether containers count their allocations, growth, rehashes, lookups, and searches (off by default, so counting compiles away).
+#ifndef TOOLBOX_STATS
+#define TOOLBOX_STATS 0
+#endif
+
+// The number of lengths a histogram counts, where the last length also counts every longer length.
+#define STATS_HISTOGRAM_SIZE 16
+
+// Adds the given amount to the given counter of the given kind of container, or does nothing when statistics are disabled.
+#if TOOLBOX_STATS
+#define TOOLBOX_COUNT(Kind, Counter, Amount) (::Toolbox::Stats::Kind.Counter.fetch_add(static_cast<size_t>(Amount), std::memory_order_relaxed))
+#else
+#define TOOLBOX_COUNT(Kind, Counter, Amount) static_cast<void>(sizeof(Amount))
+#endif
+
+// Counts one lookup of the given kind of container that compared the given number of elements.
+#define TOOLBOX_COUNT_LOOKUP(Kind, Count) (TOOLBOX_COUNT(Kind, Lookups, 1), TOOLBOX_COUNT(Kind, Probes, Count))
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	// CONTAINER STATISTICS
+
+	/**
+	 * Counters shared by every instance of one kind of container, which are only updated when TOOLBOX_STATS is enabled.<br/>
+	 * Counters are updated atomically without ordering, so they may be read while other threads use containers.
+	 */
+	struct ContainerStats final {
+
+		// DATA
+
+		/** The name of the kind of container these statistics count. */
+		const char* Name;
+
+		/** The number of blocks of memory allocated. */
+		std::atomic<size_t> Allocations;
+
+		/** The total number of bytes allocated. */
+		std::atomic<size_t> AllocatedBytes;
+
+		/** The number of blocks of memory deallocated. */
+		std::atomic<size_t> Deallocations;
+
+		/** The total number of bytes deallocated. */
+		std::atomic<size_t> DeallocatedBytes;
+
+		/** The number of times a container's memory grew. */
+		std::atomic<size_t> Growths;
+
+		/** The number of times a hash table's buckets were rebuilt. */
+		std::atomic<size_t> Rehashes;
+
+		/** The number of lookups by key. */
+		std::atomic<size_t> Lookups;
+
+		/** The total number of elements compared by every lookup. */
+		std::atomic<size_t> Probes;
+
+		/** The number of path searches. */
+		std::atomic<size_t> Searches;
+
+		/** The total number of nodes expanded by every path search. */
+		std::atomic<size_t> Expanded;
+
+
+		// CONSTRUCTORS
+
+		/** Name constructor. */
+		explicit ContainerStats(const char* Kind) : Name(Kind), Allocations(0), AllocatedBytes(0), Deallocations(0), DeallocatedBytes(0), Growths(0), Rehashes(0), Lookups(0), Probes(0), Searches(0), Expanded(0) {
+		}
+
+		/** Delete copy constructor. */
+		ContainerStats(const ContainerStats& Copied) = delete;
+
+		/** Delete move constructor. */
+		ContainerStats(ContainerStats&& Moved) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		ContainerStats& operator=(const ContainerStats& Copied) = delete;
+
+		/** Delete move assignment operator. */
+		ContainerStats& operator=(ContainerStats&& Moved) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of allocated blocks of memory that have not been deallocated. */
+		size_t Live() const {
+			const size_t Allocated = Allocations.load(std::memory_order_relaxed), Deallocated = Deallocations.load(std::memory_order_relaxed);
+			return Allocated > Deallocated ? Allocated - Deallocated : 0;
+		}
+
+		/** Returns the number of allocated bytes that have not been deallocated. */
+		size_t LiveBytes() const {
+			const size_t Allocated = AllocatedBytes.load(std::memory_order_relaxed), Deallocated = DeallocatedBytes.load(std::memory_order_relaxed);
+			return Allocated > Deallocated ? Allocated - Deallocated : 0;
+		}
+
+		/** Returns the average number of elements each lookup compared, or 0 if there were no lookups. */
+		double AverageProbes() const {
+			const size_t Count = Lookups.load(std::memory_order_relaxed);
+			return Count > 0 ? static_cast<double>(Probes.load(std::memory_order_relaxed)) / static_cast<double>(Count) : 0;
+		}
+
+		/** Returns the average number of nodes each path search expanded, or 0 if there were no searches. */
+		double AverageExpanded() const {
+			const size_t Count = Searches.load(std::memory_order_relaxed);
+			return Count > 0 ? static_cast<double>(Expanded.load(std::memory_order_relaxed)) / static_cast<double>(Count) : 0;
+		}
+
+
+		// EXPANSION
+
+		/** Resets each counter to 0. */
+		void Reset() {
+			for (std::atomic<size_t>* Counter : { &Allocations, &AllocatedBytes, &Deallocations, &DeallocatedBytes, &Growths, &Rehashes, &Lookups, &Probes, &Searches, &Expanded }) {
+				Counter->store(0, std::memory_order_relaxed);
+			}
+		}
+
+
+		// TO STRING
+
+		/** Returns these statistics as a string, leaving out counters that are 0. */
+		std::string ToString() const {
+			std::string String = std::string(Name) + ":";
+			const auto Append = [&String](const char* Label, const size_t Value) {
+				if (Value > 0) {
+					String += std::string(" ") + Label + " " + std::to_string(Value);
+				}
+			};
+			Append("allocations", Allocations.load(std::memory_order_relaxed));
+			Append("allocated_bytes", AllocatedBytes.load(std::memory_order_relaxed));
+			Append("deallocations", Deallocations.load(std::memory_order_relaxed));
+			Append("deallocated_bytes", DeallocatedBytes.load(std::memory_order_relaxed));
+			Append("live_bytes", LiveBytes());
+			Append("growths", Growths.load(std::memory_order_relaxed));
+			Append("rehashes", Rehashes.load(std::memory_order_relaxed));
+			Append("lookups", Lookups.load(std::memory_order_relaxed));
+			if (Lookups.load(std::memory_order_relaxed) > 0) {
+				String += " average_probes " + std::to_string(AverageProbes());
+			}
+			Append("searches", Searches.load(std::memory_order_relaxed));
+			if (Searches.load(std::memory_order_relaxed) > 0) {
+				String += " average_expanded " + std::to_string(AverageExpanded());
+			}
+			return String;
+		}
+	};
+
+
+	// STATISTICS
+
+	/**
+	 * The statistics of each kind of instrumented container, which count nothing unless TOOLBOX_STATS is defined as 1 before including the Toolbox.<br/>
+	 * Counters are shared by every instance of a kind of container, while Map, Set, and Tree also report the shape of one instance through Statistics().
+	 */
+	class Stats final {
+	public:
+
+		// DATA
+
+		/** Whether statistics are counted. */
+		static constexpr bool Enabled = TOOLBOX_STATS != 0;
+
+		/** The statistics of every vector, counting heap allocations and growth. */
+		static inline ContainerStats Vector{ "Vector" };
+
+		/** The statistics of every linked list, counting pooled node allocations. */
+		static inline ContainerStats List{ "List" };
+
+		/** The statistics of every hash map, counting rehashes and lookups. */
+		static inline ContainerStats Map{ "Map" };
+
+		/** The statistics of every hash set, counting rehashes and lookups. */
+		static inline ContainerStats Set{ "Set" };
+
+		/** The statistics of every tree, counting pooled pair and node allocations. */
+		static inline ContainerStats Tree{ "Tree" };
+
+		/** The statistics of every graph, counting path searches and the nodes they expanded. */
+		static inline ContainerStats Graph{ "Graph" };
+
+
+		// CONSTRUCTORS
+
+		/** Delete default constructor. */
+		Stats() = delete;
+
+
+		// GETTERS
+
+		/** Calls the given function with each kind of container's statistics. */
+		template<typename FunctionType>
+		static void ForEach(FunctionType Function) {
+			for (ContainerStats* Kind : { &Vector, &List, &Map, &Set, &Tree, &Graph }) {
+				Function(*Kind);
+			}
+		}
+
+
+		// EXPANSION
+
+		/** Resets every counter of every kind of container to 0. */
+		static void Reset() {
+			ForEach([](ContainerStats& Kind) { Kind.Reset(); });
+		}
+
+
+		// TO STRING
+
+		/** Returns the statistics of each kind of container as a string, one kind per line. */
+		static std::string ToString() {
+			std::string String = Enabled ? "" : "Toolbox statistics are disabled (define TOOLBOX_STATS as 1 to enable them).\n";
+			ForEach([&String](const ContainerStats& Kind) { String += Kind.ToString() + "\n"; });
+			return String;
+		}
+
+		/** Writes the statistics of each kind of container to the given stream, one kind per line. */
+		static void Dump(std::ostream& Stream) {
+			Stream << ToString();
+		}
+	};
+
+
+	// TABLE STATISTICS
+
+	/** A snapshot of how evenly the elements of one hash table are spread across its buckets. */
+	struct TableStats final {
+
+		// DATA
+
+		/** The number of elements in the table. */
+		size_t Size = 0;
+
+		/** The number of buckets in the table. */
+		size_t Buckets = 0;
+
+		/** The number of buckets with no elements. */
+		size_t Empty = 0;
+
+		/** The number of elements in the longest bucket. */
+		size_t Longest = 0;
+
+		/** The total number of elements compared when finding each element once. */
+		size_t Probes = 0;
+
+		/** The number of buckets of each length, where the last length also counts every longer bucket. */
+		size_t Histogram[STATS_HISTOGRAM_SIZE] = {};
+
+
+		// EXPANSION
+
+		/** Counts a bucket of the given length. */
+		void Add(const size_t Length) {
+			Size += Length;
+			++Buckets;
+			Empty += Length == 0;
+			Longest = Length > Longest ? Length : Longest;
+			Probes += Length * (Length + 1) / 2;
+			++Histogram[Length < STATS_HISTOGRAM_SIZE ? Length : STATS_HISTOGRAM_SIZE - 1];
+		}
+
+
+		// GETTERS
+
+		/** Returns the average number of elements per bucket. */
+		double LoadFactor() const {
+			return Buckets > 0 ? static_cast<double>(Size) / static_cast<double>(Buckets) : 0;
+		}
+
+		/** Returns the average number of elements compared when finding an element in the table. */
+		double AverageProbes() const {
+			return Size > 0 ? static_cast<double>(Probes) / static_cast<double>(Size) : 0;
+		}
+
+
+		// TO STRING
+
+		/** Returns these statistics as a string, with the histogram listed as length:buckets for each length with buckets. */
+		std::string ToString() const {
+			std::string String = "size " + std::to_string(Size) + " buckets " + std::to_string(Buckets) + " empty " + std::to_string(Empty) +
+				" longest " + std::to_string(Longest) + " load_factor " + std::to_string(LoadFactor()) + " average_probes " + std::to_string(AverageProbes()) + " histogram";
+			for (size_t Length = 0; Length < STATS_HISTOGRAM_SIZE; ++Length) {
+				if (Histogram[Length] > 0) {
+					String += " " + std::to_string(Length) + (Length == STATS_HISTOGRAM_SIZE - 1 ? "+:" : ":") + std::to_string(Histogram[Length]);
+				}
+			}
+			return String;
+		}
+	};
+
+
+	// TREE STATISTICS
+
+	/** A snapshot of the shape of one tree's nodes. */
+	struct TreeStats final {
+
+		// DATA
+
+		/** The number of nodes in the tree, including the root. */
+		size_t Nodes = 0;
+
+		/** The number of nodes that have not been divided. */
+		size_t Leaves = 0;
+
+		/** The number of pairs stored in the tree. */
+		size_t Pairs = 0;
+
+		/** The depth of the deepest node, where the root is at depth 0. */
+		size_t Depth = 0;
+
+		/** The number of nodes storing each number of pairs, where the last number also counts every fuller node. */
+		size_t Occupancy[STATS_HISTOGRAM_SIZE] = {};
+
+
+		// EXPANSION
+
+		/** Counts a node at the given depth storing the given number of pairs. */
+		void Add(const size_t NodeDepth, const size_t Count, const bool Leaf) {
+			++Nodes;
+			Leaves += Leaf;
+			Pairs += Count;
+			Depth = NodeDepth > Depth ? NodeDepth : Depth;
+			++Occupancy[Count < STATS_HISTOGRAM_SIZE ? Count : STATS_HISTOGRAM_SIZE - 1];
+		}
+
+
+		// GETTERS
+
+		/** Returns the average number of pairs stored per leaf node. */
+		double AverageOccupancy() const {
+			return Leaves > 0 ? static_cast<double>(Pairs) / static_cast<double>(Leaves) : 0;
+		}
+
+
+		// TO STRING
+
+		/** Returns these statistics as a string, with the occupancy listed as pairs:nodes for each number of pairs with nodes. */
+		std::string ToString() const {
+			std::string String = "nodes " + std::to_string(Nodes) + " leaves " + std::to_string(Leaves) + " pairs " + std::to_string(Pairs) +
+				" depth " + std::to_string(Depth) + " average_occupancy " + std::to_string(AverageOccupancy()) + " occupancy";
+			for (size_t Count = 0; Count < STATS_HISTOGRAM_SIZE; ++Count) {
+				if (Occupancy[Count] > 0) {
+					String += " " + std::to_string(Count) + (Count == STATS_HISTOGRAM_SIZE - 1 ? "+:" : ":") + std::to_string(Occupancy[Count]);
+				}
+			}
+			return String;
+		}
+	};
+}
@@ -5,6 +5,8 @@
 #pragma once
 #include <iostream>
 #include "Vector.h"
+#include "Simd.h"
+#include "Hash.h"
 
 // Whether uppercase characters are greater than lowercase characters.
 #define UPPERCASE_GREATER ('A' > 'a')
@@ -15,6 +17,9 @@
 // A character that represents the end of a string.
 #define END_OF_STRING 0
 
+// The number of characters (including the null terminator) a string stores inline before allocating.
+#define STRING_INLINE_CAPACITY 16
+
 // Declares a new std::to_string implementation with the given parameter.
 #define DECLARE_TO_STRING(Parameter) namespace std { static std::string to_string(Parameter); }\
 static std::string std::to_string(Parameter)
@@ -97,6 +102,9 @@ namespace Toolbox {
 		if (String == nullptr) {
 			return 0;
 		}
+		if constexpr (sizeof(CharacterType) == 1) {
+			return SimdLength(reinterpret_cast<const char*>(String));
+		}
 		size_t Index = 0;
 		while (String[Index] != END_OF_STRING) {
 			++Index;
@@ -105,6 +113,400 @@ namespace Toolbox {
 	}
 
 
+	// BASIC STRING VIEW
+
+	/**
+	 * Represents a non-owning, read-only window into a sequence of characters.<br/>
+	 * Views never allocate, so searching, splitting, and trimming them is free of copies.<br/>
+	 * A view is only valid for as long as the characters it refers to.
+	 */
+	template<typename CharacterType = char>
+	class BasicStringView final {
+	public:
+
+		// CHARACTER
+
+		/** An alias for one of this view's "characters". */
+		using Char = CharacterType;
+
+	private:
+
+		// VIEW
+
+		/** An alias for this view. */
+		using View = BasicStringView;
+
+
+		// DATA
+
+		/** A pointer to the first character of this view. */
+		const Char* data;
+
+		/** The number of characters in this view. */
+		size_t length;
+
+
+		// BYTES
+
+		/** Whether this view's characters are single bytes that can use the vectorized byte kernels. */
+		static constexpr bool BYTES = sizeof(Char) == 1;
+
+		/** Returns this view's characters as bytes. */
+		const char* Bytes() const {
+			return reinterpret_cast<const char*>(data);
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		BasicStringView() : data(nullptr), length(0) {
+		}
+
+		/** C string constructor. */
+		BasicStringView(const Char* String) : data(String), length(CStringLength<Char>(String)) {
+		}
+
+		/** Array constructor. */
+		BasicStringView(const Char* Array, const size_t Length) : data(Array), length(Length) {
+		}
+
+		/** Standard string constructor. */
+		BasicStringView(const std::basic_string<Char>& String) : data(String.c_str()), length(String.length()) {
+		}
+
+
+		// OPERATORS
+
+		/** Returns a copy of the character at the given index. */
+		Char operator[](const size_t Index) const {
+#if !TOOLBOX_UNCHECKED
+			if (Index >= length) {
+				ThrowOutOfBounds(Index, "string view", length, "length");
+			}
+#endif
+			return data[Index];
+		}
+
+		/** View equality operator. */
+		bool operator==(const View Other) const {
+			return Compare(Other) == 0;
+		}
+
+		/** View inequality operator. */
+		bool operator!=(const View Other) const {
+			return Compare(Other) != 0;
+		}
+
+		/** View less than operator. */
+		bool operator<(const View Other) const {
+			return Compare(Other) < 0;
+		}
+
+		/** View greater than operator. */
+		bool operator>(const View Other) const {
+			return Compare(Other) > 0;
+		}
+
+		/** View less than or equal to operator. */
+		bool operator<=(const View Other) const {
+			return Compare(Other) <= 0;
+		}
+
+		/** View greater than or equal to operator. */
+		bool operator>=(const View Other) const {
+			return Compare(Other) >= 0;
+		}
+
+
+		// ITERATORS
+
+		/** Returns a constant pointer to the first character in the view. */
+		const Char* begin() const {
+			return data;
+		}
+
+		/** Returns a constant pointer to the character after the last character in the view. */
+		const Char* end() const {
+			return data + length;
+		}
+
+
+		// GETTERS
+
+		/** Returns the number of characters in the view. */
+		size_t Length() const {
+			return length;
+		}
+
+		/** Returns a constant pointer to the first character in the view (this is not null terminated). */
+		const Char* Data() const {
+			return data;
+		}
+
+		/** Returns whether the view is empty. */
+		bool IsEmpty() const {
+			return length == 0;
+		}
+
+		/** Returns whether the given index is a valid index in the view. */
+		bool IsValidIndex(const size_t Index) const {
+			return Index < length;
+		}
+
+		/** Returns a copy of the character at the given index, always checking its bounds. */
+		Char At(const size_t Index) const {
+			if (Index >= length) {
+				ThrowOutOfBounds(Index, "string view", length, "length");
+			}
+			return data[Index];
+		}
+
+		/** Returns a copy of the character at the given index without checking its bounds. */
+		Char Unchecked(const size_t Index) const {
+			return data[Index];
+		}
+
+		/** Returns a copy of the first character in the view. */
+		Char Front() const {
+			if (length == 0) {
+				ThrowEmpty("string view");
+			}
+			return data[0];
+		}
+
+		/** Returns a copy of the last character in the view. */
+		Char Back() const {
+			if (length == 0) {
+				ThrowEmpty("string view");
+			}
+			return data[length - 1];
+		}
+
+		/** Returns a negative number, zero, or a positive number if this view is less than, equal to, or greater than the given view. */
+		int Compare(const View Other) const {
+			const size_t Count = length < Other.length ? length : Other.length;
+			if constexpr (BYTES) {
+				const size_t Index = SimdMismatch(Bytes(), Other.Bytes(), Count);
+				if (Index != Count) {
+					return data[Index] < Other.data[Index] ? -1 : 1;
+				}
+				return length < Other.length ? -1 : (length > Other.length ? 1 : 0);
+			}
+			for (size_t Index = 0; Index < Count; ++Index) {
+				if (data[Index] != Other.data[Index]) {
+					return data[Index] < Other.data[Index] ? -1 : 1;
+				}
+			}
+			return length < Other.length ? -1 : (length > Other.length ? 1 : 0);
+		}
+
+		/** Returns whether the characters at and after the given index match the given view. */
+		bool Matches(const size_t Index, const View Other) const {
+			if (Index > length || Other.length > length - Index) {
+				return false;
+			}
+			if constexpr (BYTES) {
+				return SimdEquals(Bytes() + Index, Other.Bytes(), Other.length);
+			}
+			for (size_t Current = 0; Current < Other.length; ++Current) {
+				if (data[Index + Current] != Other.data[Current]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Returns the index of the first matching character at or after the given index, or -1 if no match is found. */
+		ptrdiff_t Find(const Char Character, const size_t Start = 0) const {
+			if constexpr (BYTES) {
+				return SimdFind(Bytes(), length, static_cast<char>(Character), Start);
+			}
+			for (size_t Index = Start; Index < length; ++Index) {
+				if (data[Index] == Character) {
+					return static_cast<ptrdiff_t>(Index);
+				}
+			}
+			return -1;
+		}
+
+		/** Returns the index of the first character of the first matching view at or after the given index, or -1 if no match is found. */
+		ptrdiff_t Find(const View Other, const size_t Start = 0) const {
+			if constexpr (BYTES) {
+				return SimdFindString(Bytes(), length, Other.Bytes(), Other.length, Start);
+			}
+			if (Other.length > length) {
+				return -1;
+			}
+			for (size_t Index = Start; Index <= length - Other.length; ++Index) {
+				if (Matches(Index, Other)) {
+					return static_cast<ptrdiff_t>(Index);
+				}
+			}
+			return -1;
+		}
+
+		/** Returns the index of the last matching character in the view, or -1 if no match is found. */
+		ptrdiff_t FindLast(const Char Character) const {
+			if constexpr (BYTES) {
+				return SimdFindLast(Bytes(), length, static_cast<char>(Character));
+			}
+			for (size_t Index = length; Index > 0; --Index) {
+				if (data[Index - 1] == Character) {
+					return static_cast<ptrdiff_t>(Index - 1);
+				}
+			}
+			return -1;
+		}
+
+		/** Returns the index of the first character of the last matching view in the view, or -1 if no match is found. */
+		ptrdiff_t FindLast(const View Other) const {
+			if (Other.length > length || Other.length == 0) {
+				return -1;
+			}
+			for (size_t Index = length - Other.length + 1; Index > 0; --Index) {
+				if (Matches(Index - 1, Other)) {
+					return static_cast<ptrdiff_t>(Index - 1);
+				}
+			}
+			return -1;
+		}
+
+		/** Returns whether the given character is present in the view. */
+		bool Contains(const Char Character) const {
+			return Find(Character) != -1;
+		}
+
+		/** Returns whether the given view is present in the view. */
+		bool Contains(const View Other) const {
+			return Find(Other) != -1;
+		}
+
+		/** Returns the total number of characters that match the given character in the view. */
+		size_t Total(const Char Character) const {
+			if constexpr (BYTES) {
+				return SimdCount(Bytes(), length, static_cast<char>(Character));
+			}
+			size_t Total = 0;
+			for (size_t Index = 0; Index < length; ++Index) {
+				if (data[Index] == Character) {
+					++Total;
+				}
+			}
+			return Total;
+		}
+
+		/** Returns whether this view begins with the given character. */
+		bool StartsWith(const Char Character) const {
+			return length > 0 && data[0] == Character;
+		}
+
+		/** Returns whether this view begins with the given view. */
+		bool StartsWith(const View Other) const {
+			return Matches(0, Other);
+		}
+
+		/** Returns whether this view ends with the given character. */
+		bool EndsWith(const Char Character) const {
+			return length > 0 && data[length - 1] == Character;
+		}
+
+		/** Returns whether this view ends with the given view. */
+		bool EndsWith(const View Other) const {
+			return Other.length <= length && Matches(length - Other.length, Other);
+		}
+
+
+		// VIEWS
+
+		/** Returns a view starting at the given index of this view with the given number of characters, clamped to the end of this view. */
+		View Substring(const size_t Index, const size_t Count = SIZE_MAX) const {
+			if (Index > length) {
+				ThrowOutOfBounds(Index, "string view", length, "length");
+			}
+			return View(data + Index, Count < length - Index ? Count : length - Index);
+		}
+
+		/** Returns a view of this view without any whitespace at its front. */
+		View TrimFront() const {
+			if constexpr (BYTES) {
+				const size_t Count = SimdSkipWhitespace(Bytes(), length);
+				return View(data + Count, length - Count);
+			}
+			size_t Index = 0;
+			while (Index < length && IsWhitespace<Char>(data[Index])) {
+				++Index;
+			}
+			return View(data + Index, length - Index);
+		}
+
+		/** Returns a view of this view without any whitespace at its back. */
+		View TrimBack() const {
+			if constexpr (BYTES) {
+				return View(data, length - SimdSkipWhitespaceBack(Bytes(), length));
+			}
+			size_t Length = length;
+			while (Length > 0 && IsWhitespace<Char>(data[Length - 1])) {
+				--Length;
+			}
+			return View(data, Length);
+		}
+
+		/** Returns a view of this view without any whitespace at either end. */
+		View Trim() const {
+			return TrimFront().TrimBack();
+		}
+
+		/**
+		 * Splits this view at the first occurrence of the given character.<br/>
+		 * The token before the delimiter is returned and this view is advanced past it, or the whole view is returned if there is no delimiter.
+		 */
+		View NextToken(const Char Delimiter) {
+			const ptrdiff_t Index = Find(Delimiter);
+			if (Index == -1) {
+				const View Token = *this;
+				data += length;
+				length = 0;
+				return Token;
+			}
+			const View Token(data, static_cast<size_t>(Index));
+			data += Index + 1;
+			length -= Index + 1;
+			return Token;
+		}
+
+		/** Appends a view of each token separated by the given character to the given vector and returns the number of tokens. */
+		template<size_t INLINE_CAPACITY>
+		size_t Split(const Char Delimiter, Vector<View, INLINE_CAPACITY>& Tokens) const {
+			size_t Count = 1;
+			size_t Start = 0;
+			for (ptrdiff_t Index = Find(Delimiter); Index != -1; Index = Find(Delimiter, Start)) {
+				Tokens.EmplaceBack(data + Start, static_cast<size_t>(Index) - Start);
+				Start = static_cast<size_t>(Index) + 1;
+				++Count;
+			}
+			Tokens.EmplaceBack(data + Start, length - Start);
+			return Count;
+		}
+
+		/** Returns a vector of views of each token separated by the given character. */
+		Vector<View> Split(const Char Delimiter) const {
+			Vector<View> Tokens;
+			Split(Delimiter, Tokens);
+			return Tokens;
+		}
+
+
+		// TO STRING
+
+		/** Returns a copy of this view as a standard string. */
+		std::basic_string<Char> ToString() const {
+			return std::basic_string<Char>(data, length);
+		}
+	};
+
+
 	// BASIC STRING
 
 	/** Represents a mutable sequence of data that can be iterated on and combined with other strings. */
@@ -117,6 +519,12 @@ namespace Toolbox {
 		/** An alias for one of this string's "characters". */
 		using Char = CharacterType;
 
+		/** An alias for a read-only view of this string's characters. */
+		using View = BasicStringView<Char>;
+
+		/** An alias for the vector of characters underlying this string (short strings are stored inline). */
+		using Storage = Vector<Char, STRING_INLINE_CAPACITY>;
+
 	private:
 
 		// STRING
@@ -128,7 +536,7 @@ namespace Toolbox {
 		// DATA
 
 		/** The underlying vector of characters in this string. */
-		Vector<Char> string;
+		Storage string;
 
 	public:
 
@@ -153,7 +561,17 @@ namespace Toolbox {
 		}
 
 		/** Vector constructor. */
-		BasicString(const Vector<Char>& Vector) : string(Vector) {
+		template<size_t INLINE_CAPACITY>
+		BasicString(const Vector<Char, INLINE_CAPACITY>& Vector) : string(Vector) {
+			Validate();
+		}
+
+		/** View constructor. */
+		BasicString(const View View) : string(View.Length() + 1) {
+			for (size_t Index = 0; Index < View.Length(); ++Index) {
+				string.Unchecked(Index) = View.Unchecked(Index);
+			}
+			string.Unchecked(View.Length()) = END_OF_STRING;
 			Validate();
 		}
 
@@ -173,7 +591,7 @@ namespace Toolbox {
 		}
 
 		/** Move constructor. */
-		BasicString(String&& Moved) noexcept : string(Moved.string) {
+		BasicString(String&& Moved) noexcept : string(std::move(Moved.string)) {
 			Moved.string.Clear();
 			Moved.string.PushBack(END_OF_STRING);
 			Validate();
@@ -194,13 +612,14 @@ namespace Toolbox {
 
 		/** C string assignment operator. */
 		String& operator=(const Char* String) {
-			string = Vector<Char>(CStringLength<Char>(String), String);
+			string = Storage(CStringLength<Char>(String), String);
 			Validate();
 			return *this;
 		}
 
 		/** Vector assignment operator. */
-		String& operator=(const Vector<Char>& Vector) {
+		template<size_t INLINE_CAPACITY>
+		String& operator=(const Vector<Char, INLINE_CAPACITY>& Vector) {
 			string = Vector;
 			Validate();
 			return *this;
@@ -208,7 +627,7 @@ namespace Toolbox {
 
 		/** Standard string assignment operator. */
 		String& operator=(const std::basic_string<Char>& String) {
-			string = Vector<Char>(String.length(), String.c_str());
+			string = Storage(String.length(), String.c_str());
 			Validate();
 			return *this;
 		}
@@ -228,7 +647,7 @@ namespace Toolbox {
 			if (this == &Moved) {
 				return *this;
 			}
-			string = Moved.string;
+			string = std::move(Moved.string);
 			Moved.string.Clear();
 			Moved.string.PushBack(END_OF_STRING);
 			Validate();
@@ -237,21 +656,13 @@ namespace Toolbox {
 
 		/** Null assignment operator. */
 		String& operator=(std::nullptr_t) {
-			string = Vector<Char>(1, END_OF_STRING);
+			string = Storage(1, END_OF_STRING);
 			return *this;
 		}
 
 		/** String equality operator. */
 		bool operator==(const String& Other) const {
-			if (Length() != Other.Size()) {
-				return false;
-			}
-			for (size_t Index = 0; Index < Other.Length(); ++Index) {
-				if (string[Index] != Other.string[Index]) {
-					return false;
-				}
-			}
-			return true;
+			return AsView() == Other.AsView();
 		}
 
 		/** String inequality operator. */
@@ -277,16 +688,7 @@ namespace Toolbox {
 			if (String == nullptr) {
 				return IsEmpty();
 			}
-			size_t Size = CStringLength(String);
-			if (Length() != Size) {
-				return false;
-			}
-			for (size_t Index = 0; Index < Size; ++Index) {
-				if (string[Index] != String[Index]) {
-					return false;
-				}
-			}
-			return true;
+			return AsView() == View(String);
 		}
 
 		/** C string inequality operator. */
@@ -294,8 +696,19 @@ namespace Toolbox {
 			return !(*this == String);
 		}
 
+		/** View equality operator. */
+		bool operator==(const View View) const {
+			return AsView() == View;
+		}
+
+		/** View inequality operator. */
+		bool operator!=(const View View) const {
+			return !(*this == View);
+		}
+
 		/** Vector equality operator. */
-		bool operator==(const Vector<Char>& Vector) const {
+		template<size_t INLINE_CAPACITY>
+		bool operator==(const Vector<Char, INLINE_CAPACITY>& Vector) const {
 			if (Length() != Vector.Size()) {
 				return false;
 			}
@@ -308,21 +721,14 @@ namespace Toolbox {
 		}
 
 		/** Vector inequality operator. */
-		bool operator!=(const Vector<Char>& Vector) const {
+		template<size_t INLINE_CAPACITY>
+		bool operator!=(const Vector<Char, INLINE_CAPACITY>& Vector) const {
 			return !(*this == Vector);
 		}
 
 		/** Standard string equality operator. */
 		bool operator==(const std::basic_string<Char>& String) const {
-			if (Length() != String.length()) {
-				return false;
-			}
-			for (size_t Index = 0; Index < String.length(); ++Index) {
-				if (string[Index] != String[Index]) {
-					return false;
-				}
-			}
-			return true;
+			return AsView() == View(String);
 		}
 
 		/** Standard string inequality operator. */
@@ -332,26 +738,22 @@ namespace Toolbox {
 
 		/** Returns a reference to the character at the given index. */
 		Char& operator[](const size_t Index) {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			return string[Index];
+#endif
+			return string.Unchecked(Index);
 		}
 
 		/** Returns a copy of the character at the given index. */
 		Char operator[](const size_t Index) const {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			return string[Index];
+#endif
+			return string.Unchecked(Index);
 		}
 
 		/** Returns a copy of this string with the given character appended. */
@@ -390,7 +792,12 @@ namespace Toolbox {
 
 		/** Constant vector operator. */
 		explicit operator const Vector<Char>() const {
-			return string;
+			return Vector<Char>(string);
+		}
+
+		/** View operator. */
+		operator View() const {
+			return AsView();
 		}
 
 		/** Constant standard string operator. */
@@ -442,11 +849,7 @@ namespace Toolbox {
 		/** Returns a new string starting at the index of this string with the given number of characters. */
 		String Substring(size_t Index, size_t Count) const {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			if (Count > Length() - Index) {
 				throw std::runtime_error(
@@ -457,7 +860,7 @@ namespace Toolbox {
 					" is greater than the string of length " +
 					std::to_string(Length()) + ".");
 			}
-			Vector<Char> Substring(Count + 1);
+			Storage Substring(Count + 1);
 			Count += Index;
 			size_t Current = 0;
 			for (; Index < Count; ++Index) {
@@ -475,114 +878,128 @@ namespace Toolbox {
 
 		/** Returns a reference to the character at the given index. */
 		Char& Get(const size_t Index) {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			return string[Index];
+#endif
+			return string.Unchecked(Index);
 		}
 
 		/** Returns a copy of the character at the given index. */
 		Char Get(const size_t Index) const {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
+			}
+#endif
+			return string.Unchecked(Index);
+		}
+
+		/** Returns a reference to the character at the given index, always checking its bounds. */
+		Char& At(const size_t Index) {
+			if (!IsValidIndex(Index)) {
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			return string[Index];
+			return string.Unchecked(Index);
+		}
+
+		/** Returns a copy of the character at the given index, always checking its bounds. */
+		Char At(const size_t Index) const {
+			if (!IsValidIndex(Index)) {
+				ThrowOutOfBounds(Index, "string", Length(), "length");
+			}
+			return string.Unchecked(Index);
+		}
+
+		/** Returns a reference to the character at the given index without checking its bounds. */
+		Char& Unchecked(const size_t Index) {
+			return string.Unchecked(Index);
+		}
+
+		/** Returns a copy of the character at the given index without checking its bounds. */
+		Char Unchecked(const size_t Index) const {
+			return string.Unchecked(Index);
 		}
 
 		/** Returns a reference to the character at the front of the string. */
 		Char& Front() {
+#if !TOOLBOX_UNCHECKED
 			if (IsEmpty()) {
-				throw std::runtime_error("ERROR: The string is empty!");
+				ThrowEmpty("string");
 			}
-			return string[0];
+#endif
+			return string.Unchecked(0);
 		}
 
 		/** Returns a copy of the character at the front of the string. */
 		Char Front() const {
+#if !TOOLBOX_UNCHECKED
 			if (IsEmpty()) {
-				throw std::runtime_error("ERROR: The string is empty!");
+				ThrowEmpty("string");
 			}
-			return string[0];
+#endif
+			return string.Unchecked(0);
 		}
 
 		/** Returns a reference to the character at the back of the string. */
 		Char& Back() {
+#if !TOOLBOX_UNCHECKED
 			if (IsEmpty()) {
-				throw std::runtime_error("ERROR: The string is empty!");
+				ThrowEmpty("string");
 			}
-			return string[Length() - 1];
+#endif
+			return string.Unchecked(Length() - 1);
 		}
 
 		/** Returns a copy of the character at the back of the string. */
 		Char Back() const {
+#if !TOOLBOX_UNCHECKED
 			if (IsEmpty()) {
-				throw std::runtime_error("ERROR: The string is empty!");
+				ThrowEmpty("string");
 			}
-			return string[Length() - 1];
+#endif
+			return string.Unchecked(Length() - 1);
 		}
 
 		/** Returns the index of the first matching character in the string, or -1 if no match is found. */
 		ptrdiff_t Find(const Char Character) const {
-			return string.Find(Character);
+			return AsView().Find(Character);
 		}
 
 		/** Returns the index of the first character of the first matching string in the string, or -1 if no match is found. */
-		ptrdiff_t Find(const String& String) const {
-			if (Length() < String.Length()) {
-				return -1;
-			}
-			for (size_t Index = 0; Index < Length() - String.Length() + 1; ++Index) {
-				if (Matches(Index, String)) {
-					return Index;
-				}
-			}
-			return -1;
+		ptrdiff_t Find(const View String) const {
+			return AsView().Find(String);
 		}
 
 		/** Returns the index of the last matching character in the string, or -1 if no match is found. */
 		ptrdiff_t FindLast(const Char Character) const {
-			return string.FindLast(Character);
+			return AsView().FindLast(Character);
 		}
 
 		/** Returns the index of the first character of the last matching string in the string, or -1 if no match is found. */
-		ptrdiff_t FindLast(const String& String) const {
-			if (IsEmpty() || String.IsEmpty() || Length() < String.Length()) {
-				return -1;
-			}
-			for (ptrdiff_t Index = Length() - String.Length(); Index >= 0; --Index) {
-				if (Matches(Index, String)) {
-					return Index;
-				}
-			}
-			return -1;
+		ptrdiff_t FindLast(const View String) const {
+			return AsView().FindLast(String);
 		}
 
 		/** Returns whether the given character is present in the string. */
 		bool Contains(const Char Character) const {
-			return string.Contains(Character);
+			return AsView().Contains(Character);
 		}
 
 		/** Returns whether the given substring is present in the string. */
-		bool Contains(const String& String) const {
-			return Find(String) != -1;
+		bool Contains(const View String) const {
+			return AsView().Contains(String);
 		}
 
 		/** Returns the total number of characters that match the given character in the string. */
 		size_t Total(const Char Character) const {
-			return string.Total(Character);
+			return AsView().Total(Character);
 		}
 
-		/** Returns the total number of strings that match the given string in the string. */
-		size_t Total(const String& String) const {
-			if (Length() < String.Length()) {
+		/** Returns the total number of non-overlapping strings that match the given string in the string. */
+		size_t Total(const View String) const {
+			if (String.IsEmpty() || Length() < String.Length()) {
 				return 0;
 			}
 			size_t Total = 0;
@@ -602,52 +1019,59 @@ namespace Toolbox {
 
 		/** Returns whether this string begins with the given character. */
 		bool StartsWith(const Char Character) const {
-			if (IsEmpty() || Front() != Character) {
-				return false;
-			}
-			return true;
+			return AsView().StartsWith(Character);
 		}
 
 		/** Returns whether this string begins with the given string. */
-		bool StartsWith(const String& String) const {
-			return Find(String) == 0;
+		bool StartsWith(const View String) const {
+			return AsView().StartsWith(String);
 		}
 
 		/** Returns whether this string ends with the given character. */
 		bool EndsWith(const Char Character) const {
-			if (IsEmpty() || Back() != Character) {
-				return false;
-			}
-			return true;
+			return AsView().EndsWith(Character);
 		}
 
 		/** Returns whether this string ends with the given string. */
-		bool EndsWith(const String& String) const {
-			ptrdiff_t Index = Find(String);
-			return Index != -1 && static_cast<size_t>(Index == Length()) - String.Length();
+		bool EndsWith(const View String) const {
+			return AsView().EndsWith(String);
 		}
 
 		/** Returns whether the characters at and after the given index match the given string. */
-		bool Matches(size_t Index, const String& String) const {
+		bool Matches(const size_t Index, const View String) const {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			size_t Count = Index + String.Length();
-			if (Count > Length()) {
-				return false;
-			}
-			size_t Current = 0;
-			for (; Index < Count; ++Index) {
-				if (string[Index] != String[Current]) {
-					return false;
-				}
-				++Current;
-			}
-			return true;
+			return AsView().Matches(Index, String);
+		}
+
+
+		// VIEWS
+
+		/** Returns a read-only view of this string's characters, which is invalidated when the string is modified. */
+		View AsView() const {
+			return View(string.begin(), Length());
+		}
+
+		/** Returns a view starting at the given index of this string with the given number of characters, clamped to the end of this string. */
+		View SubstringView(const size_t Index, const size_t Count = SIZE_MAX) const {
+			return AsView().Substring(Index, Count);
+		}
+
+		/** Returns a view of this string without any whitespace at either end. */
+		View TrimmedView() const {
+			return AsView().Trim();
+		}
+
+		/** Appends a view of each token separated by the given character to the given vector and returns the number of tokens. */
+		template<size_t INLINE_CAPACITY>
+		size_t Split(const Char Delimiter, Vector<View, INLINE_CAPACITY>& Tokens) const {
+			return AsView().Split(Delimiter, Tokens);
+		}
+
+		/** Returns a vector of views of each token separated by the given character. */
+		Vector<View> Split(const Char Delimiter) const {
+			return AsView().Split(Delimiter);
 		}
 
 
@@ -656,11 +1080,7 @@ namespace Toolbox {
 		/** Sets the character at the given index with a copy of the given character. */
 		String& Set(const size_t Index, const Char Character) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			string[Index] = Character == END_OF_STRING ? '0' : Character;
 			return *this;
@@ -669,18 +1089,10 @@ namespace Toolbox {
 		/** Swaps the given characters at the given indicies. */
 		String& Swap(const size_t Left, const size_t Right) {
 			if (!IsValidIndex(Left)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Left) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Left, "string", Length(), "length");
 			}
 			if (!IsValidIndex(Right)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Right) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Right, "string", Length(), "length");
 			}
 			string.Swap(Left, Right);
 			return *this;
@@ -723,11 +1135,7 @@ namespace Toolbox {
 		/** Fills the string with a copy of the given character starting from the given index for the given count. */
 		String& Fill(Char Character, const size_t Index, size_t Count) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			if (Count > Length() - Index) {
 				throw std::runtime_error(
@@ -770,6 +1178,10 @@ namespace Toolbox {
 
 		/** Turns all alphabetical characters in this string lowercase. */
 		String& ToLowercase() {
+			if constexpr (sizeof(Char) == 1) {
+				SimdToLowercase(reinterpret_cast<char*>(string.begin()), Length());
+				return *this;
+			}
 			for (auto& Character : *this) {
 				Character = Toolbox::ToLowercase<Char>(Character);
 			}
@@ -778,6 +1190,10 @@ namespace Toolbox {
 
 		/** Turns all alphabetical characters in this string uppercase. */
 		String& ToUppercase() {
+			if constexpr (sizeof(Char) == 1) {
+				SimdToUppercase(reinterpret_cast<char*>(string.begin()), Length());
+				return *this;
+			}
 			for (auto& Character : *this) {
 				Character = Toolbox::ToUppercase<Char>(Character);
 			}
@@ -787,13 +1203,9 @@ namespace Toolbox {
 		/** Chops all characters before the given index off of this string and returns them as a new string. */
 		String SplitLeft(const size_t Index) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			Vector<Char> Substring(Index);
+			Storage Substring(Index);
 			for (size_t Current = 0; Current < Index; ++Current) {
 				Substring[Current] = string[0];
 				string.PopFront();
@@ -804,13 +1216,9 @@ namespace Toolbox {
 		/** Chops all characters at and after the given index off of this string and returns them as a new string. */
 		String SplitRight(const size_t Index) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
-			Vector<Char> Substring(Length() - Index);
+			Storage Substring(Length() - Index);
 			for (size_t Current = Index; Current < Length(); ++Current) {
 				Substring[Current - Index] = string[Current];
 			}
@@ -858,11 +1266,7 @@ namespace Toolbox {
 		/** Inserts a copy of the given character at the given index in the string. */
 		String& Insert(const size_t Index, const Char Character) {
 			if (Index > Length()) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			string.Insert(Index, Character == END_OF_STRING ? '0' : Character);
 			return *this;
@@ -875,11 +1279,7 @@ namespace Toolbox {
 				return *this;
 			}
 			if (Index > Length()) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			if (Index == 0) {
 				return Prepend(String);
@@ -887,7 +1287,7 @@ namespace Toolbox {
 			if (Index == Length()) {
 				return Append(String);
 			}
-			Vector<Char> Copy(string.Size() + String.Length());
+			Storage Copy(string.Size() + String.Length());
 			for (size_t Current = 0; Current < Index; ++Current) {
 				Copy[Current] = string[Current];
 			}
@@ -943,11 +1343,7 @@ namespace Toolbox {
 		/** Removes the character at the given index. */
 		String& Erase(const size_t Index) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			string.Erase(Index);
 			return *this;
@@ -956,11 +1352,7 @@ namespace Toolbox {
 		/** Removes the characters at the given index for the given count. */
 		String& Erase(const size_t Index, size_t Count) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::basic_string<Char>("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the string of length " +
-					std::to_string(Length()) + ".");
+				ThrowOutOfBounds(Index, "string", Length(), "length");
 			}
 			if (Count > Length() - Index) {
 				throw std::runtime_error(
@@ -995,10 +1387,9 @@ namespace Toolbox {
 		/** Replaces all instances of the given character with the given character. */
 		String& Replace(const Char ReplacedCharacter, Char Character) {
 			Character = Character == END_OF_STRING ? '0' : Character;
-			for (auto& Current : *this) {
-				if (Current == ReplacedCharacter) {
-					Current = Character;
-				}
+			const View View = AsView();
+			for (ptrdiff_t Index = View.Find(ReplacedCharacter); Index != -1; Index = View.Find(ReplacedCharacter, Index + 1)) {
+				string.Unchecked(Index) = Character;
 			}
 			return *this;
 		}
@@ -1063,19 +1454,16 @@ namespace Toolbox {
 
 		/** Removes all whitespace from each end of this string. */
 		String& Normalize() {
-			size_t Count = 0;
-			while (IsWhitespace<Char>(string[Count])) {
-				++Count;
-			}
-			Erase(0, Count);
-			if (Length() == 0) {
+			const View Trimmed = AsView().Trim();
+			if (Trimmed.Length() == Length()) {
 				return *this;
 			}
-			Count = Length() - 1;
-			string.PopBack();
-			while (IsWhitespace<Char>(string[Count])) {
+			const size_t Front = static_cast<size_t>(Trimmed.begin() - begin());
+			for (size_t Index = 0; Index < Trimmed.Length(); ++Index) {
+				string.Unchecked(Index) = string.Unchecked(Front + Index);
+			}
+			while (string.Size() > Trimmed.Length()) {
 				string.PopBack();
-				--Count;
 			}
 			string.PushBack(END_OF_STRING);
 			return *this;
@@ -1111,12 +1499,12 @@ namespace Toolbox {
 		// AS VECTOR
 
 		/** Returns a reference to this string's underlying vector. */
-		Vector<Char>& AsVector() {
+		Storage& AsVector() {
 			return string;
 		}
 
 		/** Returns a constant reference to this string's underlying vector. */
-		const Vector<Char>& AsVector() const {
+		const Storage& AsVector() const {
 			return string;
 		}
 
@@ -1142,6 +1530,9 @@ namespace Toolbox {
 
 	/** Represents a sequence of characters that can be iterated on and combined with other strings. */
 	using String = BasicString<char>;
+
+	/** A read-only view of a string of characters. */
+	using StringView = BasicStringView<char>;
 }
 
 
@@ -1175,3 +1566,25 @@ DECLARE_TEMPLATED_TO_STRING(typename CharacterType, const std::basic_string<Char
 DECLARE_TEMPLATED_TO_STRING(typename CharacterType, const Toolbox::BasicString<CharacterType>& Value) {
 	return static_cast<std::basic_string<CharacterType>>(Value);
 }
+
+
+// HASH
+
+namespace std {
+
+	/** std::hash Extension = Hashes a Toolbox string's characters. */
+	template<typename CharacterType>
+	struct hash<Toolbox::BasicString<CharacterType>> {
+		size_t operator()(const Toolbox::BasicString<CharacterType>& Value) const {
+			return Toolbox::HashBytes(Value.begin(), Value.Length() * sizeof(CharacterType));
+		}
+	};
+
+	/** std::hash Extension = Hashes a Toolbox string view's characters. */
+	template<typename CharacterType>
+	struct hash<Toolbox::BasicStringView<CharacterType>> {
+		size_t operator()(const Toolbox::BasicStringView<CharacterType>& Value) const {
+			return Toolbox::HashBytes(Value.begin(), Value.Length() * sizeof(CharacterType));
+		}
+	};
+}
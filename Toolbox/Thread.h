@@ -8,10 +8,15 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
 
 // A thread exit code indicating a thread did not successfully complete its execution.
 #define THREAD_INCOMPLETE -1
 
+// The number of times a waiting thread checks a signal before it sleeps until the signal is set.
+#define THREAD_SPIN_COUNT 64
+
 // Shorthand for declaring a thread lambda that stores its owning thread as "ThisThread" and returns an exit code within its body.
 #define THREAD_LAMBDA(Captures) [Captures](const Toolbox::Thread& ThisThread) -> int
 
@@ -26,6 +31,9 @@ namespace Toolbox {
 	/** A shared object used to synchronize operations between multiple threads. */
 	using Mutex = std::mutex;
 
+	/** A shared object that lets many threads read at once while a writing thread has exclusive access. */
+	using SharedMutex = std::shared_mutex;
+
 
 	// ATOMIC
 
@@ -34,6 +42,103 @@ namespace Toolbox {
 	using Atomic = std::atomic<Type>;
 
 
+	// SIGNAL
+
+	/**
+	 * A flag that threads can block on until another thread sets it.<br/>
+	 * Waiting threads briefly spin for up to THREAD_SPIN_COUNT checks, then sleep until they are notified instead of burning a core.<br/>
+	 * A thread that returns from waiting is guaranteed the setting thread no longer touches the signal, so it may destroy it.
+	 */
+	class Signal final {
+
+		// DATA
+
+		/** Whether this signal is set. */
+		Atomic<bool> set;
+
+		/** Guards sleeping threads. */
+		Mutex mutex;
+
+		/** Wakes sleeping threads. */
+		std::condition_variable condition;
+
+
+		// SPINNING
+
+		/** Checks whether this signal is set up to THREAD_SPIN_COUNT times and returns whether it was. */
+		bool Spin() const {
+			for (size_t Count = 0; Count < THREAD_SPIN_COUNT; ++Count) {
+				if (set.load(std::memory_order_acquire)) {
+					return true;
+				}
+				if (Count >= THREAD_SPIN_COUNT / 2) {
+					std::this_thread::yield();
+				}
+			}
+			return set.load(std::memory_order_acquire);
+		}
+
+	public:
+
+		// CONSTRUCTORS
+
+		/** Default constructor. */
+		Signal(const bool Set = false) : set(Set), mutex(), condition() {
+		}
+
+		/** Delete copy constructor. */
+		Signal(const Signal&) = delete;
+
+		/** Delete move constructor. */
+		Signal(Signal&&) noexcept = delete;
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		Signal& operator=(const Signal&) = delete;
+
+		/** Delete move assignment operator. */
+		Signal& operator=(Signal&&) noexcept = delete;
+
+
+		// SIGNALING
+
+		/** Returns whether this signal is set. */
+		bool IsSet() const {
+			return set.load(std::memory_order_acquire);
+		}
+
+		/** Sets this signal and wakes every thread waiting on it. */
+		void Set() {
+			std::lock_guard<Mutex> Lock(mutex);
+			set.store(true, std::memory_order_release);
+			condition.notify_all();
+		}
+
+		/** Clears this signal so threads will wait on it again. */
+		void Reset() {
+			set.store(false, std::memory_order_release);
+		}
+
+		/** Blocks the current thread until this signal is set. */
+		void Wait() {
+			const bool Spun = Spin();
+			std::unique_lock<Mutex> Lock(mutex);
+			if (!Spun) {
+				condition.wait(Lock, [this]() { return set.load(std::memory_order_acquire); });
+			}
+		}
+
+		/** Blocks the current thread until this signal is set or the given number of milliseconds pass, and returns whether it was set. */
+		bool WaitFor(const size_t Milliseconds) {
+			const bool Spun = Spin();
+			std::unique_lock<Mutex> Lock(mutex);
+			return Spun || condition.wait_for(Lock, std::chrono::milliseconds(Milliseconds), [this]() { return set.load(std::memory_order_acquire); });
+		}
+	};
+
+
 	// THREAD
 
 	/** A handle for a new asynchronous thread of execution. */
@@ -53,7 +158,7 @@ namespace Toolbox {
 		Atomic<int> code;
 
 		/** Whether this thread has started its execution. */
-		Atomic<bool> started;
+		Signal started;
 
 		/** Whether this thread was requested to cancel its execution. */
 		Atomic<bool> cancelled;
@@ -61,6 +166,9 @@ namespace Toolbox {
 		/** Whether this thread has successfully completed its execution. */
 		Atomic<bool> complete;
 
+		/** Set when this thread finishes or is cancelled, waking any joining threads. */
+		Signal finished;
+
 		/** The underlying thread object. */
 		std::thread thread;
 
@@ -69,16 +177,17 @@ namespace Toolbox {
 		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		Thread() : code(THREAD_INCOMPLETE), started(false), cancelled(false), complete(false), thread() {
+		Thread() : code(THREAD_INCOMPLETE), started(false), cancelled(false), complete(false), finished(false), thread() {
 		}
 
 		/** Async thread constructor. */
 		template<typename Lambda>
-		Thread(const Lambda& Execution) : code(THREAD_INCOMPLETE), started(false), cancelled(false), complete(false), thread([this, Execution]() {
-			while (!started.load()) { std::this_thread::yield(); }
-			if (cancelled.load()) { return; }
+		Thread(const Lambda& Execution) : code(THREAD_INCOMPLETE), started(false), cancelled(false), complete(false), finished(false), thread([this, Execution]() {
+			started.Wait();
+			if (cancelled.load()) { finished.Set(); return; }
 			code.store(Execution(*this));
 			complete.store(!cancelled.load());
+			finished.Set();
 			}) {
 		}
 
@@ -91,8 +200,8 @@ namespace Toolbox {
 		/** Destructor. */
 		~Thread() {
 			if (thread.joinable()) {
-				started.store(true);
 				cancelled.store(true);
+				started.Set();
 				thread.join();
 			}
 		}
@@ -111,9 +220,9 @@ namespace Toolbox {
 
 		/** Starts this thread asynchronously and returns whether it was successfully started. */
 		bool Run() {
-			if (!started.load()) {
-				started.store(true);
+			if (!started.IsSet()) {
 				thread.detach();
+				started.Set();
 				return true;
 			}
 			return false;
@@ -125,6 +234,7 @@ namespace Toolbox {
 				return false;
 			}
 			cancelled.store(true);
+			finished.Set();
 			return true;
 		}
 
@@ -136,17 +246,30 @@ namespace Toolbox {
 			if (cancelled.load() || complete.load()) {
 				return false;
 			}
-			if (!started.load()) {
-				started.store(true);
+			if (!started.IsSet()) {
+				started.Set();
 				thread.join();
 				return true;
 			}
-			while (!cancelled.load() && !complete.load()) {
-				std::this_thread::yield();
-			}
+			finished.Wait();
 			return true;
 		}
 
+		/**
+		 * Waits until this thread completes or cancels its execution, or the given number of milliseconds pass, before continuing the current thread.<br/>
+		 * Returns whether the thread was successfully joined within the time limit.<br/>
+		 * A thread started by this call stays joinable, so the destructor still waits for it if the time limit passes.
+		 */
+		bool JoinFor(const size_t Milliseconds) {
+			if (cancelled.load() || complete.load()) {
+				return false;
+			}
+			if (!started.IsSet()) {
+				started.Set();
+			}
+			return finished.WaitFor(Milliseconds);
+		}
+
 		/** Returns this thread's ID. */
 		ThreadID ID() const {
 			return thread.get_id();
@@ -159,7 +282,7 @@ namespace Toolbox {
 
 		/** Returns whether this thread has started its execution. */
 		bool IsStarted() const {
-			return started.load();
+			return started.IsSet();
 		}
 
 		/** Returns whether this thread was requested to cancel its execution. */
@@ -0,0 +1,764 @@
+// .h
+// Thread Pool Type
+// by Kyle Furey
+
+#pragma once
+#include <exception>
+#include <condition_variable>
+#include <type_traits>
+#include "Thread.h"
+#include "Ring.h"
+#include "ConcurrentQueue.h"
+
+// The number of tasks submitted from outside a thread pool that can be queued without taking a lock.
+#define THREAD_POOL_INJECTION_CAPACITY 1024
+
+// Shorthand for declaring a task lambda that stores its context as "ThisTask" within its body.
+#define TASK_LAMBDA(Captures) [Captures](const Toolbox::TaskContext& ThisTask)
+
+// Shorthand for checking whether a task was cancelled, and returns a default constructed result if it was.
+#define CHECK_TASK if (ThisTask.IsCancelled()) return {};
+
+/** A collection of useful template types in C++. */
+namespace Toolbox {
+
+	class ThreadPool;
+
+	class TaskBase;
+
+
+	// TASK CONTEXT
+
+	/** The context passed to a task that lets its body cooperatively check for cancellation. */
+	class TaskContext final {
+
+		// DATA
+
+		/** The task being executed. */
+		const TaskBase* task;
+
+	public:
+
+		// CONSTRUCTOR
+
+		/** Task constructor. */
+		explicit TaskContext(const TaskBase& Task) : task(&Task) {
+		}
+
+
+		// GETTERS
+
+		/** Returns whether this task was requested to cancel its execution. */
+		bool IsCancelled() const;
+	};
+
+
+	// TASK BASE
+
+	/** The reference counted, type erased state shared between a thread pool and the handles of one of its tasks. */
+	class TaskBase {
+	public:
+
+		// STATE
+
+		/** Each state a task may be in. */
+		enum State : uint32_t {
+			PENDING,
+			RUNNING,
+			COMPLETE,
+			CANCELLED,
+		};
+
+	private:
+
+		friend class ThreadPool;
+
+		friend class TaskContext;
+
+		template<typename>
+		friend class TaskHandle;
+
+
+		// DATA
+
+		/** The current state of this task. */
+		Atomic<uint32_t> state;
+
+		/** Whether this task was requested to cancel its execution. */
+		Atomic<bool> cancelled;
+
+		/** The number of handles and queues referencing this task. */
+		Atomic<uint32_t> references;
+
+		/** The pool this task was submitted to. */
+		ThreadPool* pool;
+
+		/** The exception thrown by this task's body, if any. */
+		std::exception_ptr exception;
+
+
+		// EXECUTION
+
+		/** Executes this task's body with the given context. */
+		virtual void Execute(const TaskContext& Context) = 0;
+
+		/** Runs this task unless it was cancelled before it started, then wakes any threads waiting on it. */
+		void Run() {
+			if (!cancelled.load(std::memory_order_acquire)) {
+				state.store(RUNNING, std::memory_order_relaxed);
+				try {
+					Execute(TaskContext(*this));
+				}
+				catch (...) {
+					exception = std::current_exception();
+				}
+			}
+			state.store(cancelled.load(std::memory_order_acquire) ? CANCELLED : COMPLETE, std::memory_order_release);
+			state.notify_all();
+		}
+
+
+		// REFERENCES
+
+		/** Adds a reference to this task. */
+		void Retain() {
+			references.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/** Removes a reference to this task and deletes it if it was the last. */
+		void Release() {
+			if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				delete this;
+			}
+		}
+
+	protected:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Pool constructor. */
+		explicit TaskBase(ThreadPool* Pool) : state(PENDING), cancelled(false), references(1), pool(Pool), exception() {
+		}
+
+		/** Delete copy constructor. */
+		TaskBase(const TaskBase&) = delete;
+
+		/** Destructor. */
+		virtual ~TaskBase() = default;
+
+	public:
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		TaskBase& operator=(const TaskBase&) = delete;
+
+
+		// GETTERS
+
+		/** Returns whether this task has finished, either by completing or being cancelled. */
+		bool IsDone() const {
+			return state.load(std::memory_order_acquire) >= COMPLETE;
+		}
+	};
+
+	/** Returns whether this task was requested to cancel its execution. */
+	inline bool TaskContext::IsCancelled() const {
+		return task->cancelled.load(std::memory_order_relaxed);
+	}
+
+
+	// TASK RESULT
+
+	/** A task that stores the value returned by its body. */
+	template<typename ResultType>
+	class TaskResult : public TaskBase {
+		template<typename>
+		friend class TaskHandle;
+
+		// DATA
+
+		/** The uninitialized memory of this task's result. */
+		alignas(ResultType) unsigned char result[sizeof(ResultType)];
+
+		/** Whether this task's result was constructed. */
+		bool hasResult;
+
+	protected:
+
+		// CONSTRUCTOR AND DESTRUCTOR
+
+		/** Pool constructor. */
+		explicit TaskResult(ThreadPool* Pool) : TaskBase(Pool), hasResult(false) {
+		}
+
+		/** Destructor. */
+		~TaskResult() override {
+			if (hasResult) {
+				Result().~ResultType();
+			}
+		}
+
+
+		// RESULT
+
+		/** Constructs this task's result from the given value. */
+		void SetResult(ResultType&& Value) {
+			new(result) ResultType(std::move(Value));
+			hasResult = true;
+		}
+
+		/** Returns a reference to this task's constructed result. */
+		ResultType& Result() {
+			return *std::launder(reinterpret_cast<ResultType*>(result));
+		}
+	};
+
+	/** A task whose body does not return a value. */
+	template<>
+	class TaskResult<void> : public TaskBase {
+	protected:
+
+		// CONSTRUCTOR
+
+		/** Pool constructor. */
+		explicit TaskResult(ThreadPool* Pool) : TaskBase(Pool) {
+		}
+	};
+
+
+	// TASK FUNCTION
+
+	/** A task that stores a copy of its body. */
+	template<typename ResultType, typename FunctionType>
+	class TaskFunction final : public TaskResult<ResultType> {
+
+		// DATA
+
+		/** The body of this task. */
+		FunctionType function;
+
+
+		// EXECUTION
+
+		/** Executes this task's body with the given context. */
+		void Execute(const TaskContext& Context) override {
+			if constexpr (std::is_void_v<ResultType>) {
+				if constexpr (std::is_invocable_v<FunctionType&, const TaskContext&>) {
+					function(Context);
+				}
+				else {
+					function();
+				}
+			}
+			else {
+				if constexpr (std::is_invocable_v<FunctionType&, const TaskContext&>) {
+					this->SetResult(function(Context));
+				}
+				else {
+					this->SetResult(function());
+				}
+			}
+		}
+
+	public:
+
+		// CONSTRUCTOR
+
+		/** Function constructor. */
+		template<typename ArgumentType>
+		TaskFunction(ThreadPool* Pool, ArgumentType&& Function) : TaskResult<ResultType>(Pool), function(std::forward<ArgumentType>(Function)) {
+		}
+	};
+
+
+	// TASK HANDLE
+
+	/**
+	 * A shared handle to a task submitted to a thread pool that can wait for, cancel, and retrieve the task's result.<br/>
+	 * Waiting on a handle runs other queued tasks while the task is still pending, so waiting from inside a task cannot deadlock the pool.
+	 */
+	template<typename ResultType = void>
+	class TaskHandle final {
+		friend class ThreadPool;
+
+		// DATA
+
+		/** The shared task state. */
+		TaskResult<ResultType>* task;
+
+
+		// CONSTRUCTOR
+
+		/** Task constructor that adopts the given reference. */
+		explicit TaskHandle(TaskResult<ResultType>* Task) : task(Task) {
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor. */
+		TaskHandle() : task(nullptr) {
+		}
+
+		/** Copy constructor. */
+		TaskHandle(const TaskHandle& Copied) : task(Copied.task) {
+			if (task != nullptr) {
+				task->Retain();
+			}
+		}
+
+		/** Move constructor. */
+		TaskHandle(TaskHandle&& Moved) noexcept : task(Moved.task) {
+			Moved.task = nullptr;
+		}
+
+		/** Destructor. */
+		~TaskHandle() {
+			if (task != nullptr) {
+				task->Release();
+			}
+		}
+
+
+		// OPERATORS
+
+		/** Copy assignment operator. */
+		TaskHandle& operator=(const TaskHandle& Copied) {
+			if (this == &Copied) {
+				return *this;
+			}
+			if (Copied.task != nullptr) {
+				Copied.task->Retain();
+			}
+			if (task != nullptr) {
+				task->Release();
+			}
+			task = Copied.task;
+			return *this;
+		}
+
+		/** Move assignment operator. */
+		TaskHandle& operator=(TaskHandle&& Moved) noexcept {
+			if (this == &Moved) {
+				return *this;
+			}
+			if (task != nullptr) {
+				task->Release();
+			}
+			task = Moved.task;
+			Moved.task = nullptr;
+			return *this;
+		}
+
+
+		// GETTERS
+
+		/** Returns whether this handle refers to a task. */
+		bool IsValid() const {
+			return task != nullptr;
+		}
+
+		/** Returns whether this handle's task has finished, either by completing or being cancelled. */
+		bool IsDone() const {
+			return task != nullptr && task->IsDone();
+		}
+
+		/** Returns whether this handle's task has successfully completed its execution. */
+		bool IsComplete() const {
+			return task != nullptr && task->state.load(std::memory_order_acquire) == TaskBase::COMPLETE;
+		}
+
+		/** Returns whether this handle's task was requested to cancel its execution. */
+		bool IsCancelled() const {
+			return task != nullptr && task->cancelled.load(std::memory_order_acquire);
+		}
+
+
+		// TASKS
+
+		/** Requests this handle's task to cancel and returns whether it had not finished yet. */
+		bool Cancel() {
+			if (task == nullptr || task->IsDone() || task->cancelled.exchange(true)) {
+				return false;
+			}
+			return true;
+		}
+
+		/** Waits until this handle's task finishes, running other queued tasks in the meantime. */
+		void Wait() const;
+
+		/**
+		 * Waits until this handle's task finishes and returns its result.<br/>
+		 * Rethrows any exception thrown by the task, and throws if the task was cancelled.
+		 */
+		ResultType Get() {
+			if (task == nullptr) {
+				throw std::runtime_error("ERROR: Cannot get the result of an empty task handle!");
+			}
+			Wait();
+			if (task->exception) {
+				std::rethrow_exception(task->exception);
+			}
+			if (task->state.load(std::memory_order_acquire) == TaskBase::CANCELLED) {
+				throw std::runtime_error("ERROR: Cannot get the result of a cancelled task!");
+			}
+			if constexpr (!std::is_void_v<ResultType>) {
+				return task->Result();
+			}
+		}
+	};
+
+
+	// THREAD POOL
+
+	/**
+	 * A fixed set of worker threads that execute submitted tasks.<br/>
+	 * Each worker owns a deque it pushes to and pops from at the back, and idle workers steal from the front of the others.<br/>
+	 * Tasks submitted from outside the pool go through a shared lock-free injection queue, and idle workers sleep instead of spinning.
+	 */
+	class ThreadPool final {
+
+		// WORKER
+
+		/** A worker thread and its deque of tasks. */
+		struct Worker final {
+
+			// DATA
+
+			/** Guards this worker's deque. */
+			Mutex mutex;
+
+			/** This worker's deque of tasks. */
+			Ring<TaskBase*> tasks;
+
+			/** This worker's thread. */
+			std::thread thread;
+		};
+
+
+		// DATA
+
+		/** The number of workers in this pool. */
+		size_t count;
+
+		/** This pool's workers. */
+		Worker* workers;
+
+		/** The lock-free queue of tasks submitted from threads outside of this pool. */
+		MPMCQueue<TaskBase*> injection;
+
+		/** Guards the overflow queue. */
+		Mutex overflowMutex;
+
+		/** The queue of tasks submitted from threads outside of this pool while the injection queue was full. */
+		Ring<TaskBase*> overflow;
+
+		/** The number of tasks in the overflow queue. */
+		Atomic<size_t> overflowing;
+
+		/** The number of queued tasks that have not been taken by a thread yet. */
+		Atomic<size_t> pending;
+
+		/** The number of workers that are sleeping or about to sleep. */
+		Atomic<size_t> sleepers;
+
+		/** Whether this pool is being destroyed. */
+		Atomic<bool> stopping;
+
+		/** Guards sleeping workers. */
+		Mutex sleepMutex;
+
+		/** Wakes sleeping workers. */
+		std::condition_variable sleep;
+
+		/** The pool that owns the current thread, if any. */
+		static inline thread_local ThreadPool* currentPool = nullptr;
+
+		/** The index of the current thread's worker in its pool. */
+		static inline thread_local size_t currentWorker = 0;
+
+
+		// QUEUES
+
+		/** Queues the given task on the current worker's deque, or the injection queue if the current thread is not a worker, and wakes a worker. */
+		void Enqueue(TaskBase* Task) {
+			pending.fetch_add(1);
+			if (currentPool == this) {
+				Worker& Worker = workers[currentWorker];
+				std::lock_guard<Mutex> Lock(Worker.mutex);
+				Worker.tasks.PushBack(Task);
+			}
+			else if (!injection.TryPush(Task)) {
+				std::lock_guard<Mutex> Lock(overflowMutex);
+				overflow.PushBack(Task);
+				overflowing.fetch_add(1);
+			}
+			if (sleepers.load() > 0) {
+				{
+					std::lock_guard<Mutex> Lock(sleepMutex);
+				}
+				sleep.notify_one();
+			}
+		}
+
+		/** Takes the next task for the given worker from its own deque, the injection queue, or another worker, or returns nullptr. */
+		TaskBase* Dequeue(const size_t Index) {
+			if (pending.load(std::memory_order_acquire) == 0) {
+				return nullptr;
+			}
+			if (Index < count) {
+				Worker& Worker = workers[Index];
+				std::lock_guard<Mutex> Lock(Worker.mutex);
+				if (!Worker.tasks.IsEmpty()) {
+					TaskBase* Task = Worker.tasks.Back();
+					Worker.tasks.PopBack();
+					pending.fetch_sub(1);
+					return Task;
+				}
+			}
+			TaskBase* Task = nullptr;
+			if (injection.TryPop(Task)) {
+				pending.fetch_sub(1);
+				return Task;
+			}
+			if (overflowing.load(std::memory_order_acquire) > 0) {
+				std::lock_guard<Mutex> Lock(overflowMutex);
+				if (!overflow.IsEmpty()) {
+					Task = overflow.Front();
+					overflow.PopFront();
+					overflowing.fetch_sub(1);
+					pending.fetch_sub(1);
+					return Task;
+				}
+			}
+			for (size_t Offset = 1; Offset <= count; ++Offset) {
+				Worker& Victim = workers[(Index + Offset) % count];
+				std::unique_lock<Mutex> Lock(Victim.mutex, std::try_to_lock);
+				if (Lock.owns_lock() && !Victim.tasks.IsEmpty()) {
+					Task = Victim.tasks.Front();
+					Victim.tasks.PopFront();
+					pending.fetch_sub(1);
+					return Task;
+				}
+			}
+			return nullptr;
+		}
+
+		/** Runs and releases the given task. */
+		static void Execute(TaskBase* Task) {
+			Task->Run();
+			Task->Release();
+		}
+
+		/** The loop each worker runs until the pool is destroyed and its queues are empty. */
+		void Work(const size_t Index) {
+			currentPool = this;
+			currentWorker = Index;
+			while (true) {
+				TaskBase* Task = Dequeue(Index);
+				if (Task != nullptr) {
+					Execute(Task);
+					continue;
+				}
+				std::unique_lock<Mutex> Lock(sleepMutex);
+				sleepers.fetch_add(1);
+				sleep.wait(Lock, [this]() { return stopping.load() || pending.load() > 0; });
+				sleepers.fetch_sub(1);
+				if (stopping.load() && pending.load() == 0) {
+					return;
+				}
+			}
+		}
+
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor that starts the given number of workers. */
+		explicit ThreadPool(const size_t Threads = Thread::MaxThreads()) : count(Threads > 0 ? Threads : 1), workers(nullptr), injection(THREAD_POOL_INJECTION_CAPACITY), overflowMutex(), overflow(), overflowing(0), pending(0), sleepers(0), stopping(false), sleepMutex(), sleep() {
+			workers = new Worker[count];
+			for (size_t Index = 0; Index < count; ++Index) {
+				workers[Index].thread = std::thread([this, Index]() { Work(Index); });
+			}
+		}
+
+		/** Delete copy constructor. */
+		ThreadPool(const ThreadPool&) = delete;
+
+		/** Delete move constructor. */
+		ThreadPool(ThreadPool&&) noexcept = delete;
+
+		/** Destructor that finishes every queued task before joining the workers. */
+		~ThreadPool() {
+			{
+				std::lock_guard<Mutex> Lock(sleepMutex);
+				stopping.store(true);
+			}
+			sleep.notify_all();
+			for (size_t Index = 0; Index < count; ++Index) {
+				workers[Index].thread.join();
+			}
+			delete[] workers;
+			workers = nullptr;
+		}
+
+
+		// OPERATORS
+
+		/** Delete copy assignment operator. */
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/** Delete move assignment operator. */
+		ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+
+		// GETTERS
+
+		/** Returns the number of worker threads in this pool. */
+		size_t Threads() const {
+			return count;
+		}
+
+		/** Returns the number of queued tasks that have not started yet. */
+		size_t Pending() const {
+			return pending.load();
+		}
+
+		/** Returns whether the current thread is one of this pool's workers. */
+		bool IsWorker() const {
+			return currentPool == this;
+		}
+
+		/** Returns the index of the current thread's worker in this pool, or the number of workers if the current thread is not one of them. */
+		size_t WorkerIndex() const {
+			return currentPool == this ? currentWorker : count;
+		}
+
+		/** Returns a pool shared by the whole program with one worker per hardware thread. */
+		static ThreadPool& Default() {
+			static ThreadPool Pool;
+			return Pool;
+		}
+
+
+		// TASKS
+
+		/**
+		 * Submits the given function to run on this pool and returns a handle to its result.<br/>
+		 * The function may take a constant TaskContext reference to check whether it was cancelled.
+		 */
+		template<typename FunctionType>
+		auto Submit(FunctionType&& Function) {
+			using Decayed = std::decay_t<FunctionType>;
+			using ResultType = std::decay_t<typename std::conditional_t<
+				std::is_invocable_v<Decayed&, const TaskContext&>,
+				std::invoke_result<Decayed&, const TaskContext&>,
+				std::invoke_result<Decayed&>>::type>;
+			auto* Task = new TaskFunction<ResultType, Decayed>(this, std::forward<FunctionType>(Function));
+			Task->Retain();
+			Enqueue(Task);
+			return TaskHandle<ResultType>(Task);
+		}
+
+		/** Submits the given function to run on this pool without a handle. */
+		template<typename FunctionType>
+		void Run(FunctionType&& Function) {
+			using Decayed = std::decay_t<FunctionType>;
+			Enqueue(new TaskFunction<void, Decayed>(this, std::forward<FunctionType>(Function)));
+		}
+
+		/** Runs one queued task on the current thread and returns whether a task was run. */
+		bool RunPending() {
+			TaskBase* Task = Dequeue(currentPool == this ? currentWorker : count);
+			if (Task == nullptr) {
+				return false;
+			}
+			Execute(Task);
+			return true;
+		}
+
+		/**
+		 * Calls the given body for each index from Begin to End across this pool's workers and the current thread, then waits for every call to return.<br/>
+		 * Indices are handed out in chunks of the given grain size, and the body may take either an index or a Begin and End index of a chunk.<br/>
+		 * The first exception thrown by the body is rethrown after every chunk has finished.
+		 */
+		template<typename BodyType>
+		void ParallelFor(const size_t Begin, const size_t End, size_t Grain, const BodyType& Body) {
+			if (Begin >= End) {
+				return;
+			}
+			Grain = Grain > 0 ? Grain : 1;
+			const size_t Chunks = (End - Begin + Grain - 1) / Grain;
+			Atomic<size_t> Next(0);
+			Atomic<bool> Failed(false);
+			std::exception_ptr Exception;
+			auto Loop = [&]() {
+				for (size_t Chunk = Next.fetch_add(1, std::memory_order_relaxed); Chunk < Chunks; Chunk = Next.fetch_add(1, std::memory_order_relaxed)) {
+					if (Failed.load(std::memory_order_relaxed)) {
+						continue;
+					}
+					const size_t First = Begin + Chunk * Grain;
+					const size_t Last = End - First < Grain ? End : First + Grain;
+					try {
+						if constexpr (std::is_invocable_v<const BodyType&, size_t, size_t>) {
+							Body(First, Last);
+						}
+						else {
+							for (size_t Index = First; Index < Last; ++Index) {
+								Body(Index);
+							}
+						}
+					}
+					catch (...) {
+						if (!Failed.exchange(true)) {
+							Exception = std::current_exception();
+						}
+					}
+				}
+			};
+			const size_t Helpers = (Chunks < count + 1 ? Chunks : count + 1) - 1;
+			Ring<TaskHandle<void>> Handles;
+			Handles.Reserve(Helpers);
+			for (size_t Index = 0; Index < Helpers; ++Index) {
+				Handles.PushBack(Submit([&Loop]() { Loop(); }));
+			}
+			Loop();
+			for (auto& Handle : Handles) {
+				Handle.Wait();
+			}
+			if (Exception) {
+				std::rethrow_exception(Exception);
+			}
+		}
+
+		/** Calls the given body for each index from Begin to End across this pool with an automatically chosen grain size. */
+		template<typename BodyType>
+		void ParallelFor(const size_t Begin, const size_t End, const BodyType& Body) {
+			const size_t Count = End > Begin ? End - Begin : 0;
+			const size_t Grain = Count / (count * 4);
+			ParallelFor(Begin, End, Grain > 0 ? Grain : 1, Body);
+		}
+	};
+
+	/** Waits until this handle's task finishes, running other queued tasks in the meantime. */
+	template<typename ResultType>
+	void TaskHandle<ResultType>::Wait() const {
+		if (task == nullptr) {
+			return;
+		}
+		while (true) {
+			const uint32_t State = task->state.load(std::memory_order_acquire);
+			if (State >= TaskBase::COMPLETE) {
+				return;
+			}
+			if (State == TaskBase::RUNNING) {
+				task->state.wait(State, std::memory_order_acquire);
+			}
+			else if (!task->pool->RunPending()) {
+				Thread::Yield();
+			}
+		}
+	}
+}
@@ -4,31 +4,48 @@
 
 #pragma once
 #include "Array.h"
+#include "Allocator.h"
+#include "Stats.h"
 #include "Vector.h"
 #include "Sorting.h"
+#include "Hash.h"
+#include "Pool.h"
 #include "List.h"
+#include "Ring.h"
 #include "Queue.h"
 #include "Stack.h"
 #include "Set.h"
 #include "Map.h"
+#include "FlatSet.h"
+#include "FlatMap.h"
 #include "StateMachine.h"
+#include "StateMachineGroup.h"
 #include "PriorityQueue.h"
+#include "Heap.h"
 #include "Graph.h"
 #include "Point.h"
 #include "Math.h"
 #include "Box.h"
+#include "PointArray.h"
 #include "Tree.h"
 #include "Delegate.h"
 #include "Unique.h"
 #include "Shared.h"
 #include "Weak.h"
+#include "Simd.h"
 #include "String.h"
 #include "Algorithms.h"
+#include "Pipeline.h"
+#include "Serialization.h"
 #include "Iterator.h"
 #include "Collection.h"
 #include "Nullable.h"
 #include "Coroutine.h"
 #include "Thread.h"
+#include "ConcurrentQueue.h"
+#include "ConcurrentMap.h"
+#include "ThreadPool.h"
+#include "Executor.h"
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {}
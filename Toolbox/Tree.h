@@ -3,13 +3,21 @@
 // by Kyle Furey
 
 #pragma once
+#include <cfloat>
+#include <cstdint>
 #include "Vector.h"
+#include "Pool.h"
+#include "Sorting.h"
 #include "Math.h"
 #include "Box.h"
+#include "Stats.h"
 
 // The maximum number of pairs a tree with N total dimensions can store before dividing.
 #define TREE_CAPACITY(N) (N * 2)
 
+// The maximum depth of a tree's nodes, past which nodes store any number of pairs instead of dividing.
+#define TREE_MAX_DEPTH 16
+
 // The maximum possible distance value.
 #define DISTANCE_MAX DBL_MAX
 
@@ -18,18 +26,27 @@ namespace Toolbox {
 
 	// TREE
 
-	/** A collection of elements assigned a location and stored within a partition to be easily found and stored with other elements. */
-	template<typename Type, size_t DIMENSIONS = 2, typename PrecisionType = double>
+	/**
+	 * A collection of elements assigned a location and stored within a partition to be easily found and stored with other elements.<br/>
+	 * Pairs and each node's children are allocated from pools owned by the tree using the given allocator, and every sibling of a node is stored contiguously.
+	 */
+	template<typename Type, size_t DIMENSIONS = 2, typename PrecisionType = double, typename AllocatorType = HeapAllocator>
 	class Tree final {
+
+		// NODE
+
+		/** Represents a partition with child nodes representing smaller parititons. */
+		struct Node;
+
 	public:
 
 		// POINT AND BOX
 
 		/** Represents a point in space with variable dimensions. */
-		using Point = Point<DIMENSIONS, PrecisionType>;
+		using Point = Toolbox::Point<DIMENSIONS, PrecisionType>;
 
 		/** Represents an axis-aligned bounding box with a center point and extensions used for collisions and intersections. */
-		using Box = Box<DIMENSIONS, PrecisionType>;
+		using Box = Toolbox::Box<DIMENSIONS, PrecisionType>;
 
 
 		// PAIR
@@ -37,6 +54,10 @@ namespace Toolbox {
 		/** Arbitrary data and a position value placed into a partition. */
 		struct Pair final {
 
+			// FRIENDS
+
+			friend class Tree;
+
 			// DATA
 
 			/** This pair's owned data. */
@@ -49,12 +70,19 @@ namespace Toolbox {
 			/** The position of this data used to assign a parition. */
 			Point position;
 
+			/** The node this pair is stored in, or nullptr if this pair is not within a tree. */
+			Node* node;
+
 		public:
 
 			// CONSTRUCTOR
 
 			/** Default constructor. */
-			Pair(const Type& Data = Type(), const Point& Position = Point()) : Data(Data), position(Position) {
+			Pair(const Type& Data = Type(), const Point& Position = Point()) : Data(Data), position(Position), node(nullptr) {
+			}
+
+			/** Copy constructor, which never copies the node the pair is stored in. */
+			Pair(const Pair& Copied) : Data(Copied.Data), position(Copied.position), node(nullptr) {
 			}
 
 
@@ -68,6 +96,13 @@ namespace Toolbox {
 
 			// OPERATORS
 
+			/** Copy assignment operator, which never copies the node the pair is stored in. */
+			Pair& operator=(const Pair& Copied) {
+				Data = Copied.Data;
+				position = Copied.position;
+				return *this;
+			}
+
 			/** Returns whether the given pair is equal to this pair. */
 			bool operator==(const Pair& Other) {
 				return this == &Other;
@@ -81,66 +116,112 @@ namespace Toolbox {
 
 	private:
 
+		// CHILDREN
+
+		/** Each child node of a divided node, allocated together so siblings are contiguous. */
+		struct Children;
+
+
 		// NODE
 
 		/** Represents a partition with child nodes representing smaller parititons. */
 		struct Node final {
+
+			// FRIENDS
+
+			friend class Tree;
+
 		private:
 
+			// PAIRS
+
+			/** The pointers to the pairs a node stores, which are kept inside the node until it must divide. */
+			using Storage = Vector<Pair*, TREE_CAPACITY(DIMENSIONS)>;
+
+
 			// DATA
 
 			/** The data this node owns and where it is located. */
-			Vector<Pair> pairs;
+			Storage pairs;
 
 			/** The area this node covers, as well as the area all its children are in. */
 			Box bounds;
 
-			/** Whether this node has been divided and has children. */
-			bool divided;
+			/** The enlarged area this node's pairs may move within before they must be moved to another node. */
+			Box loose;
 
-			/** Each child node of this node. */
-			Node* children[1 << DIMENSIONS];
+			/** The node this node was divided from, or nullptr if this node is the root. */
+			Node* parent;
+
+			/** Each child node of this node, or nullptr if this node has not been divided. */
+			Children* children;
 
 
 			// PARTITION
 
-			/** Divides the node partition into child nodes. */
-			bool Divide() {
-				if (!divided) {
+			/** Divides the node partition into child nodes allocated from the given tree. */
+			bool Divide(Tree& Owner) {
+				if (children == nullptr) {
+					children = Owner.nodes.New();
+					TOOLBOX_COUNT(Tree, Allocations, 1);
+					TOOLBOX_COUNT(Tree, AllocatedBytes, sizeof(*children));
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
 						Point NewOrigin;
 						for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
 							// SOURCE: ChatGPT - "How can I divide a templated N dimensional quadtree in C++?"
 							NewOrigin[Component] = bounds.Origin[Component] + ((Index & (static_cast<size_t>(1) << Component)) ? (bounds.HalfSize / 2) : -(bounds.HalfSize / 2));
 						}
-						children[Index] = new Node(Box(NewOrigin, bounds.HalfSize / 2));
+						children->Nodes[Index].bounds = Box(NewOrigin, bounds.HalfSize / 2);
+						children->Nodes[Index].loose = Box(NewOrigin, bounds.HalfSize / 2 * Owner.looseness);
+						children->Nodes[Index].parent = this;
 					}
-					divided = true;
 					return true;
 				}
 				return false;
 			}
 
+			/** Returns the given tree's memory for this node's children, as well as its pairs unless they are being kept for a rebuild. */
+			void Release(Tree& Owner, const bool KeepPairs = false) {
+				for (auto& Pair : pairs) {
+					if (KeepPairs) {
+						Pair->node = nullptr;
+					}
+					else {
+						Owner.pairs.Delete(Pair);
+						TOOLBOX_COUNT(Tree, Deallocations, 1);
+						TOOLBOX_COUNT(Tree, DeallocatedBytes, sizeof(typename Tree::Pair));
+					}
+				}
+				pairs.Clear();
+				if (children != nullptr) {
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						children->Nodes[Index].Release(Owner, KeepPairs);
+					}
+					Owner.nodes.Delete(children);
+					TOOLBOX_COUNT(Tree, Deallocations, 1);
+					TOOLBOX_COUNT(Tree, DeallocatedBytes, sizeof(*children));
+					children = nullptr;
+				}
+			}
+
 
 			// GETTERS
 
 			/** Recursively counts each pair. */
 			void RecursiveCount(size_t& Count) const {
-				if (divided) {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursiveCount(Count);
+						children->Nodes[Index].RecursiveCount(Count);
 					}
 				}
-				for (auto& Pair : pairs) {
-					++Count;
-				}
+				Count += pairs.Size();
 			}
 
 			/** Recursively traverses as deep as possible into the node's children. */
 			void RecursiveDepth(size_t CurrentDepth, size_t& Depth) const {
-				if (divided) {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursiveDepth(CurrentDepth + 1, Depth);
+						children->Nodes[Index].RecursiveDepth(CurrentDepth + 1, Depth);
 					}
 				}
 				if (CurrentDepth > Depth) {
@@ -148,113 +229,261 @@ namespace Toolbox {
 				}
 			}
 
+			/** Recursively counts this node and its children at the given depth into the given statistics. */
+			void RecursiveStatistics(const size_t CurrentDepth, TreeStats& Statistics) const {
+				Statistics.Add(CurrentDepth, pairs.Size(), children == nullptr);
+				if (children != nullptr) {
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						children->Nodes[Index].RecursiveStatistics(CurrentDepth + 1, Statistics);
+					}
+				}
+			}
+
 			/** Recursively searches the node's children for points nearby the given position. */
-			void RecursiveFindAll(const Point& Position, Vector<Pair*>& Query) {
-				if (divided) {
+			void RecursiveFindAll(const Point& Position, Vector<Pair*>& Query) const {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						if (children[Index]->Bounds().Contains(Position)) {
-							children[Index]->RecursiveFindAll(Position, Query);
+						if (children->Nodes[Index].loose.Contains(Position)) {
+							children->Nodes[Index].RecursiveFindAll(Position, Query);
 						}
 					}
 				}
 				for (auto& Pair : pairs) {
-					Query.PushBack(&Pair);
+					Query.PushBack(Pair);
 				}
 			}
 
 			/** Recursively searches the node's children for points nearby the given position. */
 			void RecursiveFindAll(const Point& Position, Vector<const Pair*>& Query) const {
-				if (divided) {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						if (children[Index]->Bounds().Contains(Position)) {
-							children[Index]->RecursiveFindAll(Position, Query);
+						if (children->Nodes[Index].loose.Contains(Position)) {
+							children->Nodes[Index].RecursiveFindAll(Position, Query);
 						}
 					}
 				}
 				for (auto& Pair : pairs) {
-					Query.PushBack(&Pair);
+					Query.PushBack(Pair);
 				}
 			}
 
 			/** Recursively searches the node's children for points within the given area. */
-			void RecursiveQuery(const Box& Area, Vector<Pair*>& Query) {
-				if (!bounds.Intersects(Area)) {
+			void RecursiveQuery(const Box& Area, Vector<Pair*>& Query) const {
+				if (!loose.Intersects(Area)) {
 					return;
 				}
-				if (divided) {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursiveQuery(Area, Query);
+						children->Nodes[Index].RecursiveQuery(Area, Query);
 					}
 				}
 				for (auto& Pair : pairs) {
-					if (Area.Contains(Pair.Position())) {
-						Query.PushBack(&Pair);
+					if (Area.Contains(Pair->Position())) {
+						Query.PushBack(Pair);
 					}
 				}
 			}
 
 			/** Recursively searches the node's children for points within the given area. */
 			void RecursiveQuery(const Box& Area, Vector<const Pair*>& Query) const {
-				if (!bounds.Intersects(Area)) {
+				if (!loose.Intersects(Area)) {
 					return;
 				}
-				if (divided) {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursiveQuery(Area, Query);
+						children->Nodes[Index].RecursiveQuery(Area, Query);
 					}
 				}
 				for (auto& Pair : pairs) {
-					if (Area.Contains(Pair.Position())) {
-						Query.PushBack(&Pair);
+					if (Area.Contains(Pair->Position())) {
+						Query.PushBack(Pair);
 					}
 				}
 			}
 
 			/** Recursively appends pointers to this node's and its children's pairs to a vector. */
-			void RecursiveAllPairs(Vector<Pair*>& Pairs) {
-				if (divided) {
+			void RecursiveAllPairs(Vector<Pair*>& Pairs) const {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursivePairs(Pairs);
+						children->Nodes[Index].RecursiveAllPairs(Pairs);
 					}
 				}
 				for (auto& Pair : pairs) {
-					Pairs.PushBack(&Pair);
+					Pairs.PushBack(Pair);
 				}
 			}
 
 			/** Recursively appends constant pointers to this node's and its children's pairs to a vector. */
 			void RecursiveAllPairs(Vector<const Pair*>& Pairs) const {
-				if (divided) {
+				if (children != nullptr) {
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						children->Nodes[Index].RecursiveAllPairs(Pairs);
+					}
+				}
+				for (auto& Pair : pairs) {
+					Pairs.PushBack(Pair);
+				}
+			}
+
+
+			// PROXIMITY
+
+			/**
+			 * Recursively searches this node and its children nearest first for the given number of pairs closest to the given position.<br/>
+			 * Results are kept sorted by squared distance, and subtrees farther than the current farthest result are pruned.
+			 */
+			template<typename ResultVector>
+			void RecursiveNearest(const Point& Position, const size_t Count, ResultVector& Results, PrecisionType& Farthest) const {
+				for (auto& Pair : pairs) {
+					const PrecisionType Distance = Math::DistanceSquared<DIMENSIONS, PrecisionType>(Position, Pair->Position());
+					if (Results.Size() == Count) {
+						if (!(Distance < Farthest)) {
+							continue;
+						}
+						Results.PopBack();
+					}
+					size_t Index = Results.Size();
+					Results.PushBack(Pair);
+					while (Index > 0 && Math::DistanceSquared<DIMENSIONS, PrecisionType>(Position, Results[Index - 1]->Position()) > Distance) {
+						Results[Index] = Results[Index - 1];
+						--Index;
+					}
+					Results[Index] = Pair;
+					if (Results.Size() == Count) {
+						Farthest = Math::DistanceSquared<DIMENSIONS, PrecisionType>(Position, Results.Back()->Position());
+					}
+				}
+				if (children != nullptr) {
+					PrecisionType Distances[1 << DIMENSIONS];
+					size_t Order[1 << DIMENSIONS];
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursivePairs(Pairs);
+						Distances[Index] = children->Nodes[Index].loose.DistanceSquared(Position);
+						size_t Sorted = Index;
+						while (Sorted > 0 && Distances[Order[Sorted - 1]] > Distances[Index]) {
+							Order[Sorted] = Order[Sorted - 1];
+							--Sorted;
+						}
+						Order[Sorted] = Index;
+					}
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						if (Results.Size() == Count && !(Distances[Order[Index]] < Farthest)) {
+							break;
+						}
+						children->Nodes[Order[Index]].RecursiveNearest(Position, Count, Results, Farthest);
 					}
 				}
+			}
+
+			/** Recursively appends each pair within the given squared radius of the given position, skipping subtrees outside of it. */
+			template<typename ResultVector>
+			void RecursiveWithinRadius(const Point& Position, const PrecisionType RadiusSquared, ResultVector& Results) const {
+				if (loose.DistanceSquared(Position) > RadiusSquared) {
+					return;
+				}
 				for (auto& Pair : pairs) {
-					Pairs.PushBack(&Pair);
+					if (Math::DistanceSquared<DIMENSIONS, PrecisionType>(Position, Pair->Position()) <= RadiusSquared) {
+						Results.PushBack(Pair);
+					}
+				}
+				if (children != nullptr) {
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						children->Nodes[Index].RecursiveWithinRadius(Position, RadiusSquared, Results);
+					}
 				}
 			}
 
+			/** Recursively searches each node containing the given pair's position for the given pair. */
+			bool RecursiveContains(const Pair* Pair) const {
+				if (!loose.Contains(Pair->Position())) {
+					return false;
+				}
+				for (auto& Stored : pairs) {
+					if (Stored == Pair) {
+						return true;
+					}
+				}
+				if (children != nullptr) {
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						if (children->Nodes[Index].RecursiveContains(Pair)) {
+							return true;
+						}
+					}
+				}
+				return false;
+			}
+
 
 			// EXPANSION
 
-			/** Recursively inserts a new node into its child nodes. */
-			Pair* RecursiveInsert(const Type& Data, const Point& Position) {
-				if (!bounds.Contains(Position)) {
-					return nullptr;
+			/**
+			 * Recursively places the given pair within this node or its child nodes, returning whether its position is within this node.<br/>
+			 * Pairs no child accepts (such as positions that round outside of every child on a split plane) are kept in this node, so a placed pair is never lost.
+			 */
+			bool RecursivePlace(Tree& Owner, Pair* Pair, const size_t Depth) {
+				if (!bounds.Contains(Pair->Position())) {
+					return false;
 				}
-				if (pairs.Size() < pairs.Capacity()) {
-					return &pairs.PushBack(Pair(Data, Position));
+				if (pairs.Size() >= TREE_CAPACITY(DIMENSIONS) && Depth < TREE_MAX_DEPTH) {
+					Divide(Owner);
+					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
+						if (children->Nodes[Index].RecursivePlace(Owner, Pair, Depth + 1)) {
+							return true;
+						}
+					}
 				}
-				if (!divided) {
-					Divide();
+				pairs.PushBack(Pair);
+				Pair->node = this;
+				return true;
+			}
+
+			/** Removes the given pair from this node's pairs without freeing it. */
+			void Unlink(Pair* Pair) {
+				for (size_t Index = 0; Index < pairs.Size(); ++Index) {
+					if (pairs[Index] == Pair) {
+						pairs[Index] = pairs[pairs.Size() - 1];
+						pairs.PopBack();
+						Pair->node = nullptr;
+						return;
+					}
+				}
+				throw std::runtime_error("ERROR: The given pair is not within this tree!");
+			}
+
+			/** Returns the number of nodes between this node and the root. */
+			size_t Level() const {
+				size_t Level = 0;
+				for (const Node* Current = parent; Current != nullptr; Current = Current->parent) {
+					++Level;
+				}
+				return Level;
+			}
+
+			/**
+			 * Recursively builds this node's hierarchy from the given range of Morton ordered entries in one pass.<br/>
+			 * Each child's entries are contiguous, so each node's pairs are neighbors in the entries.
+			 */
+			void RecursiveLoad(Tree& Owner, const typename Tree::Entry* Entries, const size_t Begin, const size_t End, const size_t Level, const size_t Levels) {
+				if (End - Begin <= TREE_CAPACITY(DIMENSIONS) || Level >= Levels) {
+					for (size_t Index = Begin; Index < End; ++Index) {
+						pairs.PushBack(Entries[Index].Target);
+						Entries[Index].Target->node = this;
+					}
+					return;
 				}
-				for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-					Pair* Result = children[Index]->RecursiveInsert(Data, Position);
-					if (Result != nullptr) {
-						return Result;
+				Divide(Owner);
+				const size_t Shift = (Levels - 1 - Level) * DIMENSIONS;
+				const uint64_t Mask = (static_cast<uint64_t>(1) << DIMENSIONS) - 1;
+				size_t Start = Begin;
+				for (size_t Index = 0; Index < (1 << DIMENSIONS) && Start < End; ++Index) {
+					size_t Stop = Start;
+					while (Stop < End && ((Entries[Stop].Code >> Shift) & Mask) == Index) {
+						++Stop;
+					}
+					if (Stop > Start) {
+						children->Nodes[Index].RecursiveLoad(Owner, Entries, Start, Stop, Level + 1, Levels);
 					}
+					Start = Stop;
 				}
-				return nullptr;
 			}
 
 
@@ -266,29 +495,25 @@ namespace Toolbox {
 					for (size_t Index = 0; Index <= Depth; ++Index) {
 						String += '\t';
 					}
-					String += "( " + std::to_string(Pair.Data) + " : " + Pair.Position().ToString() + " ),\n";
+					String += "( " + std::to_string(Pair->Data) + " : " + Pair->Position().ToString() + " ),\n";
 				}
 				if (String[String.length() - 2] == ',') {
 					String.erase(String.length() - 2, 1);
 					String += '\n';
 				}
-				if (divided) {
+				if (children != nullptr) {
 					for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-						children[Index]->RecursiveToString(Depth + 1, String);
+						children->Nodes[Index].RecursiveToString(Depth + 1, String);
 					}
 				}
 			}
 
 		public:
 
-			// CONSTRUCTORS AND DESTRUCTOR
+			// CONSTRUCTORS
 
 			/** Default constructor. */
-			Node(const Box& Bounds = Box()) : pairs(), bounds(Bounds), divided(false), children() {
-				pairs.Resize(TREE_CAPACITY(DIMENSIONS));
-				for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-					children[Index] = nullptr;
-				}
+			Node(const Box& Bounds = Box(), Node* Parent = nullptr) : pairs(), bounds(Bounds), loose(Bounds), parent(Parent), children(nullptr) {
 			}
 
 			/** Delete copy constructor. */
@@ -297,14 +522,6 @@ namespace Toolbox {
 			/** Delete move constructor. */
 			Node(Node&&) noexcept = delete;
 
-			/** Destructor. */
-			~Node() {
-				for (size_t Index = 0; Index < (1 << DIMENSIONS); ++Index) {
-					delete children[Index];
-					children[Index] = nullptr;
-				}
-			}
-
 
 			// OPERATORS
 
@@ -332,18 +549,28 @@ namespace Toolbox {
 			}
 
 			/** Returns each of this node's stored pairs. */
-			const Vector<Pair>& Pairs() const {
+			const Storage& Pairs() const {
 				return pairs;
 			}
 
 			/** Returns the bounds of this node. */
-			const Box& Bounds() {
+			const Box& Bounds() const {
 				return bounds;
 			}
 
+			/** Returns the enlarged bounds of this node, which its pairs may have moved within without being moved to another node. */
+			const Box& LooseBounds() const {
+				return loose;
+			}
+
+			/** Returns a constant pointer to the node this node was divided from, or nullptr if this node is the root. */
+			const Node* Parent() const {
+				return parent;
+			}
+
 			/** Returns whether this node is divided and has children. */
 			bool IsDivided() const {
-				return divided;
+				return children != nullptr;
 			}
 
 			/** Returns the total number of children of this node. */
@@ -351,9 +578,9 @@ namespace Toolbox {
 				return 1 << DIMENSIONS;
 			}
 
-			/** Returns a constant pointer to all of the node's children. */
-			const Node** Children() const {
-				return divided ? children : nullptr;
+			/** Returns a constant pointer to the first of the node's contiguous children, or nullptr if it has not been divided. */
+			const Node* FirstChild() const {
+				return children != nullptr ? children->Nodes : nullptr;
 			}
 
 			/** Returns a pointer to the child node at the given index, or nullptr if it has not been divided. */
@@ -361,10 +588,10 @@ namespace Toolbox {
 				if (Index >= (1 << DIMENSIONS)) {
 					throw std::runtime_error(std::string("ERROR: Index was out of bounds of the tree's maximum child count of ") + std::to_string(1 << DIMENSIONS) + "!");
 				}
-				if (!divided) {
+				if (children == nullptr) {
 					return nullptr;
 				}
-				return children[Index];
+				return &children->Nodes[Index];
 			}
 
 			/** Returns a constant pointer to the child node at the given index, or nullptr if it has not been divided. */
@@ -372,15 +599,15 @@ namespace Toolbox {
 				if (Index >= (1 << DIMENSIONS)) {
 					throw std::runtime_error(std::string("ERROR: Index was out of bounds of the tree's maximum child count of ") + std::to_string(1 << DIMENSIONS) + "!");
 				}
-				if (!divided) {
+				if (children == nullptr) {
 					return nullptr;
 				}
-				return children[Index];
+				return &children->Nodes[Index];
 			}
 
 			/** Returns a pointer to the child node at the given corner of the partition, or nullptr if it has not been divided. */
 			Node* GetChild(const bool PositiveDimensions[DIMENSIONS]) {
-				if (!divided) {
+				if (children == nullptr) {
 					return nullptr;
 				}
 				size_t Child = 0;
@@ -389,12 +616,12 @@ namespace Toolbox {
 						Child |= (1 << Index);
 					}
 				}
-				return children[Child];
+				return &children->Nodes[Child];
 			}
 
 			/** Returns a constant pointer to the child node at the given corner of the partition, or nullptr if it has not been divided. */
 			const Node* GetChild(const bool PositiveDimensions[DIMENSIONS]) const {
-				if (!divided) {
+				if (children == nullptr) {
 					return nullptr;
 				}
 				size_t Child = 0;
@@ -403,37 +630,63 @@ namespace Toolbox {
 						Child |= (1 << Index);
 					}
 				}
-				return children[Child];
+				return &children->Nodes[Child];
 			}
 
 			/** Returns a pointer to the pair closest to the given position within this node or its children. */
 			Pair* Find(const Point& Position) {
-				Vector<Pair*> Query = FindAll(Position);
-				Pair* Closest = nullptr;
-				PrecisionType ClosestDistance = DISTANCE_MAX;
-				for (auto& Pair : Query) {
-					PrecisionType Distance = Math::Distance<DIMENSIONS, PrecisionType>(Position, Pair->Position());
-					if (Distance < ClosestDistance) {
-						Closest = Pair;
-						ClosestDistance = Distance;
-					}
-				}
-				return Closest;
+				Vector<Pair*, 1> Closest;
+				PrecisionType Farthest = DISTANCE_MAX;
+				RecursiveNearest(Position, 1, Closest, Farthest);
+				return Closest.IsEmpty() ? nullptr : Closest[0];
 			}
 
 			/** Returns a constant pointer to the pair closest to the given position within this node or its children. */
 			const Pair* Find(const Point& Position) const {
-				Vector<const Pair*> Query = FindAll(Position);
-				const Pair* Closest = nullptr;
-				PrecisionType ClosestDistance = DISTANCE_MAX;
-				for (auto& Pair : Query) {
-					PrecisionType Distance = Math::Distance<DIMENSIONS, PrecisionType>(Position, Pair->Position());
-					if (Distance < ClosestDistance) {
-						Closest = Pair;
-						ClosestDistance = Distance;
-					}
+				Vector<const Pair*, 1> Closest;
+				PrecisionType Farthest = DISTANCE_MAX;
+				RecursiveNearest(Position, 1, Closest, Farthest);
+				return Closest.IsEmpty() ? nullptr : Closest[0];
+			}
+
+			/**
+			 * Replaces the given results with pointers to the given number of pairs closest to the given position, nearest first.<br/>
+			 * Returns the number of pairs found, which is only less than the given number if this node has fewer pairs.
+			 */
+			size_t FindNearest(const Point& Position, const size_t Count, Vector<Pair*>& Results) {
+				Results.Clear();
+				if (Count > 0) {
+					PrecisionType Farthest = DISTANCE_MAX;
+					RecursiveNearest(Position, Count, Results, Farthest);
 				}
-				return Closest;
+				return Results.Size();
+			}
+
+			/**
+			 * Replaces the given results with constant pointers to the given number of pairs closest to the given position, nearest first.<br/>
+			 * Returns the number of pairs found, which is only less than the given number if this node has fewer pairs.
+			 */
+			size_t FindNearest(const Point& Position, const size_t Count, Vector<const Pair*>& Results) const {
+				Results.Clear();
+				if (Count > 0) {
+					PrecisionType Farthest = DISTANCE_MAX;
+					RecursiveNearest(Position, Count, Results, Farthest);
+				}
+				return Results.Size();
+			}
+
+			/** Replaces the given results with pointers to each pair within the given radius of the given position and returns how many were found. */
+			size_t FindWithinRadius(const Point& Position, const PrecisionType Radius, Vector<Pair*>& Results) {
+				Results.Clear();
+				RecursiveWithinRadius(Position, Radius * Radius, Results);
+				return Results.Size();
+			}
+
+			/** Replaces the given results with constant pointers to each pair within the given radius of the given position and returns how many were found. */
+			size_t FindWithinRadius(const Point& Position, const PrecisionType Radius, Vector<const Pair*>& Results) const {
+				Results.Clear();
+				RecursiveWithinRadius(Position, Radius * Radius, Results);
+				return Results.Size();
 			}
 
 			/** Returns a vector of pointers to the pairs within the same quadrant of the given position within this node and its children. */
@@ -469,7 +722,7 @@ namespace Toolbox {
 				if (Pair == nullptr) {
 					return false;
 				}
-				return Find(Pair->Position()) == Pair;
+				return RecursiveContains(Pair);
 			}
 
 			/** Returns a vector of pointers to each of this node's pairs and its children's pairs. */
@@ -487,19 +740,11 @@ namespace Toolbox {
 			}
 
 
-			// EXPANSION
-
-			/** Inserts a new node into the tree and returns a reference to the new data. */
-			Pair* Insert(const Type& Data, const Point& Position) {
-				return RecursiveInsert(Data, Position);
-			}
-
-
 			// TO STRING
 
 			/** Returns the node and its children as a string. */
 			std::string ToString() const {
-				if (!divided && pairs.IsEmpty()) {
+				if (children == nullptr && pairs.IsEmpty()) {
 					return "{ }";
 				}
 				std::string String = "{\n";
@@ -510,59 +755,155 @@ namespace Toolbox {
 		};
 
 
+		// CHILDREN
+
+		/** Each child node of a divided node, allocated together so siblings are contiguous. */
+		struct Children final {
+
+			// DATA
+
+			/** Each child node. */
+			Node Nodes[1 << DIMENSIONS];
+		};
+
+
+		// ENTRY
+
+		/** A pair waiting to be loaded and the Morton code of the path to its node. */
+		struct Entry final {
+
+			// DATA
+
+			/** The Morton code of the pair's position, with the root's child index in its highest digit. */
+			uint64_t Code;
+
+			/** The pair to place into the tree. */
+			Pair* Target;
+		};
+
+
 		// DATA
 
 		/** The maximum bounds of this tree. */
 		Box bounds;
 
+		/** How much larger each child node's loose bounds are than its bounds. */
+		PrecisionType looseness;
+
+		/** The memory of each pair in this tree. */
+		Pool<Pair, AllocatorType> pairs;
+
+		/** The memory of each divided node's children in this tree. */
+		Pool<Children, AllocatorType> nodes;
+
 		/** The root node of the tree. */
 		Node* root;
 
-	public:
 
-		// CONSTRUCTORS AND DESTRUCTOR
+		// BULK LOADING
 
-		/** Default constructor. */
-		Tree(const Box& Bounds = Box(Point(), 100)) : bounds(Bounds), root(new Node(Bounds)) {
+		/** Returns the number of levels a Morton code can describe for this tree's dimensions. */
+		static constexpr size_t MortonLevels() {
+			return (64 / DIMENSIONS) < TREE_MAX_DEPTH ? (64 / DIMENSIONS) : TREE_MAX_DEPTH;
 		}
 
-		/** Pair constructor. */
-		Tree(const Box& Bounds, const Vector<Pair*>& Pairs) : bounds(Bounds), root(new Node(Bounds)) {
-			for (auto& Pair : Pairs) {
-				if (Bounds.Contains(Pair->Position())) {
-					Insert(Pair->Data, Pair->Position());
+		/** Returns the Morton code of the given position by following the same divisions each node makes. */
+		uint64_t MortonCode(const Point& Position) const {
+			uint64_t Code = 0;
+			Point Origin = bounds.Origin;
+			PrecisionType HalfSize = bounds.HalfSize;
+			for (size_t Level = 0; Level < MortonLevels(); ++Level) {
+				uint64_t Child = 0;
+				for (size_t Component = 0; Component < DIMENSIONS; ++Component) {
+					if (Position[Component] > Origin[Component]) {
+						Child |= static_cast<uint64_t>(1) << Component;
+						Origin[Component] = Origin[Component] + (HalfSize / 2);
+					}
+					else {
+						Origin[Component] = Origin[Component] + -(HalfSize / 2);
+					}
 				}
+				HalfSize = HalfSize / 2;
+				Code = (Code << DIMENSIONS) | Child;
 			}
+			return Code;
 		}
 
-		/** Pair constructor. */
-		Tree(const Box& Bounds, const Vector<const Pair*>& Pairs) : bounds(Bounds), root(new Node(Bounds)) {
+		/**
+		 * Copies the given pairs within this tree's bounds, sorts the copies by their Morton codes, and builds the tree from them in one pass.<br/>
+		 * Copies are allocated in sorted order so neighboring pairs share memory.
+		 */
+		void Load(const Vector<const Pair*>& Pairs) {
+			if (looseness < 1) {
+				throw std::runtime_error("ERROR: A tree's looseness must be at least 1!");
+			}
+			Vector<Entry> Entries;
+			Entries.Reserve(Pairs.Size());
 			for (auto& Pair : Pairs) {
-				if (Bounds.Contains(Pair->Position())) {
-					Insert(Pair->Data, Pair->Position());
+				if (Pair != nullptr && bounds.Contains(Pair->Position())) {
+					Entries.PushBack(Entry{ MortonCode(Pair->Position()), const_cast<typename Tree::Pair*>(Pair) });
 				}
 			}
+			Sorting::RadixSort(Entries.begin(), Entries.end(), [](const Entry& Entry) { return Entry.Code; });
+			pairs.Reserve(Entries.Size());
+			for (auto& Entry : Entries) {
+				Entry.Target = pairs.New(Entry.Target->Data, Entry.Target->Position());
+			}
+			TOOLBOX_COUNT(Tree, Allocations, Entries.Size());
+			TOOLBOX_COUNT(Tree, AllocatedBytes, sizeof(Pair) * Entries.Size());
+			root->RecursiveLoad(*this, Entries.begin(), 0, Entries.Size(), 0, MortonLevels());
 		}
 
-		/** Copy constructor. */
-		Tree(const Tree& Copied) : bounds(Copied.bounds), root(new Node(Copied.bounds)) {
-			Vector<Pair> Pairs = Copied.Pairs();
+	public:
+
+		// CONSTRUCTORS AND DESTRUCTOR
+
+		/** Default constructor, with optional loose bounds that let pairs move further before moving nodes. */
+		Tree(const Box& Bounds = Box(Point(), 100), const PrecisionType Looseness = 1, const AllocatorType& Allocator = AllocatorType()) : bounds(Bounds), looseness(Looseness), pairs(Allocator), nodes(Allocator), root(nullptr) {
+			if (Looseness < 1) {
+				throw std::runtime_error("ERROR: A tree's looseness must be at least 1!");
+			}
+			root = new Node(Bounds);
+		}
+
+		/** Pair constructor, which bulk loads each pair within the given bounds. */
+		Tree(const Box& Bounds, const Vector<Pair*>& Pairs, const PrecisionType Looseness = 1, const AllocatorType& Allocator = AllocatorType()) : bounds(Bounds), looseness(Looseness), pairs(Allocator), nodes(Allocator), root(new Node(Bounds)) {
+			Vector<const Pair*> Loaded;
+			Loaded.Reserve(Pairs.Size());
 			for (auto& Pair : Pairs) {
-				Insert(Pair.Data, Pair.Position());
+				Loaded.PushBack(Pair);
 			}
+			Load(Loaded);
 		}
 
-		/** Move constructor. */
-		Tree(Tree&& Moved) noexcept : bounds(Moved.bounds), root(new Node(Moved.bounds)) {
-			Vector<Pair> Pairs = Moved.Pairs();
+		/** Pair constructor, which bulk loads each pair within the given bounds. */
+		Tree(const Box& Bounds, const Vector<const Pair*>& Pairs, const PrecisionType Looseness = 1, const AllocatorType& Allocator = AllocatorType()) : bounds(Bounds), looseness(Looseness), pairs(Allocator), nodes(Allocator), root(new Node(Bounds)) {
+			Load(Pairs);
+		}
+
+		/** Pair constructor, which bulk loads a copy of each pair within the given bounds. */
+		Tree(const Box& Bounds, const Vector<Pair>& Pairs, const PrecisionType Looseness = 1, const AllocatorType& Allocator = AllocatorType()) : bounds(Bounds), looseness(Looseness), pairs(Allocator), nodes(Allocator), root(new Node(Bounds)) {
+			Vector<const Pair*> Loaded;
+			Loaded.Reserve(Pairs.Size());
 			for (auto& Pair : Pairs) {
-				Insert(Pair.Data, Pair.Position());
+				Loaded.PushBack(&Pair);
 			}
-			Moved.Clear();
+			Load(Loaded);
+		}
+
+		/** Copy constructor. */
+		Tree(const Tree& Copied) : bounds(Copied.bounds), looseness(Copied.looseness), pairs(Copied.pairs.GetAllocator()), nodes(Copied.nodes.GetAllocator()), root(new Node(Copied.bounds)) {
+			Load(Copied.Pairs());
+		}
+
+		/** Move constructor. */
+		Tree(Tree&& Moved) noexcept : bounds(Moved.bounds), looseness(Moved.looseness), pairs(std::move(Moved.pairs)), nodes(std::move(Moved.nodes)), root(Moved.root) {
+			Moved.root = new Node(Moved.bounds);
 		}
 
 		/** Destructor. */
 		~Tree() {
+			root->Release(*this);
 			delete root;
 			root = nullptr;
 		}
@@ -575,12 +916,12 @@ namespace Toolbox {
 			if (this == &Copied) {
 				return *this;
 			}
-			bounds = Copied.bounds;
 			Clear();
-			Vector<Pair> Pairs = Copied.Pairs();
-			for (auto& Pair : Pairs) {
-				Insert(Pair.Data, Pair.Position());
-			}
+			bounds = Copied.bounds;
+			looseness = Copied.looseness;
+			delete root;
+			root = new Node(bounds);
+			Load(Copied.Pairs());
 			return *this;
 		}
 
@@ -589,22 +930,28 @@ namespace Toolbox {
 			if (this == &Moved) {
 				return *this;
 			}
+			root->Release(*this);
+			delete root;
 			bounds = Moved.bounds;
-			Clear();
-			Vector<Pair> Pairs = Moved.Pairs();
-			for (auto& Pair : Pairs) {
-				Insert(Pair.Data, Pair.Position());
-			}
-			Moved.Clear();
+			looseness = Moved.looseness;
+			pairs = std::move(Moved.pairs);
+			nodes = std::move(Moved.nodes);
+			root = Moved.root;
+			Moved.root = new Node(Moved.bounds);
 			return *this;
 		}
 
 
 		// GETTERS
 
+		/** Returns the allocator used for this tree's pairs and nodes. */
+		const AllocatorType& GetAllocator() const {
+			return pairs.GetAllocator();
+		}
+
 		/** Calculates and returns the current size of the tree. */
 		size_t Size() const {
-			return root->Count();
+			return pairs.Size();
 		}
 
 		/** Returns the current depth of the tree. */
@@ -612,11 +959,23 @@ namespace Toolbox {
 			return root->Depth();
 		}
 
+		/** Returns a snapshot of the shape of this tree's nodes, such as its depth and how many pairs each node stores. */
+		TreeStats Statistics() const {
+			TreeStats Statistics;
+			root->RecursiveStatistics(0, Statistics);
+			return Statistics;
+		}
+
 		/** Returns the bounds of this tree. */
 		const Box& Bounds() const {
 			return bounds;
 		}
 
+		/** Returns how much larger each child node's loose bounds are than its bounds. */
+		PrecisionType Looseness() const {
+			return looseness;
+		}
+
 		/** Returns a constant pointer to the root node of this tree. */
 		const Node* Root() const {
 			return root;
@@ -629,7 +988,27 @@ namespace Toolbox {
 
 		/** Returns a constant pointer to the pair closest to the given position. */
 		const Pair* Find(const Point& Position) const {
-			return root->Find(Position);
+			return static_cast<const Node*>(root)->Find(Position);
+		}
+
+		/** Replaces the given results with pointers to the given number of pairs closest to the given position, nearest first, and returns how many were found. */
+		size_t FindNearest(const Point& Position, const size_t Count, Vector<Pair*>& Results) {
+			return root->FindNearest(Position, Count, Results);
+		}
+
+		/** Replaces the given results with constant pointers to the given number of pairs closest to the given position, nearest first, and returns how many were found. */
+		size_t FindNearest(const Point& Position, const size_t Count, Vector<const Pair*>& Results) const {
+			return static_cast<const Node*>(root)->FindNearest(Position, Count, Results);
+		}
+
+		/** Replaces the given results with pointers to each pair within the given radius of the given position and returns how many were found. */
+		size_t FindWithinRadius(const Point& Position, const PrecisionType Radius, Vector<Pair*>& Results) {
+			return root->FindWithinRadius(Position, Radius, Results);
+		}
+
+		/** Replaces the given results with constant pointers to each pair within the given radius of the given position and returns how many were found. */
+		size_t FindWithinRadius(const Point& Position, const PrecisionType Radius, Vector<const Pair*>& Results) const {
+			return static_cast<const Node*>(root)->FindWithinRadius(Position, Radius, Results);
 		}
 
 		/** Returns a vector of pointers to the pairs within the matching quadrant of the given position. */
@@ -639,7 +1018,7 @@ namespace Toolbox {
 
 		/** Returns a vector of constant pointers to the pairs within the matching quadrant of the given position. */
 		Vector<const Pair*> FindAll(const Point& Position) const {
-			return root->FindAll(Position);
+			return static_cast<const Node*>(root)->FindAll(Position);
 		}
 
 		/** Returns a vector of pointers to each of the pairs within the given area. */
@@ -649,7 +1028,7 @@ namespace Toolbox {
 
 		/** Returns a vector of constant pointers to each of the pairs within the given area. */
 		Vector<const Pair*> Query(const Box& Area) const {
-			return root->Query(Area);
+			return static_cast<const Node*>(root)->Query(Area);
 		}
 
 		/** Returns whether the given pair is within the tree. */
@@ -664,21 +1043,79 @@ namespace Toolbox {
 
 		/** Returns a vector of constant pointers to each of the pairs in this tree. */
 		Vector<const Pair*> Pairs() const {
-			return root->AllPairs();
+			return static_cast<const Node*>(root)->AllPairs();
 		}
 
 
 		// EXPANSION
 
-		/** Deallocates the tree. */
+		/** Removes every pair from the tree while keeping its memory for future pairs and nodes. */
 		void Clear() {
-			delete root;
-			root = new Node(bounds);
+			root->Release(*this);
 		}
 
-		/** Inserts a new pair into the tree and returns a pointer to it. */
+		/** Inserts a new pair into the tree and returns a pointer to it, or nullptr if the position is outside of the tree. */
 		Pair* Insert(const Type& Data, const Point& Position) {
-			return root->Insert(Data, Position);
+			if (!bounds.Contains(Position)) {
+				return nullptr;
+			}
+			Pair* New = pairs.New(Data, Position);
+			TOOLBOX_COUNT(Tree, Allocations, 1);
+			TOOLBOX_COUNT(Tree, AllocatedBytes, sizeof(Pair));
+			root->RecursivePlace(*this, New, 0);
+			return New;
+		}
+
+		/** Removes and frees the given pair from the tree. */
+		void Remove(Pair* Pair) {
+			if (Pair == nullptr || Pair->node == nullptr) {
+				throw std::runtime_error("ERROR: The given pair is not within this tree!");
+			}
+			Pair->node->Unlink(Pair);
+			pairs.Delete(Pair);
+			TOOLBOX_COUNT(Tree, Deallocations, 1);
+			TOOLBOX_COUNT(Tree, DeallocatedBytes, sizeof(*Pair));
+		}
+
+		/**
+		 * Moves the given pair to the given position and returns whether it was moved, which fails if the position is outside of the tree.<br/>
+		 * Pairs that stay within their node's loose bounds are not restructured, otherwise they only walk up as far as the first node containing the position and back down.
+		 */
+		bool Move(Pair* Pair, const Point& Position) {
+			if (Pair == nullptr || Pair->node == nullptr) {
+				throw std::runtime_error("ERROR: The given pair is not within this tree!");
+			}
+			if (!bounds.Contains(Position)) {
+				return false;
+			}
+			Node* Current = Pair->node;
+			if (Current->loose.Contains(Position)) {
+				Pair->position = Position;
+				return true;
+			}
+			Node* Ancestor = Current;
+			while (Ancestor->parent != nullptr && !Ancestor->bounds.Contains(Position)) {
+				Ancestor = Ancestor->parent;
+			}
+			Current->Unlink(Pair);
+			Pair->position = Position;
+			Ancestor->RecursivePlace(*this, Pair, Ancestor->Level());
+			return true;
+		}
+
+		/**
+		 * Rebuilds the tree's hierarchy from its current pairs in Morton order, which collapses nodes left empty by moved or removed pairs.<br/>
+		 * Pointers to pairs remain valid and the previous nodes' memory is reused.
+		 */
+		void Rebuild() {
+			Vector<Entry> Entries;
+			Entries.Reserve(pairs.Size());
+			for (auto& Pair : Pairs()) {
+				Entries.PushBack(Entry{ MortonCode(Pair->Position()), Pair });
+			}
+			root->Release(*this, true);
+			Sorting::RadixSort(Entries.begin(), Entries.end(), [](const Entry& Entry) { return Entry.Code; });
+			root->RecursiveLoad(*this, Entries.begin(), 0, Entries.Size(), 0, MortonLevels());
 		}
 
 
@@ -3,6 +3,7 @@
 // by Kyle Furey
 
 #pragma once
+#include <utility>
 #include <stdexcept>
 
 /** A collection of useful template types in C++. */
@@ -139,7 +140,7 @@ namespace Toolbox {
 
 		/** Array operator. */
 		Type& operator[](const size_t Index) {
-			static_assert(DELETE_FUNC == DeleteArray, "ERROR: Cannot use array operator on non-array pointers!");
+			static_assert(DELETE_FUNC == DeleteArray<Type>, "ERROR: Cannot use array operator on non-array pointers!");
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
@@ -148,7 +149,7 @@ namespace Toolbox {
 
 		/** Constant array operator. */
 		const Type& operator[](const size_t Index) const {
-			static_assert(DELETE_FUNC == DeleteArray, "ERROR: Cannot use array operator on non-array pointers!");
+			static_assert(DELETE_FUNC == DeleteArray<Type>, "ERROR: Cannot use array operator on non-array pointers!");
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
@@ -178,8 +179,11 @@ namespace Toolbox {
 
 		// GETTERS
 
+		/** The type of the function used to delete memory. */
+		using DeleteFunctionType = void(*)(Type*);
+
 		/** Returns the function used to delete memory. */
-		void(*DeleteFunction() const)(Type*) {
+		DeleteFunctionType DeleteFunction() const {
 			return DELETE_FUNC;
 		}
 
@@ -243,4 +247,13 @@ namespace Toolbox {
 	/** A wrapper for an array pointer that automatically manages its memory without shared usage. */
 	template <typename Type>
 	using UniqueArray = Unique<Type, DeleteArray>;
+
+
+	// MAKE UNIQUE
+
+	/** Constructs a new object owned by a unique pointer. */
+	template<typename Type, typename... ArgumentTypes>
+	static Unique<Type> MakeUnique(ArgumentTypes&&... Arguments) {
+		return Unique<Type>(new Type(std::forward<ArgumentTypes>(Arguments)...));
+	}
 }
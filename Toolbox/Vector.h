@@ -8,139 +8,342 @@
 #include <initializer_list>
 #include <stdexcept>
 #include <utility>
+#include <new>
+#include <cstring>
+#include <type_traits>
 #include "Toolbox/Sorting.h"
+#include "Toolbox/Allocator.h"
+#include "Toolbox/Stats.h"
+
+// Whether element accessors like operator[] and Get() skip their bounds checks (At() is always checked).
+#ifndef TOOLBOX_UNCHECKED
+#define TOOLBOX_UNCHECKED 0
+#endif
+
+// Marks a function as rarely called so compilers keep it out of hot loops.
+#if defined(_MSC_VER)
+#define TOOLBOX_COLD __declspec(noinline)
+#else
+#define TOOLBOX_COLD __attribute__((noinline, cold))
+#endif
 
 /** A collection of useful template types in C++. */
 namespace Toolbox {
 
-	// VECTOR
+	// BOUNDS CHECKING
+
+	/** Throws an error for the given index being out of bounds of the given collection with the given size. */
+	[[noreturn]] TOOLBOX_COLD static void ThrowOutOfBounds(const size_t Index, const char* Collection, const size_t Size, const char* Measure = "size") {
+		throw std::runtime_error(
+			std::string("ERROR: Index ") +
+			std::to_string(Index) +
+			" is out of bounds of the " + Collection + " of " + Measure + " " +
+			std::to_string(Size) + ".");
+	}
+
+	/** Throws an error for accessing an element in the given empty collection. */
+	[[noreturn]] TOOLBOX_COLD static void ThrowEmpty(const char* Collection) {
+		throw std::runtime_error(std::string("ERROR: The ") + Collection + " is empty!");
+	}
+
+
+	// INLINE STORAGE
+
+	/** Uninitialized memory for the given number of elements stored directly inside a vector. */
+	template<typename Type, size_t CAPACITY>
+	struct InlineStorage {
+	protected:
+
+		// DATA
+
+		/** The raw memory of each inline element. */
+		alignas(Type) unsigned char buffer[sizeof(Type) * CAPACITY];
 
-	/** Represents a dynamic array of the given type. */
+
+		// BUFFER
+
+		/** Returns a pointer to the first inline element. */
+		Type* Buffer() {
+			return reinterpret_cast<Type*>(buffer);
+		}
+
+		/** Returns a constant pointer to the first inline element. */
+		const Type* Buffer() const {
+			return reinterpret_cast<const Type*>(buffer);
+		}
+	};
+
+	/** An empty inline storage that takes up no space in a vector through the empty base optimization. */
 	template<typename Type>
-	class Vector final {
+	struct InlineStorage<Type, 0> {
+	protected:
+
+		// BUFFER
+
+		/** Returns nullptr since there is no inline storage. */
+		Type* Buffer() const {
+			return nullptr;
+		}
+	};
+
+
+	// VECTOR
+
+	/**
+	 * Represents a dynamic array of the given type.<br/>
+	 * The first INLINE_CAPACITY elements are stored inside the vector itself and only larger vectors allocate memory with the given allocator.
+	 */
+	template<typename Type, size_t INLINE_CAPACITY = 0, typename AllocatorType = HeapAllocator>
+	class Vector final : private InlineStorage<Type, INLINE_CAPACITY> {
+
+		template<typename, size_t, typename>
+		friend class Vector;
 
 		// DATA
 
+		/** The allocator the vector's memory is allocated with. */
+		TOOLBOX_NO_UNIQUE_ADDRESS AllocatorType allocator;
+
 		/** The current size of the vector. */
 		size_t size;
 
 		/** The current maximum size of the vector. */
 		size_t capacity;
 
-		/** The underlying array of this type. */
+		/** The underlying uninitialized array of this type, where only the first size elements are constructed. */
 		Type* data;
 
+
+		// MEMORY
+
+		/** Returns the capacity the vector actually holds when the given capacity is requested. */
+		static constexpr size_t Fit(const size_t Capacity) {
+			return Capacity > INLINE_CAPACITY ? Capacity : INLINE_CAPACITY;
+		}
+
+		/** Returns uninitialized memory for the given number of elements, using the inline storage when it fits. */
+		Type* Allocate(const size_t Capacity) {
+			if (Capacity <= INLINE_CAPACITY) {
+				return this->Buffer();
+			}
+			TOOLBOX_COUNT(Vector, Allocations, 1);
+			TOOLBOX_COUNT(Vector, AllocatedBytes, sizeof(Type) * Capacity);
+			return static_cast<Type*>(allocator.Allocate(sizeof(Type) * Capacity, alignof(Type)));
+		}
+
+		/** Returns the given memory of the given capacity to the allocator without destroying its elements unless it is the inline storage. */
+		void Deallocate(Type* Array, const size_t Capacity) {
+			if (Array != nullptr && Array != this->Buffer()) {
+				TOOLBOX_COUNT(Vector, Deallocations, 1);
+				TOOLBOX_COUNT(Vector, DeallocatedBytes, sizeof(Type) * Capacity);
+				allocator.Deallocate(Array, sizeof(Type) * Capacity, alignof(Type));
+			}
+		}
+
+		/** Takes the elements of the given vector into this empty vector, moving them individually when its memory cannot be taken. */
+		template<size_t OTHER_CAPACITY>
+		void Steal(Vector<Type, OTHER_CAPACITY, AllocatorType>& Moved) {
+			if (Moved.data == nullptr) {
+				return;
+			}
+			if (Moved.IsInline() || Moved.capacity <= INLINE_CAPACITY || !(allocator == Moved.allocator)) {
+				data = Allocate(Moved.size);
+				capacity = Fit(Moved.size);
+				Relocate(Moved.data, Moved.data + Moved.size, data);
+				size = Moved.size;
+				Moved.size = 0;
+				return;
+			}
+			data = Moved.data;
+			capacity = Moved.capacity;
+			size = Moved.size;
+			Moved.size = 0;
+			Moved.capacity = OTHER_CAPACITY;
+			Moved.data = Moved.Buffer();
+		}
+
+		/** Replaces the vector's elements with copies of the given vector's elements. */
+		template<size_t OTHER_CAPACITY>
+		void Assign(const Vector<Type, OTHER_CAPACITY, AllocatorType>& Copied) {
+			Clear();
+			if (capacity < Copied.size) {
+				Deallocate(data, capacity);
+				data = Allocate(Copied.size);
+				capacity = Fit(Copied.size);
+			}
+			CopyInto(Copied.data, Copied.data + Copied.size, data);
+			size = Copied.size;
+		}
+
+		/** Destroys each element in the given range. */
+		static void Destroy(Type* Begin, Type* End) {
+			if constexpr (!std::is_trivially_destructible_v<Type>) {
+				while (Begin != End) {
+					Begin->~Type();
+					++Begin;
+				}
+			}
+		}
+
+		/** Moves each element in the given range into the given uninitialized memory and destroys the originals. The memory may only be null when the range is empty. */
+		static void Relocate(Type* Begin, Type* End, Type* Destination) {
+			if constexpr (std::is_trivially_copyable_v<Type>) {
+				if (Begin != End && Destination != nullptr) {
+					std::memcpy(static_cast<void*>(Destination), static_cast<const void*>(Begin), sizeof(Type) * (End - Begin));
+				}
+			}
+			else {
+				while (Begin != End) {
+					new(Destination) Type(std::move(*Begin));
+					Begin->~Type();
+					++Begin;
+					++Destination;
+				}
+			}
+		}
+
+		/** Copies each element in the given range into the given uninitialized memory. The memory may only be null when the range is empty. */
+		static void CopyInto(const Type* Begin, const Type* End, Type* Destination) {
+			if constexpr (std::is_trivially_copyable_v<Type>) {
+				if (Begin != End && Destination != nullptr) {
+					std::memcpy(static_cast<void*>(Destination), static_cast<const void*>(Begin), sizeof(Type) * (End - Begin));
+				}
+			}
+			else {
+				while (Begin != End) {
+					new(Destination) Type(*Begin);
+					++Begin;
+					++Destination;
+				}
+			}
+		}
+
+		/** Returns the capacity the vector grows to when it cannot hold one more element. */
+		size_t NextCapacity() const {
+			return capacity > 0 ? capacity * 2 : 1;
+		}
+
 	public:
 
 		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		Vector() : size(0), capacity(0), data(nullptr) {
+		Vector() : allocator(), size(0), capacity(INLINE_CAPACITY), data(this->Buffer()) {
+		}
+
+		/** Allocator constructor. */
+		explicit Vector(const AllocatorType& Allocator) : allocator(Allocator), size(0), capacity(INLINE_CAPACITY), data(this->Buffer()) {
 		}
 
 		/** Fill constructor. */
-		Vector(const size_t Size, const Type& Value = Type()) : size(Size), capacity(Size), data(new Type[Size]) {
-			for (size_t Index = 0; Index < Size; ++Index) {
-				data[Index] = Value;
+		Vector(const size_t Size, const Type& Value = Type(), const AllocatorType& Allocator = AllocatorType()) : allocator(Allocator), size(0), capacity(Fit(Size)), data(Allocate(Size)) {
+			for (; size < Size; ++size) {
+				new(&data[size]) Type(Value);
 			}
 		}
 
 		/** Array constructor. */
-		Vector(const size_t Size, const Type* Array) : size(Size), capacity(Size), data(new Type[Size]) {
+		Vector(const size_t Size, const Type* Array, const AllocatorType& Allocator = AllocatorType()) : allocator(Allocator), size(0), capacity(Fit(Size)), data(Allocate(Size)) {
 			if (Array == nullptr) {
-				for (size_t Index = 0; Index < Size; ++Index) {
-					data[Index] = Type();
+				for (; size < Size; ++size) {
+					new(&data[size]) Type();
 				}
 				return;
 			}
-			for (size_t Index = 0; Index < Size; ++Index) {
-				data[Index] = Array[Index];
-			}
+			CopyInto(Array, Array + Size, data);
+			size = Size;
 		}
 
 		/** Initializer list constructor. */
-		Vector(const std::initializer_list<Type>& List) : size(List.size()), capacity(List.size()), data(new Type[List.size()]) {
-			for (size_t Index = 0; Index < List.size(); ++Index) {
-				data[Index] = *(List.begin() + Index);
-			}
+		Vector(const std::initializer_list<Type>& List, const AllocatorType& Allocator = AllocatorType()) : allocator(Allocator), size(0), capacity(Fit(List.size())), data(Allocate(List.size())) {
+			CopyInto(List.begin(), List.end(), data);
+			size = List.size();
 		}
 
 		/** Copy constructor. */
-		Vector(const Vector<Type>& Copied) : size(Copied.size), capacity(Copied.capacity), data(new Type[Copied.capacity]) {
-			for (size_t Index = 0; Index < Copied.size; ++Index) {
-				data[Index] = Copied.data[Index];
-			}
+		Vector(const Vector& Copied) : allocator(Copied.allocator), size(0), capacity(Fit(Copied.capacity)), data(Allocate(Copied.capacity)) {
+			CopyInto(Copied.data, Copied.data + Copied.size, data);
+			size = Copied.size;
+		}
+
+		/** Copy constructor from a vector with a different inline capacity. */
+		template<size_t OTHER_CAPACITY>
+		Vector(const Vector<Type, OTHER_CAPACITY, AllocatorType>& Copied) : allocator(Copied.allocator), size(0), capacity(Fit(Copied.size)), data(Allocate(Copied.size)) {
+			CopyInto(Copied.data, Copied.data + Copied.size, data);
+			size = Copied.size;
 		}
 
 		/** Move constructor. */
-		Vector(Vector<Type>&& Moved) noexcept : size(Moved.size), capacity(Moved.capacity), data(Moved.data) {
-			Moved.size = 0;
-			Moved.capacity = 0;
-			Moved.data = nullptr;
+		Vector(Vector&& Moved) noexcept : allocator(Moved.allocator), size(0), capacity(INLINE_CAPACITY), data(this->Buffer()) {
+			Steal(Moved);
+		}
+
+		/** Move constructor from a vector with a different inline capacity. */
+		template<size_t OTHER_CAPACITY>
+		Vector(Vector<Type, OTHER_CAPACITY, AllocatorType>&& Moved) noexcept : allocator(Moved.allocator), size(0), capacity(INLINE_CAPACITY), data(this->Buffer()) {
+			Steal(Moved);
 		}
 
 		/** Destructor. */
 		~Vector() {
-			size = 0;
-			capacity = 0;
-			delete[] data;
-			data = nullptr;
+			Clear();
+			Deallocate(data, capacity);
 		}
 
 
 		// OPERATORS
 
 		/** Copy assignment operator. */
-		Vector<Type>& operator=(const Vector<Type>& Copied) {
+		Vector& operator=(const Vector& Copied) {
 			if (this == &Copied) {
 				return *this;
 			}
-			size = Copied.size;
-			capacity = Copied.capacity;
-			delete[] data;
-			data = new Type[capacity];
-			for (size_t Index = 0; Index < Copied.size; ++Index) {
-				data[Index] = Copied.data[Index];
-			}
+			Assign(Copied);
+			return *this;
+		}
+
+		/** Copy assignment operator from a vector with a different inline capacity. */
+		template<size_t OTHER_CAPACITY>
+		Vector& operator=(const Vector<Type, OTHER_CAPACITY, AllocatorType>& Copied) {
+			Assign(Copied);
 			return *this;
 		}
 
 		/** Move assignment operator. */
-		Vector<Type>& operator=(Vector<Type>&& Moved) noexcept {
+		Vector& operator=(Vector&& Moved) noexcept {
 			if (this == &Moved) {
 				return *this;
 			}
-			size = Moved.size;
-			capacity = Moved.capacity;
-			delete[] data;
-			data = Moved.data;
-			Moved.size = 0;
-			Moved.capacity = 0;
-			Moved.data = nullptr;
+			Reset();
+			Steal(Moved);
+			return *this;
+		}
+
+		/** Move assignment operator from a vector with a different inline capacity. */
+		template<size_t OTHER_CAPACITY>
+		Vector& operator=(Vector<Type, OTHER_CAPACITY, AllocatorType>&& Moved) noexcept {
+			Reset();
+			Steal(Moved);
 			return *this;
 		}
 
 		/** Returns a reference to the data at the given index. */
 		Type& operator[](const size_t Index) {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
 			}
+#endif
 			return data[Index];
 		}
 
 		/** Returns a constant reference to the data at the given index. */
 		const Type& operator[](const size_t Index) const {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
 			}
+#endif
 			return data[Index];
 		}
 
@@ -175,6 +378,16 @@ namespace Toolbox {
 			return size;
 		}
 
+		/** Returns whether the vector's elements are currently stored inline. */
+		bool IsInline() const {
+			return INLINE_CAPACITY > 0 && data == this->Buffer();
+		}
+
+		/** Returns the allocator the vector's memory is allocated with. */
+		const AllocatorType& GetAllocator() const {
+			return allocator;
+		}
+
 		/** Returns the current maximum number of elements in the vector. */
 		size_t Capacity() const {
 			return capacity;
@@ -187,57 +400,87 @@ namespace Toolbox {
 
 		/** Returns a reference to the data at the given index. */
 		Type& Get(const size_t Index) {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
 			}
+#endif
 			return data[Index];
 		}
 
 		/** Returns a constant reference to the data at the given index. */
 		const Type& Get(const size_t Index) const {
+#if !TOOLBOX_UNCHECKED
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
 			}
+#endif
+			return data[Index];
+		}
+
+		/** Returns a reference to the data at the given index, always checking its bounds. */
+		Type& At(const size_t Index) {
+			if (!IsValidIndex(Index)) {
+				ThrowOutOfBounds(Index, "vector", size);
+			}
+			return data[Index];
+		}
+
+		/** Returns a constant reference to the data at the given index, always checking its bounds. */
+		const Type& At(const size_t Index) const {
+			if (!IsValidIndex(Index)) {
+				ThrowOutOfBounds(Index, "vector", size);
+			}
+			return data[Index];
+		}
+
+		/** Returns a reference to the data at the given index without checking its bounds. */
+		Type& Unchecked(const size_t Index) {
+			return data[Index];
+		}
+
+		/** Returns a constant reference to the data at the given index without checking its bounds. */
+		const Type& Unchecked(const size_t Index) const {
 			return data[Index];
 		}
 
 		/** Returns a reference to the data at the front of the vector. */
 		Type& Front() {
+#if !TOOLBOX_UNCHECKED
 			if (size == 0) {
-				throw std::runtime_error("ERROR: The vector is empty!");
+				ThrowEmpty("vector");
 			}
+#endif
 			return data[0];
 		}
 
 		/** Returns a constant reference to the data at the front of the vector. */
 		const Type& Front() const {
+#if !TOOLBOX_UNCHECKED
 			if (size == 0) {
-				throw std::runtime_error("ERROR: The vector is empty!");
+				ThrowEmpty("vector");
 			}
+#endif
 			return data[0];
 		}
 
 		/** Returns a reference to the data at the back of the vector. */
 		Type& Back() {
+#if !TOOLBOX_UNCHECKED
 			if (size == 0) {
-				throw std::runtime_error("ERROR: The vector is empty!");
+				ThrowEmpty("vector");
 			}
+#endif
 			return data[size - 1];
 		}
 
 		/** Returns a constant reference to the data at the back of the vector. */
 		const Type& Back() const {
+#if !TOOLBOX_UNCHECKED
 			if (size == 0) {
-				throw std::runtime_error("ERROR: The vector is empty!");
+				ThrowEmpty("vector");
 			}
+#endif
 			return data[size - 1];
 		}
 
@@ -296,11 +539,7 @@ namespace Toolbox {
 		/** Sets the data at the given index with a copy of the given value. */
 		void Set(const size_t Index, const Type& Value) {
 			if (!IsValidIndex(Index)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
 			}
 			data[Index] = Value;
 		}
@@ -308,22 +547,12 @@ namespace Toolbox {
 		/** Swaps the given elements at the given indicies. */
 		void Swap(const size_t Left, const size_t Right) {
 			if (!IsValidIndex(Left)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Left) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Left, "vector", size);
 			}
 			if (!IsValidIndex(Right)) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Right) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Right, "vector", size);
 			}
-			const Type Swapped = data[Left];
-			data[Left] = data[Right];
-			data[Right] = Swapped;
+			std::swap(data[Left], data[Right]);
 		}
 
 		/** Fills the vector with a copy of the given value. */
@@ -340,30 +569,49 @@ namespace Toolbox {
 
 		/** Merge sorts the vector using Type's > operator. */
 		void MergeSort() {
-			Sorting::MergeSort<Vector, Type>(size, *this);
+			Sorting::StableSort(data, data + size);
 		}
 
 		/** Quick sorts the vector using Type's > operator. */
 		void QuickSort() {
-			Sorting::QuickSort<Vector, Type>(size, *this);
+			Sorting::IntroSort(data, data + size);
+		}
+
+		/** Sorts the vector with an introspective quick sort using the given comparer, which returns whether the left element belongs after the right element. */
+		template<typename ComparerType = Sorting::Greater>
+		void Sort(ComparerType Comparer = ComparerType()) {
+			Sorting::IntroSort(data, data + size, Comparer);
+		}
+
+		/** Stably sorts the vector with a merge sort using the given comparer, which returns whether the left element belongs after the right element. */
+		template<typename ComparerType = Sorting::Greater>
+		void StableSort(ComparerType Comparer = ComparerType()) {
+			Sorting::StableSort(data, data + size, Comparer);
+		}
+
+		/** Stably sorts the vector's integers or floating point numbers in ascending order with a radix sort. */
+		void RadixSort() {
+			Sorting::RadixSort(data, data + size);
+		}
+
+		/** Stably sorts the vector in ascending order of the integer or floating point key returned for each element with a radix sort. */
+		template<typename KeyFunctionType>
+		void RadixSort(KeyFunctionType Key) {
+			Sorting::RadixSort(data, data + size, Key);
 		}
 
 		/** Reverses the vector. */
 		void Reverse() {
 			for (size_t Index = 0; Index < size / 2; ++Index) {
-				const Type Swapped = data[Index];
-				data[Index] = data[size - Index - 1];
-				data[size - Index - 1] = Swapped;
+				std::swap(data[Index], data[size - Index - 1]);
 			}
 		}
 
 		/** Shuffles the vector. */
 		void Shuffle() {
 			for (size_t Index = 0; Index < size; ++Index) {
-				const Type Swapped = data[Index];
 				const size_t Random = std::rand() % size;
-				data[Index] = data[Random];
-				data[Random] = Swapped;
+				std::swap(data[Index], data[Random]);
 			}
 		}
 
@@ -372,34 +620,37 @@ namespace Toolbox {
 
 		/**
 		  * Relocates the vector to new memory to contain the given capacity.
-		  * If NewCapacity is less than the current size, elements at and following NewCapacity are deleted.
+		  * If NewCapacity is less than the current size, elements at and following NewCapacity are destroyed.<br/>
+		  * Elements are moved into the new memory and unused capacity is never constructed.<br/>
+		  * The capacity never drops below the vector's inline capacity.
 		  */
 		void Resize(const size_t NewCapacity) {
-			if (capacity == NewCapacity) {
-				return;
+			if (NewCapacity < size) {
+				Destroy(data + NewCapacity, data + size);
+				size = NewCapacity;
 			}
-			size = size < NewCapacity ? size : NewCapacity;
-			capacity = NewCapacity;
-			if (NewCapacity > 0) {
-				Type* Array = new Type[NewCapacity];
-				for (size_t Index = 0; Index < size; ++Index) {
-					Array[Index] = data[Index];
-				}
-				for (size_t Index = size; Index < capacity; ++Index) {
-					Array[Index] = Type();
-				}
-				delete[] data;
-				data = Array;
+			const size_t Fitted = Fit(NewCapacity);
+			if (capacity == Fitted) {
+				return;
 			}
-			else {
-				delete[] data;
-				data = nullptr;
+			TOOLBOX_COUNT(Vector, Growths, Fitted > capacity);
+			Type* Array = Allocate(Fitted);
+			Relocate(data, data + size, Array);
+			Deallocate(data, capacity);
+			data = Array;
+			capacity = Fitted;
+		}
+
+		/** Ensures the vector can hold at least the given number of elements without reallocating. */
+		void Reserve(const size_t Capacity) {
+			if (Capacity > capacity) {
+				Resize(Capacity);
 			}
 		}
 
 		/** Doubles the current capacity of the vector. */
 		void Expand() {
-			Resize(capacity > 0 ? capacity * 2 : 1);
+			Resize(NextCapacity());
 		}
 
 		/** Resizes the vector's capacity to its current size. */
@@ -407,91 +658,126 @@ namespace Toolbox {
 			Resize(size);
 		}
 
-		/** Sets the vector's size to zero. */
+		/** Destroys each element in the vector while keeping its memory. */
 		void Clear() {
+			Destroy(data, data + size);
 			size = 0;
 		}
 
 		/** Deallocates the vector. */
 		void Reset() {
-			size = 0;
-			capacity = 0;
-			delete[] data;
-			data = nullptr;
+			Clear();
+			Deallocate(data, capacity);
+			capacity = INLINE_CAPACITY;
+			data = this->Buffer();
 		}
 
 		/** Inserts a copy of the given data at the given index in the vector. */
 		Type& Insert(const size_t Index, const Type& Value) {
-			if (Index > size) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
-			}
-			if (size + 1 > capacity) {
-				Expand();
-			}
-			for (size_t Current = size; Current > Index; --Current) {
-				data[Current] = data[Current - 1];
-			}
-			++size;
-			return data[Index] = Value;
+			return Emplace(Index, Value);
+		}
+
+		/** Inserts the given data at the given index in the vector. */
+		Type& Insert(const size_t Index, Type&& Value) {
+			return Emplace(Index, std::move(Value));
 		}
 
 		/** Pushes a copy of the given data to the front of the vector. */
 		Type& PushFront(const Type& Value) {
-			return Insert(0, Value);
+			return Emplace(0, Value);
+		}
+
+		/** Pushes the given data to the front of the vector. */
+		Type& PushFront(Type&& Value) {
+			return Emplace(0, std::move(Value));
 		}
 
 		/** Pushes a copy of the given data to the back of the vector. */
 		Type& PushBack(const Type& Value) {
-			return Insert(size, Value);
+			return EmplaceBack(Value);
+		}
+
+		/** Pushes the given data to the back of the vector. */
+		Type& PushBack(Type&& Value) {
+			return EmplaceBack(std::move(Value));
 		}
 
-		/** Inserts a new element with the given arguments at the given index in the vector. */
+		/** Constructs a new element in place with the given arguments at the given index in the vector. */
 		template<typename... ArgumentTypes>
 		Type& Emplace(const size_t Index, ArgumentTypes&&... Arguments) {
 			if (Index > size) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
+			}
+			if (size == capacity) {
+				const size_t NewCapacity = NextCapacity();
+				TOOLBOX_COUNT(Vector, Growths, 1);
+				Type* Array = Allocate(NewCapacity);
+				try {
+					new(&Array[Index]) Type(std::forward<ArgumentTypes>(Arguments)...);
+				}
+				catch (...) {
+					Deallocate(Array, NewCapacity);
+					throw;
+				}
+				Relocate(data, data + Index, Array);
+				Relocate(data + Index, data + size, Array + Index + 1);
+				Deallocate(data, capacity);
+				data = Array;
+				capacity = NewCapacity;
+				++size;
+				return data[Index];
 			}
-			if (size + 1 > capacity) {
-				Expand();
+			if (Index == size) {
+				new(&data[size]) Type(std::forward<ArgumentTypes>(Arguments)...);
+				++size;
+				return data[Index];
 			}
-			++size;
-			for (size_t Current = size - 1; Current > Index; --Current) {
-				data[Current] = data[Current - 1];
+			Type Value(std::forward<ArgumentTypes>(Arguments)...);
+			if constexpr (std::is_trivially_copyable_v<Type>) {
+				std::memmove(static_cast<void*>(data + Index + 1), static_cast<const void*>(data + Index), sizeof(Type) * (size - Index));
+				new(&data[Index]) Type(std::move(Value));
+			}
+			else {
+				new(&data[size]) Type(std::move(data[size - 1]));
+				for (size_t Current = size - 1; Current > Index; --Current) {
+					data[Current] = std::move(data[Current - 1]);
+				}
+				data[Index] = std::move(Value);
 			}
-			return data[Index] = Type(std::forward<ArgumentTypes>(Arguments)...);
+			++size;
+			return data[Index];
 		}
 
-		/** Pushes a new element with the given arguments to the front of the vector. */
+		/** Constructs a new element in place with the given arguments at the front of the vector. */
 		template<typename... ArgumentTypes>
 		Type& EmplaceFront(ArgumentTypes&&... Arguments) {
-			return Emplace(0, Arguments...);
+			return Emplace(0, std::forward<ArgumentTypes>(Arguments)...);
 		}
 
-		/** Pushes a new element with the given arguments to the back of the vector. */
+		/** Constructs a new element in place with the given arguments at the back of the vector. */
 		template<typename... ArgumentTypes>
 		Type& EmplaceBack(ArgumentTypes&&... Arguments) {
-			return Emplace(size, Arguments...);
+			if (size == capacity) {
+				return Emplace(size, std::forward<ArgumentTypes>(Arguments)...);
+			}
+			Type* Element = new(&data[size]) Type(std::forward<ArgumentTypes>(Arguments)...);
+			++size;
+			return *Element;
 		}
 
 		/** Removes the element at the given index. */
 		void Erase(const size_t Index) {
 			if (Index >= size) {
-				throw std::runtime_error(
-					std::string("ERROR: Index ") +
-					std::to_string(Index) +
-					" is out of bounds of the vector of size " +
-					std::to_string(size) + ".");
+				ThrowOutOfBounds(Index, "vector", size);
+			}
+			if constexpr (std::is_trivially_copyable_v<Type>) {
+				std::memmove(static_cast<void*>(data + Index), static_cast<const void*>(data + Index + 1), sizeof(Type) * (size - Index - 1));
 			}
-			for (size_t Current = Index; Current < size - 1; ++Current) {
-				data[Current] = data[Current + 1];
+			else {
+				for (size_t Current = Index; Current < size - 1; ++Current) {
+					data[Current] = std::move(data[Current + 1]);
+				}
+				data[size - 1].~Type();
 			}
 			--size;
 		}
@@ -503,7 +789,11 @@ namespace Toolbox {
 
 		/** Removes the element at the back of the vector. */
 		void PopBack() {
-			Erase(size - 1);
+			if (size == 0) {
+				ThrowEmpty("vector");
+			}
+			--size;
+			data[size].~Type();
 		}
 
 
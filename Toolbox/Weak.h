@@ -10,21 +10,30 @@ namespace Toolbox {
 
 	// WEAK POINTER
 
-	/** A wrapper for a pointer that can read from other smart pointers' memory without owning it. */
-	template<typename Type, void(*DELETE_FUNC)(Type*) = Delete>
+	/**
+	 * A wrapper for a pointer that can read from other smart pointers' memory without owning it.<br/>
+	 * Thread safe weak pointers count references atomically, but the memory itself is not synchronized.
+	 */
+	template<typename Type, void(*DELETE_FUNC)(Type*) = Delete, bool THREAD_SAFE = false>
 	class Weak final {
 		static_assert(DELETE_FUNC != nullptr, "ERROR: Cannot pass a null function as a template parameter!");
 
 		// FRIENDS
 
-		friend class Shared<Type, DELETE_FUNC>;
+		friend class Shared<Type, DELETE_FUNC, THREAD_SAFE>;
 
 	public:
 
 		// SHARED POINTER
 
 		/** A wrapper for a pointer that automatically manages its memory and tracks new references to it. */
-		using Shared = Shared<Type, DELETE_FUNC>;
+		using Shared = Toolbox::Shared<Type, DELETE_FUNC, THREAD_SAFE>;
+
+
+		// BLOCK
+
+		/** The reference counts shared by every shared and weak pointer to the same memory. */
+		using Block = typename Shared::Block;
 
 
 		// NODE
@@ -36,51 +45,106 @@ namespace Toolbox {
 
 		// DATA
 
-		/** The underlying pointer to the memory node this weak pointer manages. */
-		Node* node;
+		/** The underlying pointer to the reference counts this weak pointer shares. */
+		Block* block;
+
+		/** The pointer this weak pointer reads instead of its node's memory, or null if this weak pointer is not aliased. */
+		Type* alias;
+
+
+		// HELPERS
+
+		/** Returns the node this weak pointer reads (only valid if this weak pointer is not aliased). */
+		Node* Owner() const {
+			return static_cast<Node*>(block);
+		}
+
+		/** Returns the pointer this weak pointer points to, or null if its memory has been freed. */
+		Type* Pointer() const {
+			if (block == nullptr) {
+				return nullptr;
+			}
+			if (alias != nullptr) {
+				return block->SharedCount() > 0 && block->IsAlive() ? alias : nullptr;
+			}
+			return Owner()->Data();
+		}
+
+		/** Shares the given reference counts and pointer, releasing this weak pointer's previous reference. */
+		void Share(Block* Block, Type* Alias) {
+			if (block == Block && alias == Alias) {
+				return;
+			}
+			if (Block != nullptr) {
+				Block->IncrementWeak();
+			}
+			if (block != nullptr) {
+				block->DecrementWeak();
+			}
+			block = Block;
+			alias = Alias;
+		}
+
+		/** Returns a new shared pointer to this weak pointer's memory, or null if the memory has already been freed. */
+		Shared Lock() const {
+			Shared Result;
+			if (block != nullptr && block->TryIncrementShared()) {
+				Result.block = block;
+				Result.alias = alias;
+			}
+			return Result;
+		}
+
+		/** Throws if this weak pointer is aliased and therefore cannot manage its node's memory. */
+		void CheckOwner() const {
+			if (alias != nullptr) {
+				throw std::runtime_error("ERROR: Cannot manage the memory of an aliased weak pointer!");
+			}
+		}
 
 	public:
 
 		// CONSTRUCTORS AND DESTRUCTOR
 
 		/** Default constructor. */
-		Weak() : node(nullptr) {
+		Weak() : block(nullptr), alias(nullptr) {
 		}
 
 		/** Shared pointer constructor. */
-		Weak(Shared& Data) : node(Data.node) {
-			if (node != nullptr) {
-				node->IncrementWeak();
+		Weak(const Shared& Data) : block(Data.block), alias(Data.alias) {
+			if (block != nullptr) {
+				block->IncrementWeak();
 			}
 		}
 
 		/** Node constructor. */
-		Weak(Node* Node) : node(Node) {
-			if (node != nullptr) {
-				node->IncrementWeak();
+		Weak(Node* Node) : block(Node), alias(nullptr) {
+			if (block != nullptr) {
+				block->IncrementWeak();
 			}
 		}
 
 		/** Copy constructor. */
-		Weak(const Weak& Copied) : node(Copied.node) {
-			if (node != nullptr) {
-				node->IncrementWeak();
+		Weak(const Weak& Copied) : block(Copied.block), alias(Copied.alias) {
+			if (block != nullptr) {
+				block->IncrementWeak();
 			}
 		}
 
 		/** Move constructor. */
-		Weak(Weak&& Moved) noexcept : node(Moved.node) {
-			Moved.node = nullptr;
+		Weak(Weak&& Moved) noexcept : block(Moved.block), alias(Moved.alias) {
+			Moved.block = nullptr;
+			Moved.alias = nullptr;
 		}
 
 		/** Null constructor. */
-		Weak(std::nullptr_t) : node(nullptr) {
+		Weak(std::nullptr_t) : block(nullptr), alias(nullptr) {
 		}
 
 		/** Destructor. */
 		~Weak() {
-			if (node != nullptr) {
-				node->DecrementWeak();
+			if (block != nullptr) {
+				block->DecrementWeak();
 			}
 		}
 
@@ -88,75 +152,48 @@ namespace Toolbox {
 		// OPERATORS
 
 		/** Shared pointer assignment operator. */
-		Weak& operator=(Shared& Data) {
-			if (node != nullptr) {
-				if (node == Data.node) {
-					return *this;
-				}
-				node->DecrementWeak();
-			}
-			node = Data.node;
-			if (node != nullptr) {
-				node->IncrementWeak();
-			}
+		Weak& operator=(const Shared& Data) {
+			Share(Data.block, Data.alias);
 			return *this;
 		}
 
 		/** Node assignment operator. */
 		Weak& operator=(Node* Node) {
-			if (node == Node) {
-				return *this;
-			}
-			if (node != nullptr) {
-				node->DecrementWeak();
-			}
-			node = Node;
-			if (node != nullptr) {
-				node->IncrementWeak();
-			}
+			Share(Node, nullptr);
 			return *this;
 		}
 
 		/** Copy assignment operator. */
 		Weak& operator=(const Weak& Copied) {
-			if (node == Copied.node) {
-				return *this;
-			}
-			if (node != nullptr) {
-				node->DecrementWeak();
-			}
-			node = Copied.node;
-			if (node != nullptr) {
-				node->IncrementWeak();
-			}
+			Share(Copied.block, Copied.alias);
 			return *this;
 		}
 
 		/** Move assignment operator. */
 		Weak& operator=(Weak&& Moved) noexcept {
-			if (node == Moved.node) {
+			if (this == &Moved) {
 				return *this;
 			}
-			if (node != nullptr) {
-				node->DecrementWeak();
+			Block* Previous = block;
+			block = Moved.block;
+			alias = Moved.alias;
+			Moved.block = nullptr;
+			Moved.alias = nullptr;
+			if (Previous != nullptr) {
+				Previous->DecrementWeak();
 			}
-			node = Moved.node;
-			Moved.node = nullptr;
 			return *this;
 		}
 
 		/** Null assignment operator. */
 		Weak& operator=(std::nullptr_t) {
-			if (node != nullptr) {
-				node->DecrementWeak();
-			}
-			node = nullptr;
+			Clear();
 			return *this;
 		}
 
 		/** Equality operator. */
 		bool operator==(const Weak& Other) const {
-			return node == Other.node;
+			return block == Other.block && alias == Other.alias;
 		}
 
 		/** Inequality operator. */
@@ -166,7 +203,7 @@ namespace Toolbox {
 
 		/** Shared pointer equality operator. */
 		bool operator==(const Shared& Other) const {
-			return node == Other.node;
+			return block == Other.block && alias == Other.alias;
 		}
 
 		/** Shared pointer inequality operator. */
@@ -179,7 +216,7 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return *node->Data();
+			return *Pointer();
 		}
 
 		/** Constant dereference operator. */
@@ -187,7 +224,7 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return *node->Data();
+			return *Pointer();
 		}
 
 		/** Arrow operator. */
@@ -195,7 +232,7 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return Shared(node);
+			return Lock();
 		}
 
 		/** Constant arrow operator. */
@@ -203,25 +240,25 @@ namespace Toolbox {
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return Shared(node);
+			return Lock();
 		}
 
 		/** Array operator. */
 		Type& operator[](const size_t Index) {
-			static_assert(DELETE_FUNC == DeleteArray, "ERROR: Cannot use array operator on non-array pointers!");
+			static_assert(DELETE_FUNC == DeleteArray<Type>, "ERROR: Cannot use array operator on non-array pointers!");
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return node->Data()[Index];
+			return Pointer()[Index];
 		}
 
 		/** Constant array operator. */
 		const Type& operator[](const size_t Index) const {
-			static_assert(DELETE_FUNC == DeleteArray, "ERROR: Cannot use array operator on non-array pointers!");
+			static_assert(DELETE_FUNC == DeleteArray<Type>, "ERROR: Cannot use array operator on non-array pointers!");
 			if (!IsValid()) {
 				throw std::runtime_error("ERROR: Dereferencing a null pointer!");
 			}
-			return node->Data()[Index];
+			return Pointer()[Index];
 		}
 
 		/** Not null check operator. */
@@ -236,70 +273,78 @@ namespace Toolbox {
 
 		/** Pointer operator. */
 		explicit operator Type* () {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Constant pointer operator. */
 		explicit operator const Type* () const {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Shared pointer operator. */
 		explicit operator Shared() {
-			return Shared(node);
+			return Lock();
 		}
 
 		/** Constant shared pointer operator. */
 		explicit operator const Shared() const {
-			return Shared(node);
+			return Lock();
 		}
 
 
 		// GETTERS
 
+		/** The type of the function used to delete memory. */
+		using DeleteFunctionType = void(*)(Type*);
+
 		/** Returns the function used to delete memory. */
-		void(*DeleteFunction() const)(Type*) {
+		DeleteFunctionType DeleteFunction() const {
 			return DELETE_FUNC;
 		}
 
 		/** Returns a copy of the raw pointer of this weak pointer. */
 		Type* Raw() {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
 		/** Returns a constant copy of the raw pointer of this weak pointer. */
 		const Type* Raw() const {
-			return node != nullptr ? node->Data() : nullptr;
+			return Pointer();
 		}
 
-		/** Upgrades this weak pointer to a shared pointer. */
+		/** Upgrades this weak pointer to a shared pointer, which is null if the memory has already been freed. */
 		Shared MakeShared() {
-			return Shared(node);
+			return Lock();
 		}
 
-		/** Upgrades this weak pointer to a constant shared pointer. */
+		/** Upgrades this weak pointer to a constant shared pointer, which is null if the memory has already been freed. */
 		const Shared MakeShared() const {
-			return Shared(node);
+			return Lock();
 		}
 
 		/** Returns the total number of shared pointers referencing this weak pointer's shared memory. */
 		size_t SharedCount() const {
-			return node != nullptr ? node->SharedCount() : 0;
+			return block != nullptr ? block->SharedCount() : 0;
 		}
 
 		/** Returns the total number of weak pointers referencing this weak pointer's shared memory. */
 		size_t WeakCount() const {
-			return node != nullptr ? node->WeakCount() : 0;
+			return block != nullptr ? block->WeakCount() : 0;
 		}
 
 		/** Returns the total number of pointers referencing this weak pointer's shared memory. */
 		size_t Total() const {
-			return node != nullptr ? node->SharedCount() + node->WeakCount() : 0;
+			return block != nullptr ? block->SharedCount() + block->WeakCount() : 0;
 		}
 
 		/** Returns whether this weak pointer is not null. */
 		bool IsValid() const {
-			return node != nullptr && node->IsValid();
+			return Pointer() != nullptr;
+		}
+
+		/** Returns whether this weak pointer points into memory owned by another shared pointer. */
+		bool IsAliased() const {
+			return alias != nullptr;
 		}
 
 
@@ -307,30 +352,37 @@ namespace Toolbox {
 
 		/** Swaps this weak pointer's memory with the given weak pointer's memory. */
 		void Swap(Weak& Other) {
-			Node* Node = node;
-			node = Other.node;
-			Other.node = Node;
+			Block* Block = block;
+			Type* Alias = alias;
+			block = Other.block;
+			alias = Other.alias;
+			Other.block = Block;
+			Other.alias = Alias;
 		}
 
 		/** Swaps this weak pointer's memory with the given shared pointer's memory. */
 		void Swap(Shared& Other) {
-			Node* Node = node;
-			node = Other.node;
-			Other.node = Node;
+			Block* Block = block;
+			Type* Alias = alias;
+			block = Other.block;
+			alias = Other.alias;
+			Other.block = Block;
+			Other.alias = Alias;
 		}
 
-		/** Deletes this weak pointer's shared memory. */
+		/** Deletes this weak pointer's shared memory (aliased weak pointers cannot delete their owner's memory). */
 		bool Delete() {
-			if (node == nullptr) {
+			if (block == nullptr || alias != nullptr) {
 				return false;
 			}
-			return node->Delete();
+			return Owner()->Delete();
 		}
 
 		/** Safely replaces this weak pointer's shared memory with the given pointer. */
 		void Replace(Type* Data) {
-			if (node != nullptr) {
-				node->Replace(Data);
+			if (block != nullptr) {
+				CheckOwner();
+				Owner()->Replace(Data);
 			}
 		}
 
@@ -339,34 +391,28 @@ namespace Toolbox {
 		 * NOTE: The pointer must still be deleted!
 		 */
 		Type* Release() {
-			if (node == nullptr) {
+			if (block == nullptr) {
 				return nullptr;
 			}
-			return node->Release();
+			CheckOwner();
+			return Owner()->Release();
 		}
 
 		/** Clears this weak pointer's reference its shared memory. */
 		bool Clear() {
-			if (node == nullptr) {
+			if (block == nullptr) {
 				return false;
 			}
-			node->DecrementWeak();
-			node = nullptr;
+			Block* Previous = block;
+			block = nullptr;
+			alias = nullptr;
+			Previous->DecrementWeak();
 			return true;
 		}
 
 		/** Resets this weak pointer to a new shared pointer. */
-		void Reset(Shared& Data) {
-			if (node != nullptr) {
-				if (node->Data() == Data.node) {
-					return;
-				}
-				node->DecrementWeak();
-			}
-			node = Data.node;
-			if (node != nullptr) {
-				node->IncrementWeak();
-			}
+		void Reset(const Shared& Data) {
+			Share(Data.block, Data.alias);
 		}
 	};
 
@@ -376,4 +422,18 @@ namespace Toolbox {
 	/** A wrapper for an array pointer that can read from other smart pointers' memory without owning it. */
 	template <typename Type>
 	using WeakArray = Weak<Type, DeleteArray>;
+
+
+	// ATOMIC WEAK POINTER
+
+	/** A wrapper for a pointer that can read from other thread-safe smart pointers' memory without owning it. */
+	template <typename Type>
+	using AtomicWeak = Weak<Type, Delete, true>;
+
+
+	// ATOMIC WEAK ARRAY POINTER
+
+	/** A wrapper for an array pointer that can read from other thread-safe smart pointers' memory without owning it. */
+	template <typename Type>
+	using AtomicWeakArray = Weak<Type, DeleteArray, true>;
 }